@@ -61,6 +61,10 @@
 
 #include "rkh.h"
 #include "bsp_common.h"
+#include "rkhfwk_evtser.h"
+#if defined(__LNXGNU__) && (RKH_CFG_FWK_MAX_SER_SIGNALS > 0)
+#include "rkhport_rec.h"
+#endif
 
 RKH_THIS_MODULE
 
@@ -99,7 +103,11 @@ isr_tmrThread(void *d)
     while (rkhport_fwk_is_running())
     {
     #if defined(RKH_CFG_TRC_TMR_EN) && (RKH_CFG_TRC_TMR_EN == RKH_ENABLED)
+    #if defined(__LNXGNU__) && (RKH_CFG_FWK_MAX_SER_SIGNALS > 0)
+        rkhport_rec_tick(0);    /* logged while recording */
+    #else
         RKH_TIM_TICK(0);
+    #endif
     #endif
         usleep(tick_msec);
     }
@@ -60,6 +60,9 @@
 #include "getopt.h"
 #include "trace_io_cfg.h"
 #include "trace_io_tcp.h"
+#if RKH_CFG_TRC_SHARED_EN == RKH_ENABLED
+#include "rkhport_trc.h"
+#endif
 
 /* ----------------------------- Local macros ------------------------------ */
 /* ------------------------------- Constants ------------------------------- */
@@ -93,6 +96,7 @@ static TRACE_CFG_ST config =
 
 static FILE *ftbin = NULL;
 static int tsock;
+static rbool_t isMapped = RKH_FALSE;
 
 /* ----------------------- Local function prototypes ----------------------- */
 /* ---------------------------- Local functions ---------------------------- */
@@ -127,6 +131,20 @@ trace_io_setConfig(int argc, char **argv)
 void
 rkh_trc_open(void)
 {
+#if RKH_CFG_TRC_SHARED_EN == RKH_ENABLED
+    if (strlen(config.ftbinName) != 0)
+    {
+        if (rkhport_trc_map(config.ftbinName) != 0)
+        {
+            printf("Can't map trace file %s\n", config.ftbinName);
+            exit(EXIT_FAILURE);
+        }
+        isMapped = RKH_TRUE;
+        rkh_trc_init();
+        RKH_TRC_SEND_CFG(BSP_TS_RATE_HZ);
+        return;
+    }
+#endif
     rkh_trc_init();
 
     if (strlen(config.ftbinName) != 0)
@@ -153,7 +171,13 @@ rkh_trc_open(void)
 void
 rkh_trc_close(void)
 {
-    if (ftbin != NULL)
+    if (isMapped)
+    {
+#if RKH_CFG_TRC_SHARED_EN == RKH_ENABLED
+        rkhport_trc_unmap();
+#endif
+    }
+    else if (ftbin != NULL)
     {
         fclose(ftbin);
     }
@@ -174,6 +198,10 @@ rkh_trc_flush(void)
 {
 	rui8_t *d;
 
+    if (isMapped)       /* the reader drains the mapped file */
+    {
+        return;
+    }
 	while( ( d = rkh_trc_get() ) != ( rui8_t* )0 )
 	{
         if (ftbin != NULL)
@@ -79,10 +79,12 @@ extern "C" {
 /**
  *  \brief
  *  Specify the maximum number of state machine applications (SMA) to be used
- *  by the application (can be a number in the range [1..64]).
+ *  by the application (can be a number in the range [1..256]).
+ *  Since priorities are rui8_t, 256 is also the maximum number of 
+ *  priority levels.
  *
  *  \type       Integer
- *  \range      [1..64]
+ *  \range      [1..256]
  *  \default    4
  */
 #define RKH_CFG_FWK_MAX_SMA             4u
@@ -200,6 +202,85 @@ extern "C" {
  */
 #define RKH_CFG_FWK_MAX_SUBS_CHANNELS   16
 
+/**
+ *  \brief
+ *  Specify the number of signals to which an active object can subscribe 
+ *  by means of rkh_pubsub_subscribeSig(), in order to publish events by 
+ *  signal using RKH_PUBLISH(). Only signals less than this number can be 
+ *  subscribed and published. If it is zero or it is not defined, the 
+ *  signal-based subscription is not included.
+ *
+ *  \type       Integer
+ *  \range      [0..1024]
+ *  \default    0
+ */
+#define RKH_CFG_FWK_MAX_SUBS_SIGNALS    0
+
+/**
+ *  \brief
+ *  If the #RKH_CFG_FWK_PUBSUB_FILTER_EN is set to 1, subscribers can 
+ *  install a content filter by means of rkh_pubsub_setFilter(), which is 
+ *  evaluated in the context of the publisher before posting, so that 
+ *  unwanted events are never enqueued. Also, RKH counts the events 
+ *  accepted and rejected by every filter, see rkh_pubsub_getFilterInfo().
+ *
+ *  \type       Boolean
+ *  \range      
+ *  \default    RKH_DISABLED
+ */
+#define RKH_CFG_FWK_PUBSUB_FILTER_EN    RKH_DISABLED
+
+/**
+ *  \brief
+ *  Specify the number of signals which can register a serialization 
+ *  layout by means of rkh_evtser_register(), so that their events are 
+ *  encoded and decoded by rkh_evtser_encode() and rkh_evtser_decode(). 
+ *  Only signals less than this number can be registered. If it is zero or 
+ *  it is not defined, the event serialization is not included.
+ *
+ *  \type       Integer
+ *  \range      [0..1024]
+ *  \default    0
+ */
+#define RKH_CFG_FWK_MAX_SER_SIGNALS     0
+
+/**
+ *  \brief
+ *  If the #RKH_CFG_FWK_SCHED_FAIR_EN is set to 1, the native scheduler 
+ *  allows to select, by means of rkh_fwk_setSchedPolicy(), a bounded-burst 
+ *  policy (RKH_SCHED_BURST) or a round-robin one among groups of 
+ *  priorities (RKH_SCHED_RR), besides the strict priority one. Also, the 
+ *  events dispatched under every policy are counted in RKH_SMAI_T.
+ *
+ *  \type       Boolean
+ *  \range      
+ *  \default    RKH_DISABLED
+ */
+#define RKH_CFG_FWK_SCHED_FAIR_EN       RKH_DISABLED
+
+/**
+ *  \brief
+ *  Specify the default number of events that an active object dispatches 
+ *  in a row, without looking up the highest priority one, under the 
+ *  RKH_SCHED_BURST policy. See rkh_fwk_setBurstQuota().
+ *
+ *  \type       Integer
+ *  \range      [1..255]
+ *  \default    4
+ */
+#define RKH_CFG_FWK_SCHED_BURST         4
+
+/**
+ *  \brief
+ *  Specify the number of consecutive priorities which are served in 
+ *  round-robin order under the RKH_SCHED_RR policy.
+ *
+ *  \type       Integer
+ *  \range      [1..RKH_CFG_FWK_MAX_SMA]
+ *  \default    4
+ */
+#define RKH_CFG_FWK_SCHED_RR_GROUP      4
+
 /**
  *  \brief
  *  If the #RKH_CFG_HOOK_DISPATCH_EN is set to 1, RKH will invoke the
@@ -226,6 +307,20 @@ extern "C" {
  */
 #define RKH_CFG_HOOK_SIGNAL_EN          RKH_ENABLED
 
+/**
+ *  \brief
+ *  If the #RKH_CFG_HOOK_POST_EN is set to 1, RKH will invoke the post hook 
+ *  function rkh_hook_post() when an event is posted to the event queue of 
+ *  a SMA, with both the consumer SMA and the event, i.e. to record the 
+ *  events of an application. When this is set the application must 
+ *  provide the hook function.
+ *
+ *  \type       Boolean
+ *  \range
+ *  \default    RKH_DISABLED
+ */
+#define RKH_CFG_HOOK_POST_EN            RKH_DISABLED
+
 /**
  *  \brief
  *  If the #RKH_CFG_HOOK_TIMEOUT_EN is set to 1, RKH will invoke the timeout
@@ -333,6 +428,20 @@ extern "C" {
  */
 #define RKH_CFG_FWK_AWARE_ISR_PRIO      0
 
+/**
+ *  \brief
+ *  Specify the size in bits of the words of the ready bitmap used by the 
+ *  native scheduler and the publish-subscribe channels. Wider words reduce 
+ *  the number of levels of the bitmap on 16 and 32-bit targets. 
+ *  This option is optional, if it is not defined 8-bit words are used when 
+ *  RKH_CFG_FWK_MAX_SMA is up to 64, otherwise 32-bit words.
+ *
+ *  \type       Integer
+ *  \range      [8, 16, 32]
+ *  \default    8
+ */
+#define RKH_CFG_FWK_SIZEOF_RDYGRP_WORD  8
+
 /** @} doxygen end group definition */
 
 /**
@@ -352,6 +461,21 @@ extern "C" {
  */
 #define RKH_CFG_SMA_GET_INFO_EN         RKH_ENABLED
 
+/**
+ *  \brief
+ *  If the #RKH_CFG_SMA_EDF_EN is set to 1 then the native scheduler runs 
+ *  the ready active objects in earliest-deadline-first order instead of by 
+ *  priority. Deadlines are set by means of rkh_smaPrio_setDeadline() and 
+ *  the number of missed ones is retrieved by 
+ *  rkh_smaPrio_getDeadlineMisses(). It requires #RKH_CFG_TMR_EN and the 
+ *  native event queue.
+ *
+ *  \type       Boolean
+ *  \range             
+ *  \default    RKH_DISABLED
+ */
+#define RKH_CFG_SMA_EDF_EN              RKH_DISABLED
+
 /**
  *  \brief
  *  If the #RKH_CFG_SMA_PPRO_EN is set to 1 then RKH allows to reference a
@@ -732,6 +856,21 @@ extern "C" {
  */
 #define RKH_CFG_TRC_RTFIL_SIGNAL_EN     RKH_ENABLED
 
+/**
+ *  \brief
+ *  If the #RKH_CFG_TRC_RTFIL_EN and #RKH_CFG_TRC_RTFIL_FAST_EN are set to 
+ *  1, the event and group filters are also kept in a flat bit table 
+ *  indexed by the trace event ID, which is updated when the filters 
+ *  change. Then, the trace record macros test a disabled event with a 
+ *  single load and branch instead of calling rkh_trc_isoff_(). It takes 
+ *  RKH_TRC_MAX_EVENTS / 8 bytes of RAM.
+ *
+ *  \type       Boolean
+ *  \range      
+ *  \default    RKH_DISABLED
+ */
+#define RKH_CFG_TRC_RTFIL_FAST_EN       RKH_DISABLED
+
 /**
  *  \brief
  *  If the #RKH_CFG_TRC_USER_TRACE_EN is set to 1 then RKH will allow to
@@ -1006,15 +1145,185 @@ extern "C" {
 
 /**
  *  \brief
- *  Specify the maximum number of trace events in the stream. The smaller
- *  this number, the lower the RAM consumption.
+ *  Specify the size of the trace stream [in bytes]. The smaller this 
+ *  number, the lower the RAM consumption. Since its indexes are sized 
+ *  accordingly (see TRCQTY_T), streams of several megabytes are allowed 
+ *  on hosted ports.
  *
  *  \type       Integer
- *  \range      [1..65536]
+ *  \range      [1..2^30]
  *  \default    128
  */
 #define RKH_CFG_TRC_SIZEOF_STREAM       128u
 
+/**
+ *  \brief
+ *  If the #RKH_CFG_TRC_MAX_RINGS is greater than zero, each thread builds 
+ *  its trace records into its own ring, without locking, and the records 
+ *  are merged by timestamp into the trace stream when it is read. It is 
+ *  the maximum number of threads that may emit trace records; the records 
+ *  of further threads are discarded. It requires #RKH_CFG_TRC_TSTAMP_EN 
+ *  and thread-local storage.
+ *
+ *  \type       Integer
+ *  \range      [0..255]
+ *  \default    0
+ */
+#define RKH_CFG_TRC_MAX_RINGS           0u
+
+/**
+ *  \brief
+ *  Specify the size of each raw trace ring [in bytes], either per-thread 
+ *  or deferred. It must be a power of two.
+ *
+ *  \type       Integer
+ *  \range      [4..65536]
+ *  \default    1024
+ */
+#define RKH_CFG_TRC_SIZEOF_RING         1024u
+
+/**
+ *  \brief
+ *  If the #RKH_CFG_TRC_DEFERRED_EN is set to 1, trace records are stored 
+ *  raw into a ring of #RKH_CFG_TRC_SIZEOF_RING bytes, and the escaping, 
+ *  checksum and sequence number are added when the trace stream is read, 
+ *  that is, from rkh_trc_flush() in the idle loop. This shortens the time 
+ *  spent inside the critical section by the instrumented code. Records 
+ *  that do not fit into the ring are discarded and counted, see 
+ *  rkh_trc_getRingDropped().
+ *
+ *  \type       Boolean
+ *  \range      
+ *  \default    RKH_DISABLED
+ */
+#define RKH_CFG_TRC_DEFERRED_EN         RKH_DISABLED
+
+/**
+ *  \brief
+ *  If the #RKH_CFG_TRC_SIZEOF_RECORD is greater than zero, each trace 
+ *  record is built into a buffer of this size [in bytes], and then it is 
+ *  escaped, checksummed and copied into the trace stream in one pass, 
+ *  instead of byte by byte. Longer records are encoded in several chunks. 
+ *  The format of the stream does not change. Unless the trace stream is 
+ *  shared or used as a flight recorder, each record is reserved in the 
+ *  trace stream as a whole, so that it is dropped when it does not fit 
+ *  and the number of dropped records is emitted as a #RKH_TE_FWK_DROP 
+ *  record. See rkh_trc_getDropped().
+ *
+ *  \type       Integer
+ *  \range      [0..64]
+ *  \default    0
+ */
+#define RKH_CFG_TRC_SIZEOF_RECORD       0u
+
+/**
+ *  \brief
+ *  If the #RKH_CFG_TRC_COMPACT_EN is set to 1 then RKH uses the compact 
+ *  trace format, which sends timestamps as LEB128 deltas from the previous 
+ *  record and object and function addresses as LEB128 indexes of a symbol 
+ *  table, assigned on first use. It needs the trace timestamp and it can 
+ *  not be used along with trace rings. The records are decoded by means 
+ *  of rkhtrc_decode.h.
+ *
+ *  \type       Boolean
+ *  \range      
+ *  \default    RKH_DISABLED
+ */
+#define RKH_CFG_TRC_COMPACT_EN          RKH_DISABLED
+
+/**
+ *  \brief
+ *  Specify the number of entries of the symbol table used by the compact 
+ *  trace format. It must be a power of two. When it is full, addresses 
+ *  are sent whole.
+ *
+ *  \type       Integer
+ *  \range      [4..256]
+ *  \default    64
+ */
+#define RKH_CFG_TRC_SIZEOF_SYMTBL       64u
+
+/**
+ *  \brief
+ *  Specify the number of records of the compact trace format between two 
+ *  key records. A key record carries the whole timestamp and restarts the 
+ *  symbol table, so that a decoder recovers from lost records.
+ *
+ *  \type       Integer
+ *  \range      [1..255]
+ *  \default    64
+ */
+#define RKH_CFG_TRC_SYNC_PERIOD         64u
+
+/**
+ *  \brief
+ *  If the #RKH_CFG_TRC_SHARED_EN is set to 1 then the trace stream and its 
+ *  read and write indexes are kept in a RKHTrcShared area, i.e. a 
+ *  memory-mapped file given by rkh_trcStream_attach(), so that an external 
+ *  reader drains the stream without any copy and without calling 
+ *  rkh_trc_flush(). The stream size must be a power of two and it can not 
+ *  be used along with trace rings.
+ *
+ *  \type       Boolean
+ *  \range      
+ *  \default    RKH_DISABLED
+ */
+#define RKH_CFG_TRC_SHARED_EN           RKH_DISABLED
+
+/**
+ *  \brief
+ *  If the #RKH_CFG_TRC_FLIGHT_EN is set to 1 then the trace stream works 
+ *  as a flight recorder: records are always stored, overwriting the 
+ *  oldest ones, but rkh_trc_get() and friends retrieve nothing until a 
+ *  trigger freezes the stream. Then, the last RKH_CFG_TRC_SIZEOF_STREAM 
+ *  bytes are dumped by rkh_trc_flush() as usual. The triggers are 
+ *  rkh_trc_freeze(), the event given to rkh_trc_setTrigger() and any 
+ *  failed assertion. It can not be used along with trace rings.
+ *
+ *  \type       Boolean
+ *  \range      
+ *  \default    RKH_DISABLED
+ */
+#define RKH_CFG_TRC_FLIGHT_EN           RKH_DISABLED
+
+/**
+ *  \brief
+ *  If the #RKH_CFG_TRC_SAMPLING_EN is set to 1 then RKH allows to sample 
+ *  high-frequency trace events, either per event or per group, by means 
+ *  of RKH_SAMPLE_EVENT(), RKH_SAMPLE_GROUP(), RKH_RATE_LIMIT_EVENT() and 
+ *  RKH_RATE_LIMIT_GROUP(). Only one out of every N records, or up to N 
+ *  records per second, are emitted. The sampling is applied after the 
+ *  runtime filters, so it needs #RKH_CFG_TRC_RTFIL_EN, and the rate limit 
+ *  needs the trace timestamp.
+ *
+ *  \type       Boolean
+ *  \range      
+ *  \default    RKH_DISABLED
+ */
+#define RKH_CFG_TRC_SAMPLING_EN         RKH_DISABLED
+
+/**
+ *  \brief
+ *  Specify the maximum number of trace events and groups sampled at once.
+ *
+ *  \type       Integer
+ *  \range      [1..255]
+ *  \default    4
+ */
+#define RKH_CFG_TRC_MAX_SAMPLERS        4u
+
+/**
+ *  \brief
+ *  Specify the frequency of the timestamp returned by rkh_trc_getts() [in 
+ *  Hz], which is used to limit the rate of sampled trace events. A second 
+ *  must fit in the timestamp size, see #RKH_CFGPORT_TRC_SIZEOF_TSTAMP.
+ *
+ *  \type       Integer
+ *  \range      
+ *  \default    RKH_CFG_FWK_TICK_RATE_HZ
+ */
+#define RKH_CFG_TRC_TSTAMP_HZ           RKH_CFG_FWK_TICK_RATE_HZ
+
 /** @} doxygen end group definition */
 
 /**
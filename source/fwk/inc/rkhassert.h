@@ -82,6 +82,19 @@ extern "C" {
 #endif
 
 /* --------------------------------- Macros -------------------------------- */
+#if defined(RKH_CFG_TRC_FLIGHT_EN) && (RKH_CFG_TRC_FLIGHT_EN == RKH_ENABLED) \
+    && (RKH_CFG_TRC_EN == RKH_ENABLED)
+    /**
+     *  \brief
+     *  Freezes the trace flight recorder on a failed assertion, see 
+     *  rkh_trc_freezeOnAssert().
+     */
+    #define RKH_TRC_FREEZE_ON_ASSERT(ln_) \
+        rkh_trc_freezeOnAssert(m_name, (ln_))
+#else
+    #define RKH_TRC_FREEZE_ON_ASSERT(ln_)   (void)0
+#endif
+
 #if RKH_CFG_FWK_ASSERT_EN == RKH_ENABLED
     /**
      *  \brief
@@ -132,6 +145,7 @@ extern "C" {
         } \
         else \
         { \
+            RKH_TRC_FREEZE_ON_ASSERT(__LINE__); \
             rkh_assert(m_name, __LINE__); \
         }
 
@@ -160,7 +174,8 @@ extern "C" {
      *
      *  \ingroup apiAssert
      */
-    #define RKH_ERROR()         rkh_assert(m_name, __LINE__)
+    #define RKH_ERROR() \
+        (RKH_TRC_FREEZE_ON_ASSERT(__LINE__), rkh_assert(m_name, __LINE__))
 
 #else
     #define RKH_ASSERT(exp)     ((void)0)
@@ -261,6 +276,20 @@ extern "C" {
  *  \ingroup apiAssert
  */
 void rkh_assert(const char *const file, int line);
+
+#if defined(RKH_CFG_TRC_FLIGHT_EN) && (RKH_CFG_TRC_FLIGHT_EN == RKH_ENABLED) \
+    && (RKH_CFG_TRC_EN == RKH_ENABLED)
+/**
+ *  \brief
+ *  Records a RKH_TE_FWK_ASSERT event, freezes the trace flight recorder 
+ *  and dumps it by means of rkh_trc_flush(), before rkh_assert() is 
+ *  called. It does nothing if the recorder is already frozen.
+ *
+ *  \param[in] file    file name where the assertion failed.
+ *  \param[in] line    line number where the assertion failed.
+ */
+void rkh_trc_freezeOnAssert(const char *const file, int line);
+#endif
 #endif
 
 /* -------------------- External C language linkage end -------------------- */
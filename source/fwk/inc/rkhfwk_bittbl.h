@@ -62,6 +62,25 @@ extern "C" {
 #endif
 
 /* --------------------------------- Macros -------------------------------- */
+/**
+ *  \brief
+ *  Retrieves the bit position of the least significant bit set - a number 
+ *  between 0 and 7 (from a non-zero 8-bit value).
+ *
+ *  When the compiler offers a count-trailing-zeros intrinsic it is used, 
+ *  otherwise it falls back to rkh_bittbl_getLeastBitSetPos(). The result is 
+ *  undefined if \a value_ is zero.
+ *
+ *  \param[in] value_   non-zero data value.
+ */
+#if defined(__GNUC__)
+    #define RKH_BITTBL_LSB_POS(value_) \
+        (rui8_t)__builtin_ctz((unsigned int)(value_))
+#else
+    #define RKH_BITTBL_LSB_POS(value_) \
+        rkh_bittbl_getLeastBitSetPos((rui8_t)(value_))
+#endif
+
 /* -------------------------------- Constants ------------------------------ */
 #define RKH_INVALID_BITPOS      (rui8_t)0xff
 
@@ -407,6 +407,23 @@ void rkh_dynEvt_init(void);
  */
 void rkh_fwk_registerEvtPool(void *sstart, rui32_t ssize, RKH_ES_T esize);
 
+/**
+ *  \brief
+ *  Retrieves the storage of a registered event pool, i.e. to lock it in 
+ *  memory or to pre-fault it.
+ *
+ *  \param[in] index    index of the event pool, in order of registration.
+ *  \param[out] sstart  storage start, as passed to rkh_fwk_registerEvtPool().
+ *  \param[out] ssize   storage size in bytes.
+ *
+ *  \return
+ *  RKH_TRUE if the event pool \a index is registered, otherwise RKH_FALSE.
+ *
+ *  \ingroup apiEvt
+ */
+rbool_t rkh_fwk_getEvtPoolStorage(rui8_t index, void **sstart, 
+                                  rui32_t *ssize);
+
 /**
  *  \brief
  *  Allocates an event from the previously created event pool.
@@ -0,0 +1,255 @@
+/*
+ *  --------------------------------------------------------------------------
+ *
+ *                                Framework RKH
+ *                                -------------
+ *
+ *            State-machine framework for reactive embedded systems
+ *
+ *                      Copyright (C) 2010 Leandro Francucci.
+ *          All rights reserved. Protected by international copyright laws.
+ *
+ *
+ *  RKH is free software: you can redistribute it and/or modify it under the
+ *  terms of the GNU General Public License as published by the Free Software
+ *  Foundation, either version 3 of the License, or (at your option) any
+ *  later version.
+ *
+ *  RKH is distributed in the hope that it will be useful, but WITHOUT ANY
+ *  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with RKH, see copying.txt file.
+ *
+ *  Contact information:
+ *  RKH site: http://vortexmakes.com/que-es/
+ *  RKH GitHub: https://github.com/vortexmakes/RKH
+ *  RKH Sourceforge: https://sourceforge.net/projects/rkh-reactivesys/
+ *  e-mail: lf@vortexmakes.com
+ *  ---------------------------------------------------------------------------
+ */
+
+
+/**
+ *  \file       rkhfwk_evtser.h
+ *  \ingroup    fwk
+ *  \brief      Specifies the descriptor-based event serialization interface.
+ *  \details    Every signal to be serialized registers a layout, which 
+ *              describes the fields of its event structure: their offsets, 
+ *              sizes and byte order on the wire, and an optional 
+ *              variable-length tail. Hence, events are encoded into and 
+ *              decoded from a compact binary format, i.e. to be sent to 
+ *              another process, stored or replayed, without writing any 
+ *              code per event and without any intermediate allocation.
+ */
+
+/* -------------------------- Development history -------------------------- */
+/*
+ *  2026.10.19  LeFr  v3.4.00  Initial version
+ */
+
+/* -------------------------------- Authors -------------------------------- */
+/*
+ *  LeFr  Leandro Francucci  lf@vortexmakes.com
+ */
+
+/* --------------------------------- Notes --------------------------------- */
+/*
+ *  An encoded event is made up of its signal, as an unsigned LEB128 
+ *  number, followed by its fields in the order given by the layout, and 
+ *  then by the used elements of the tail, if any. Apart from its signal, 
+ *  the RKH_EVT_T base is not encoded, nor are the padding bytes.
+ */
+
+/* --------------------------------- Module -------------------------------- */
+#ifndef __RKHFWK_EVTSER_H__
+#define __RKHFWK_EVTSER_H__
+
+/* ----------------------------- Include files ----------------------------- */
+#include <stddef.h>
+#include "rkhitl.h"
+
+/* ---------------------- External C language linkage ---------------------- */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* --------------------------------- Macros -------------------------------- */
+/**
+ *  \brief
+ *  Initializes a field descriptor from a member of an event structure.
+ *
+ *  \param[in] type_    event structure, i.e. derived from RKH_EVT_T.
+ *  \param[in] member_  member of \a type_.
+ *  \param[in] kind_    RKH_SER_LE, RKH_SER_BE or RKH_SER_RAW.
+ *
+ *  \usage
+ *  \code
+ *  static const RKHSerField setPointFields[] =
+ *  {
+ *      RKH_SER_FIELD(SetPointEvt, value, RKH_SER_BE),
+ *      RKH_SER_FIELD(SetPointEvt, unit, RKH_SER_RAW)
+ *  };
+ *  \endcode
+ */
+#define RKH_SER_FIELD(type_, member_, kind_) \
+    { \
+        (rui16_t)offsetof(type_, member_), \
+        (rui16_t)sizeof(((type_ *)0)->member_), \
+        (rui8_t)(kind_) \
+    }
+
+/* -------------------------------- Constants ------------------------------ */
+/**
+ *  \brief
+ *  Number of signals, from 0 to RKH_CFG_FWK_MAX_SER_SIGNALS - 1, which can 
+ *  register a serialization layout. If it is not defined in rkhcfg.h or it 
+ *  is zero, the event serialization is not included.
+ */
+#ifndef RKH_CFG_FWK_MAX_SER_SIGNALS
+    #define RKH_CFG_FWK_MAX_SER_SIGNALS     0
+#endif
+
+/** Integer field, least significant byte first on the wire */
+#define RKH_SER_LE      0u
+
+/** Integer field, most significant byte first on the wire */
+#define RKH_SER_BE      1u
+
+/** Opaque field, i.e. a string, copied byte by byte */
+#define RKH_SER_RAW     2u
+
+/* ------------------------------- Data types ------------------------------ */
+/**
+ *  \brief
+ *  Describes a field of an event structure. The size of an integer field 
+ *  must be 1, 2, 4 or 8 bytes.
+ */
+typedef struct RKHSerField RKHSerField;
+struct RKHSerField
+{
+    rui16_t offset;     /**< offset within the event, i.e. offsetof() */
+    rui16_t size;       /**< size [in bytes] */
+    rui8_t kind;        /**< RKH_SER_LE, RKH_SER_BE or RKH_SER_RAW */
+};
+
+/**
+ *  \brief
+ *  Describes the variable-length tail of an event structure, an array of 
+ *  which only the elements in use are encoded. The number of elements in 
+ *  use is held by an integer field of the layout.
+ */
+typedef struct RKHSerTail RKHSerTail;
+struct RKHSerTail
+{
+    RKHSerField elem;   /**< offset of the array, element size and kind */
+    rui8_t countField;  /**< index of the field holding the # of elements */
+    rui16_t maxCount;   /**< capacity of the array [in elements] */
+};
+
+/**
+ *  \brief
+ *  Describes how the events of a signal are serialized.
+ */
+typedef struct RKHSerLayout RKHSerLayout;
+struct RKHSerLayout
+{
+    RKH_ES_T evtSize;           /**< size of the event structure */
+    const RKHSerField *fields;  /**< fields, in order of encoding */
+    rui8_t nFields;             /**< number of fields */
+    const RKHSerTail *tail;     /**< variable-length tail, or NULL */
+};
+
+/* -------------------------- External variables --------------------------- */
+/* -------------------------- Function prototypes -------------------------- */
+#if RKH_CFG_FWK_MAX_SER_SIGNALS > 0
+/**
+ *  \brief
+ *  Removes every registered layout.
+ */
+void rkh_evtser_init(void);
+
+/**
+ *  \brief
+ *  Registers the layout of the events of a signal.
+ *
+ *  \param[in] signal   signal, less than RKH_CFG_FWK_MAX_SER_SIGNALS.
+ *  \param[in] layout   layout of its events, which must remain valid. A 
+ *                      NULL pointer removes the layout of \a signal.
+ */
+void rkh_evtser_register(RKH_SIG_T signal, const RKHSerLayout *layout);
+
+/**
+ *  \brief
+ *  Retrieves the size of the event structure of a signal, i.e. to allocate 
+ *  the event to be decoded.
+ *
+ *  \param[in] signal   signal.
+ *
+ *  \return
+ *  The size of the event structure, or zero if \a signal has not a 
+ *  registered layout.
+ */
+RKH_ES_T rkh_evtser_getEvtSize(RKH_SIG_T signal);
+
+/**
+ *  \brief
+ *  Encodes an event.
+ *
+ *  \param[in] e        event to encode.
+ *  \param[out] buf     destination buffer.
+ *  \param[in] size     size of \a buf [in bytes].
+ *
+ *  \return
+ *  The number of encoded bytes, or zero if the signal of \a e has not a 
+ *  registered layout, its tail holds more elements than its capacity or 
+ *  \a buf is too small.
+ */
+rui32_t rkh_evtser_encode(const RKH_EVT_T *e, rui8_t *buf, rui32_t size);
+
+/**
+ *  \brief
+ *  Retrieves the signal of an encoded event, without decoding it.
+ *
+ *  \param[in] buf      encoded event.
+ *  \param[in] size     number of bytes available in \a buf.
+ *  \param[out] signal  signal of the encoded event.
+ *
+ *  \return
+ *  The number of bytes of the encoded signal, or zero if \a buf is 
+ *  malformed.
+ */
+rui32_t rkh_evtser_getSig(const rui8_t *buf, rui32_t size, 
+                          RKH_SIG_T *signal);
+
+/**
+ *  \brief
+ *  Decodes an event into storage provided by the caller.
+ *
+ *  Only the signal and the fields of the layout are written, thus the 
+ *  members \c nref and \c pool of a dynamic event are preserved.
+ *
+ *  \param[in] buf      encoded event.
+ *  \param[in] size     number of bytes available in \a buf.
+ *  \param[out] e       decoded event. Its storage must be at least as 
+ *                      large as rkh_evtser_getEvtSize() of its signal.
+ *
+ *  \return
+ *  The number of consumed bytes, or zero if \a buf is malformed, truncated 
+ *  or its signal has not a registered layout. In such a case, the content 
+ *  of \a e is undefined.
+ */
+rui32_t rkh_evtser_decode(const rui8_t *buf, rui32_t size, RKH_EVT_T *e);
+#endif
+
+/* -------------------- External C language linkage end -------------------- */
+#ifdef __cplusplus
+}
+#endif
+
+/* ------------------------------ Module end ------------------------------- */
+#endif
+
+/* ------------------------------ End of file ------------------------------ */
@@ -62,6 +62,10 @@ extern "C" {
 #endif
 
 /* --------------------------------- Macros -------------------------------- */
+#ifndef RKH_CFG_HOOK_POST_EN
+    #define RKH_CFG_HOOK_POST_EN    RKH_DISABLED
+#endif
+
 #if (RKH_CFG_HOOK_DISPATCH_EN == RKH_ENABLED)
     #define RKH_HOOK_DISPATCH(sma, e) \
         rkh_hook_dispatch((sma), (RKH_EVT_T *)(e))
@@ -69,6 +73,13 @@ extern "C" {
     #define RKH_HOOK_DISPATCH(sma, e)   (void)0
 #endif
 
+#if (RKH_CFG_HOOK_POST_EN == RKH_ENABLED)
+    #define RKH_HOOK_POST(sma, e) \
+        rkh_hook_post((sma), (const RKH_EVT_T *)(e))
+#else
+    #define RKH_HOOK_POST(sma, e)       (void)0
+#endif
+
 #if (RKH_CFG_HOOK_TIMEOUT_EN == RKH_ENABLED)
     #define RKH_HOOK_TIMEOUT(t)     rkh_hook_timeout((t))
 #else
@@ -142,6 +153,24 @@ void rkh_hook_dispatch(RKH_SMA_T *me, RKH_EVT_T *e);
  */
 void rkh_hook_signal(RKH_EVT_T *e);
 
+/**
+ *  \brief
+ *  When an event is posted, FIFO or LIFO, to the event queue of a SMA the 
+ *  rkh_hook_post() will optionally called. Unlike rkh_hook_signal(), it 
+ *  also receives the consumer, i.e. to record the events of a SMA.
+ *
+ *  \param[in] me   pointer to the consumer SMA.
+ *	\param[in] e    pointer to posted event.
+ *
+ *	\note
+ *	The post hook will only get called if RKH_CFG_HOOK_POST_EN is set to 1 
+ *	within rkhcfg.h file. When this is set the application must provide 
+ *	the hook function. It is called outside of the critical section.
+ *
+ *	\ingroup apiBSPHook
+ */
+void rkh_hook_post(const RKH_SMA_T *me, const RKH_EVT_T *e);
+
 /**
  *  \brief
  *  If a timer expires the rkh_hook_timeout() function is called just before
@@ -79,8 +79,67 @@ extern "C" {
 #endif
 
 /* --------------------------------- Macros -------------------------------- */
+#if defined(RKH_CFG_FWK_MAX_SUBS_SIGNALS) && (RKH_CFG_FWK_MAX_SUBS_SIGNALS > 0)
+/**
+ *  \brief
+ *  Publishes an event to the active objects subscribed to its signal.
+ *
+ *  \param[in] evt_     pointer to event to publish.
+ *  \param[in] sender_  pointer to the sender object.
+ *
+ *  \sa
+ *  rkh_pubsub_publishSig().
+ */
+#define RKH_PUBLISH(evt_, sender_) \
+    rkh_pubsub_publishSig((RKH_EVT_T *)(evt_), (sender_))
+#endif
+
 /* -------------------------------- Constants ------------------------------ */
+/**
+ *  \brief
+ *  Number of signals, from 0 to RKH_CFG_FWK_MAX_SUBS_SIGNALS - 1, to which 
+ *  an active object can subscribe by means of rkh_pubsub_subscribeSig(). 
+ *  If it is not defined in rkhcfg.h or it is zero, the signal-based 
+ *  subscription is not included.
+ */
+#ifndef RKH_CFG_FWK_MAX_SUBS_SIGNALS
+    #define RKH_CFG_FWK_MAX_SUBS_SIGNALS    0
+#endif
+
+/**
+ *  \brief
+ *  If it is set to RKH_ENABLED, subscribers can install a content filter 
+ *  by means of rkh_pubsub_setFilter(). If it is not defined in rkhcfg.h, 
+ *  content filters are not included.
+ */
+#ifndef RKH_CFG_FWK_PUBSUB_FILTER_EN
+    #define RKH_CFG_FWK_PUBSUB_FILTER_EN    RKH_DISABLED
+#endif
+
 /* ------------------------------- Data types ------------------------------ */
+#if RKH_CFG_FWK_PUBSUB_FILTER_EN == RKH_ENABLED
+/**
+ *  \brief
+ *  Content filter of a subscriber. It is invoked in the context of the 
+ *  publisher, before posting the event, thus it must be short and it must 
+ *  not block. It returns zero to reject the event, so that the event is 
+ *  never enqueued to the subscriber, otherwise the event is posted.
+ */
+typedef rbool_t (*RKHPubSubFilter)(const RKH_SMA_T *subscriber, 
+                                   const RKH_EVT_T *event);
+
+/**
+ *  \brief
+ *  Hit counters of the content filter of a subscriber.
+ */
+typedef struct RKHPubSubFilterInfo RKHPubSubFilterInfo;
+struct RKHPubSubFilterInfo
+{
+    rui32_t nPassed;        /**< # of published events accepted */
+    rui32_t nRejected;      /**< # of published events discarded */
+};
+#endif
+
 /* -------------------------- External variables --------------------------- */
 /* -------------------------- Function prototypes -------------------------- */
 /**
@@ -118,17 +177,77 @@ void rkh_pubsub_subscribe(rui8_t channel, const RKH_SMA_T *ao);
  */
 void rkh_pubsub_unsubscribe(rui8_t channel, const RKH_SMA_T *ao);
 
+#if RKH_CFG_FWK_MAX_SUBS_SIGNALS > 0
+/**
+ *  \brief
+ *  Adds an active object to the notification list of a signal.
+ *
+ *  The framework keeps a table of subscribers indexed by signal, so that an 
+ *  event published by means of RKH_PUBLISH() is routed to its subscribers 
+ *  with one lookup, without any application-defined mapping from signals 
+ *  to channels.
+ *
+ *  \param[in] signal   signal to which the active object wants to 
+ *                      subscribe. It must be less than 
+ *                      RKH_CFG_FWK_MAX_SUBS_SIGNALS.
+ *  \param[in] ao       pointer to previously created active object to
+ *                      subscribe.
+ */
+void rkh_pubsub_subscribeSig(RKH_SIG_T signal, const RKH_SMA_T *ao);
+
+/**
+ *  \brief
+ *  Unsubscribes an active object from a signal.
+ *
+ *  \param[in] signal   signal that the active object wishes to unsubscribe 
+ *                      from.
+ *  \param[in] ao       pointer to previously created active object to 
+ *                      unsubscribe.
+ */
+void rkh_pubsub_unsubscribeSig(RKH_SIG_T signal, const RKH_SMA_T *ao);
+#endif
+
 /**
  *  \brief
- *  Unsubscribes an active object from all topics.
+ *  Unsubscribes an active object from all topics and signals.
  *
  *  \param[in] ao       pointer to previously created active object to 
  *                      unsubscribe.
  */
 void rkh_pubsub_unsubscribeAll(const RKH_SMA_T *ao);
 
+#if RKH_CFG_FWK_PUBSUB_FILTER_EN == RKH_ENABLED
+/**
+ *  \brief
+ *  Installs the content filter of a subscriber, which is evaluated for 
+ *  every event published to it, on any channel or signal, and clears its 
+ *  hit counters.
+ *
+ *  \param[in] ao       pointer to previously created active object.
+ *  \param[in] filter   content filter. A NULL pointer removes the filter, 
+ *                      so that every published event is posted.
+ */
+void rkh_pubsub_setFilter(const RKH_SMA_T *ao, RKHPubSubFilter filter);
+
+/**
+ *  \brief
+ *  Retrieves the hit counters of the content filter of a subscriber.
+ *
+ *  \param[in] ao       pointer to previously created active object.
+ *  \param[in] info     pointer to the buffer into which the counters are 
+ *                      copied.
+ */
+void rkh_pubsub_getFilterInfo(const RKH_SMA_T *ao, RKHPubSubFilterInfo *info);
+#endif
+
 /**
  *  \brief
+ *  Posts an event to every active object subscribed to a channel.
+ *
+ *  The subscriber set is copied within a short critical section and the 
+ *  event is posted afterwards, so that the critical section is not held 
+ *  along the whole fan-out. Hence, an active object that unsubscribes while 
+ *  the event is being published could still receive it.
  *
  *  \param[in] channel  identifies the information channel to which event is
  *                      published.
@@ -142,8 +261,27 @@ void rkh_pubsub_unsubscribeAll(const RKH_SMA_T *ao);
  *  \return
  *  The number of found ready active objects.
  */
-rui8_t rkh_pubsub_publish(rui8_t channel, RKH_EVT_T *event, 
-                          const void *const sender);
+rui16_t rkh_pubsub_publish(rui8_t channel, RKH_EVT_T *event, 
+                           const void *const sender);
+
+#if RKH_CFG_FWK_MAX_SUBS_SIGNALS > 0
+/**
+ *  \brief
+ *  Posts an event to every active object subscribed to its signal.
+ *
+ *  Frequently, it is invoked by means of RKH_PUBLISH() macro. It behaves as 
+ *  rkh_pubsub_publish(), but the subscriber set is looked up from the event 
+ *  signal instead of a channel.
+ *
+ *  \param[in] event    pointer to event to publish. Its signal must be less 
+ *                      than RKH_CFG_FWK_MAX_SUBS_SIGNALS.
+ *  \param[in] sender	pointer to the sender object.
+ *
+ *  \return
+ *  The number of found ready active objects.
+ */
+rui16_t rkh_pubsub_publishSig(RKH_EVT_T *event, const void *const sender);
+#endif
 
 /* -------------------- External C language linkage end -------------------- */
 #ifdef __cplusplus
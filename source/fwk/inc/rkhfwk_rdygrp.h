@@ -63,22 +63,52 @@ extern "C" {
 
 /* --------------------------------- Macros -------------------------------- */
 /* -------------------------------- Constants ------------------------------ */
-#if RKH_CFG_FWK_MAX_SMA <= 8
-    #define RKH_NUM_RDYGRP      1
-#elif RKH_CFG_FWK_MAX_SMA > 8 && RKH_CFG_FWK_MAX_SMA <= 16
-    #define RKH_NUM_RDYGRP      2
-#elif RKH_CFG_FWK_MAX_SMA > 16 && RKH_CFG_FWK_MAX_SMA <= 24
-    #define RKH_NUM_RDYGRP      3
-#elif RKH_CFG_FWK_MAX_SMA > 24 && RKH_CFG_FWK_MAX_SMA <= 32
-    #define RKH_NUM_RDYGRP      4
-#elif RKH_CFG_FWK_MAX_SMA > 32 && RKH_CFG_FWK_MAX_SMA <= 40
-    #define RKH_NUM_RDYGRP      5
-#elif RKH_CFG_FWK_MAX_SMA > 40 && RKH_CFG_FWK_MAX_SMA <= 48
-    #define RKH_NUM_RDYGRP      6
-#elif RKH_CFG_FWK_MAX_SMA > 48 && RKH_CFG_FWK_MAX_SMA <= 56
-    #define RKH_NUM_RDYGRP      7
-#elif RKH_CFG_FWK_MAX_SMA > 56 && RKH_CFG_FWK_MAX_SMA <= 64
-    #define RKH_NUM_RDYGRP      8
+/**
+ *  \brief
+ *  Size in bits of the words of the ready bitmap. If it is not defined in 
+ *  rkhcfg.h, 8-bit words are used for up to 64 active objects, which keeps 
+ *  the classic two-level table, otherwise 32-bit words are used.
+ */
+#ifndef RKH_CFG_FWK_SIZEOF_RDYGRP_WORD
+    #if RKH_CFG_FWK_MAX_SMA <= 64
+        #define RKH_CFG_FWK_SIZEOF_RDYGRP_WORD  8
+    #else
+        #define RKH_CFG_FWK_SIZEOF_RDYGRP_WORD  32
+    #endif
+#endif
+
+#if RKH_CFG_FWK_SIZEOF_RDYGRP_WORD == 8
+    #define RKH_RDYGRP_WORD_T       rui8_t
+    #define RKH_RDYGRP_LOG2_BITS    3u
+#elif RKH_CFG_FWK_SIZEOF_RDYGRP_WORD == 16
+    #define RKH_RDYGRP_WORD_T       rui16_t
+    #define RKH_RDYGRP_LOG2_BITS    4u
+#else
+    #define RKH_RDYGRP_WORD_T       rui32_t
+    #define RKH_RDYGRP_LOG2_BITS    5u
+#endif
+
+/** Number of bits per word of the ready bitmap */
+#define RKH_RDYGRP_BITS         (1u << RKH_RDYGRP_LOG2_BITS)
+
+/** Number of words in the lowest level (one bit per active object) */
+#define RKH_RDYGRP_NUM_LEAFS    \
+    ((RKH_CFG_FWK_MAX_SMA + RKH_RDYGRP_BITS - 1u) / RKH_RDYGRP_BITS)
+
+/** Number of words in the intermediate level, when it is needed */
+#define RKH_RDYGRP_NUM_MIDS     \
+    ((RKH_RDYGRP_NUM_LEAFS + RKH_RDYGRP_BITS - 1u) / RKH_RDYGRP_BITS)
+
+#if RKH_RDYGRP_NUM_LEAFS == 1
+    #define RKH_RDYGRP_NUM_LEVELS   1u
+    #define RKH_RDYGRP_NUM_WORDS    1u
+#elif RKH_RDYGRP_NUM_MIDS == 1
+    #define RKH_RDYGRP_NUM_LEVELS   2u
+    #define RKH_RDYGRP_NUM_WORDS    (1u + RKH_RDYGRP_NUM_LEAFS)
+#else
+    #define RKH_RDYGRP_NUM_LEVELS   3u
+    #define RKH_RDYGRP_NUM_WORDS    \
+        (1u + RKH_RDYGRP_NUM_MIDS + RKH_RDYGRP_NUM_LEAFS)
 #endif
 
 /* ------------------------------- Data types ------------------------------ */
@@ -87,38 +117,31 @@ extern "C" {
  *	SMA ready table.
  *
  *  Each SMA is assigned a unique priority level between 0 and
- *  RKH_LOWEST_PRIO.
- *  Each SMA that is ready to run is placed in a ready list consisting of two
- *  variables, rkhrg.grp and rkhrg.tbl[]. SMA priorities are grouped
- *  (8 SMA per group) in rkhrg.grp. Each bit in rkhrg.grp is used to
- *  indicate whenever any SMA in a group is ready to run. When a task
- *  is ready to run it also sets its corresponding bit in the ready table,
- *  rkhrg.tbl[]. The size of rkhrg.tbl[] depends on RKH_LOWEST_PRIO
- *  (see rkhcfg.h).
+ *  RKH_LOWEST_PRIO. The ready list is a hierarchical bitmap of 
+ *  RKH_RDYGRP_NUM_LEVELS levels of machine words, stored in map[]. The 
+ *  lowest level (leafs) holds one bit per SMA, and each bit of an upper 
+ *  level word indicates whenever any bit of the corresponding word in the 
+ *  level below is set, that is, whenever any SMA of that group is ready to 
+ *  run. The root word is always map[0].
  *
- *  SMA's priority = | 0 | 0 | Y | Y | Y | X | X | X |
+ *  For instance, with 8-bit words and up to 64 SMA it degenerates into the 
+ *  classic two-level table:
  *
- *  Y's:	bit position in rkhrg.grp and
- *          index into rkhrg.tbl[RKH_LOWEST_PRIO / 8 + 1]\n
- *  X's:	bit position in rkhrg.tbl[RKH_LOWEST_PRIO / 8 + 1]
+ *  SMA's priority = | 0 | 0 | Y | Y | Y | X | X | X |
  *
- *  The lower 3 bits (X's) of the SMA's priority are used to determine the
- *  bit position in rkhrg.tbl[], while the next three most significant bits
- *  (Y's) are used to determine the index into rkhrg.tbl[].
+ *  Y's:	bit position in the root word (map[0]) and index of the leaf 
+ *          word (map[1 + Y])\n
+ *  X's:	bit position in the leaf word
  *
- *  To determine which priority (and thus which SMA) will run next, the
- *  scheduler determines the lowest priority number that has its bit set in
- *  rkhrg.tbl[]. The relationship between rkhrg.grp and rkhrg.tbl[] is
- *  given by the following rules:
+ *  Bit n of an upper level word is 1 when any bit of its n-th child word is 
+ *  1. To determine which priority (and thus which SMA) will run next, the 
+ *  scheduler descends from the root word taking the least significant bit 
+ *  set in each level, so that finding, setting and clearing a priority 
+ *  costs O(RKH_RDYGRP_NUM_LEVELS), regardless of the number of SMA.
  *
- *  Bit 0 in rkhrg.grp is 1 when any bit in rkhrg.tbl[0] is 1.\n
- *  Bit 1 in rkhrg.grp is 1 when any bit in rkhrg.tbl[1] is 1.\n
- *  Bit 2 in rkhrg.grp is 1 when any bit in rkhrg.tbl[2] is 1.\n
- *  Bit 3 in rkhrg.grp is 1 when any bit in rkhrg.tbl[3] is 1.\n
- *  Bit 4 in rkhrg.grp is 1 when any bit in rkhrg.tbl[4] is 1.\n
- *  Bit 5 in rkhrg.grp is 1 when any bit in rkhrg.tbl[5] is 1.\n
- *  Bit 6 in rkhrg.grp is 1 when any bit in rkhrg.tbl[6] is 1.\n
- *  Bit 7 in rkhrg.grp is 1 when any bit in rkhrg.tbl[7] is 1.
+ *  Priorities are rui8_t across the framework (RKH_ROM_T, trace records 
+ *  and trace filters), hence RKH_CFG_FWK_MAX_SMA, and so the number of 
+ *  priority levels held by the bitmap, is limited to 256.
  *
  *  [JL]
  */
@@ -126,17 +149,10 @@ typedef struct
 {
     /**
      *  \brief
-     *  Each bit in rkhrg.grp is used to indicate whenever any SMA in a group
-     *  is ready to run.
+     *  Words of every level of the bitmap, from the root word (index 0) 
+     *  to the leaf words.
      */
-    rui8_t grp;
-
-    /**
-     *  \brief
-     *  When a task is ready to run it also sets its corresponding bit in the
-     *  ready table, rkhrg.tbl[].
-     */
-    rui8_t tbl[RKH_NUM_RDYGRP];
+    RKH_RDYGRP_WORD_T map[RKH_RDYGRP_NUM_WORDS];
 } RKHRdyGrp;
 
 typedef struct RdyCbArg RdyCbArg;
@@ -167,9 +183,8 @@ rbool_t rkh_rdygrp_isReady(RKHRdyGrp *const me);
  *  \brief
  *  Making an active object ready inserting it into the ready list.
  *
- *  The lower 3 bits of the SMA's priority are used to determine the bit
- *  position in rkhrg.tbl[], while the next three most significant bits are
- *  used to determine the index into rkhrg.tbl[].
+ *  Sets the bit of the active object in its leaf word and propagates the 
+ *  change upwards only while the visited words were empty.
  *
  *  \param[in] me
  *  \param[in] prio     number of active object's priority.
@@ -180,9 +195,9 @@ void rkh_rdygrp_setReady(RKHRdyGrp *const me, rui8_t prio);
  *  \brief
  *  Removing an active object from the ready list.
  *
- *  Clears the ready bit of the active object in rkhrg.tbl[] and clears the 
- *  bit in rkhrg.grp only if all active objects in a group are not ready to 
- *  run, i.e. all bits in rkhrg.tbl[prio >> 3] are 0.
+ *  Clears the ready bit of the active object in its leaf word and clears 
+ *  the bit in the upper level only if all active objects in that group are 
+ *  not ready to run, i.e. all bits of the word become 0.
  *
  *  \param[in] me
  *  \param[in] prio		number of active object's priority.
@@ -193,22 +208,43 @@ void rkh_rdygrp_setUnready(RKHRdyGrp *const me, rui8_t prio);
  *  \brief
  *	Finding the highest priority active object ready.
  *
- *	Another table lookup is performed, rather than scanning through the table
- *	starting with rkhrg.tbl[0] to find the highest priority task ready to
- *	run. Eight bits are used to represent when tasks are ready in a group. The 
- *  least significant bit has the highest priority. Using this byte to index 
- *  the table returns the bit position of the highest priority bit set, a 
- *  number between 0 and 7.
+ *	Rather than scanning through the leaf words to find the highest priority 
+ *	task ready to run, the bitmap is descended from the root word, one word 
+ *	per level. The least significant bit has the highest priority, and its 
+ *	position is obtained by means of a count-trailing-zeros instruction 
+ *	when it is available or a table lookup otherwise.
  *
  *  \param[in] me
  */
 rui8_t rkh_rdygrp_findHighest(RKHRdyGrp *const me);
 
+/**
+ *  \brief
+ *	Finding the highest priority active object ready among those having 
+ *	lower priority than \a prio, without changing the ready group.
+ *
+ *	The bitmap is ascended from the leaf word of \a prio until a word has a 
+ *	bit set after the visited one, and then it is descended as 
+ *	rkh_rdygrp_findHighest() does.
+ *
+ *  \param[in] me
+ *  \param[in] prio     number of active object's priority.
+ *
+ *	\return
+ *  The found priority, or \a prio if there is no one.
+ */
+rui8_t rkh_rdygrp_findNext(RKHRdyGrp *const me, rui8_t prio);
+
 /**
  *  \brief
  *  Traverse a ready list to find the ready active objects and thus invoking 
  *  a callback function.
  *
+ *  Only the non-empty words, given by the upper levels, are visited, and 
+ *  within a word only its set bits are walked, so that the cost is 
+ *  proportional to the number of ready active objects rather than to the 
+ *  table size. The active objects are visited in priority order.
+ *
  *  \param[in] me
  *  \param[in] rdyCb    invoked callback function to every found ready 
  *                      active object.
@@ -217,8 +253,8 @@ rui8_t rkh_rdygrp_findHighest(RKHRdyGrp *const me);
  *	\return
  *  The number of found ready active objects
  */
-rui8_t rkh_rdygrp_traverse(RKHRdyGrp *const me, void (*rdyCb)(RdyCbArg *), 
-                           RdyCbArg *rdyCbArg);
+rui16_t rkh_rdygrp_traverse(RKHRdyGrp *const me, void (*rdyCb)(RdyCbArg *), 
+                            RdyCbArg *rdyCbArg);
 
 /* -------------------- External C language linkage end -------------------- */
 #ifdef __cplusplus
@@ -53,7 +53,7 @@
 #define __RKHFWK_SCHED_H__
 
 /* ----------------------------- Include files ----------------------------- */
-#include "rkhtype.h"
+#include "rkhitl.h"
 
 /* ---------------------- External C language linkage ---------------------- */
 #ifdef __cplusplus
@@ -62,6 +62,55 @@ extern "C" {
 
 /* --------------------------------- Macros -------------------------------- */
 /* -------------------------------- Constants ------------------------------ */
+/**
+ *  \brief
+ *  Scheduling policies of the native scheduler (see 
+ *  rkh_fwk_setSchedPolicy()).
+ *
+ *  - RKH_SCHED_STRICT: the highest priority ready active object is looked 
+ *    up after every dispatched event. It is the default policy.
+ *  - RKH_SCHED_BURST: an active object dispatches up to its burst quota 
+ *    (see rkh_fwk_setBurstQuota()) of queued events without looking up 
+ *    again. If it is still ready when its quota runs out, the next ready 
+ *    active object of lower priority is served before it.
+ *  - RKH_SCHED_RR: priorities are arranged in groups of 
+ *    RKH_CFG_FWK_SCHED_RR_GROUP consecutive priorities, which are served 
+ *    in round-robin order, one event at a time, within the highest 
+ *    priority ready group.
+ */
+#define RKH_SCHED_STRICT            0u
+#define RKH_SCHED_BURST             1u
+#define RKH_SCHED_RR                2u
+#define RKH_SCHED_NUM_POLICIES      3u
+
+/**
+ *  \brief
+ *  If the #RKH_CFG_FWK_SCHED_FAIR_EN is set to 1, the native scheduler 
+ *  provides the RKH_SCHED_BURST and RKH_SCHED_RR policies in addition to 
+ *  the strict priority one.
+ */
+#ifndef RKH_CFG_FWK_SCHED_FAIR_EN
+#define RKH_CFG_FWK_SCHED_FAIR_EN   RKH_DISABLED
+#endif
+
+/**
+ *  \brief
+ *  Default burst quota of active objects, i.e. the maximum number of 
+ *  events dispatched in a row under the RKH_SCHED_BURST policy.
+ */
+#ifndef RKH_CFG_FWK_SCHED_BURST
+#define RKH_CFG_FWK_SCHED_BURST     4u
+#endif
+
+/**
+ *  \brief
+ *  Number of consecutive priorities served in round-robin order under the 
+ *  RKH_SCHED_RR policy.
+ */
+#ifndef RKH_CFG_FWK_SCHED_RR_GROUP
+#define RKH_CFG_FWK_SCHED_RR_GROUP  4u
+#endif
+
 /* ------------------------------- Data types ------------------------------ */
 /* -------------------------- External variables --------------------------- */
 /* -------------------------- Function prototypes -------------------------- */
@@ -147,6 +196,38 @@ void rkh_fwk_enter(void);
  */
 void rkh_fwk_exit(void);
 
+/**
+ *  \brief
+ *  Selects the scheduling policy of the native scheduler. It can be 
+ *  changed at any time, taking effect on the next scheduling decision.
+ *
+ *  \param[in] policy   RKH_SCHED_STRICT, RKH_SCHED_BURST or RKH_SCHED_RR.
+ *
+ *  \note
+ *  This function is only available with the native scheduler and 
+ *  RKH_CFG_FWK_SCHED_FAIR_EN set to 1.
+ *
+ *  \ingroup apiPortMisc
+ */
+void rkh_fwk_setSchedPolicy(rui8_t policy);
+
+/**
+ *  \brief
+ *  Sets the burst quota of an active object under the RKH_SCHED_BURST 
+ *  policy.
+ *
+ *  \param[in] ao       pointer to a registered active object.
+ *  \param[in] quota    maximum number of events dispatched in a row. If it 
+ *                      is zero RKH_CFG_FWK_SCHED_BURST is used.
+ *
+ *  \note
+ *  This function is only available with the native scheduler and 
+ *  RKH_CFG_FWK_SCHED_FAIR_EN set to 1.
+ *
+ *  \ingroup apiPortMisc
+ */
+void rkh_fwk_setBurstQuota(const RKH_SMA_T *ao, rui8_t quota);
+
 /* -------------------- External C language linkage end -------------------- */
 #ifdef __cplusplus
 }
@@ -1229,13 +1229,163 @@ extern "C" {
     #ifndef RKH_CFG_TRC_SIZEOF_STREAM
     #error "RKH_CFG_TRC_SIZEOF_STREAM             not #define'd in 'rkhcfg.h'"
     #error  "                               [MUST be >     0]                 "
-    #error  "                               [     && <= 2048]                 "
+    #error  "                               [     && <= 2^30]                 "
 
     #elif   ((RKH_CFG_TRC_SIZEOF_STREAM == 0) || \
-    (RKH_CFG_TRC_SIZEOF_STREAM > 2048))
+    (RKH_CFG_TRC_SIZEOF_STREAM > 0x40000000ul))
     #error "RKH_CFG_TRC_SIZEOF_STREAM       illegally #define'd in 'rkhcfg.h'"
     #error  "                               [MUST be >    0]                  "
-    #error  "                               [     && <= 2048]                 "
+    #error  "                               [     && <= 2^30]                 "
+    #endif
+
+    #ifdef RKH_CFG_TRC_MAX_RINGS
+    #if ((RKH_CFG_TRC_MAX_RINGS < 0) || (RKH_CFG_TRC_MAX_RINGS > 255))
+    #error "RKH_CFG_TRC_MAX_RINGS           illegally #define'd in 'rkhcfg.h'"
+    #error  "                               [MUST be >=   0]                  "
+    #error  "                               [     && <= 255]                  "
+    #elif ((RKH_CFG_TRC_MAX_RINGS > 0) && \
+           (RKH_CFG_TRC_TSTAMP_EN == RKH_DISABLED))
+    #error "RKH_CFG_TRC_MAX_RINGS           illegally #define'd in 'rkhcfg.h'"
+    #error  "                               [MUST be 0 when the trace ]       "
+    #error  "                               [timestamp is disabled    ]       "
+    #endif
+    #endif
+
+    #ifdef RKH_CFG_TRC_SIZEOF_RING
+    #if ((RKH_CFG_TRC_SIZEOF_RING < 4) || \
+         (RKH_CFG_TRC_SIZEOF_RING > 65536) || \
+         ((RKH_CFG_TRC_SIZEOF_RING & (RKH_CFG_TRC_SIZEOF_RING - 1)) != 0))
+    #error "RKH_CFG_TRC_SIZEOF_RING         illegally #define'd in 'rkhcfg.h'"
+    #error  "                               [MUST be a power of two]          "
+    #error  "                               [     && <= 65536      ]          "
+    #endif
+    #endif
+
+    #ifdef RKH_CFG_TRC_DEFERRED_EN
+    #if ((RKH_CFG_TRC_DEFERRED_EN != RKH_ENABLED) && \
+         (RKH_CFG_TRC_DEFERRED_EN != RKH_DISABLED))
+    #error "RKH_CFG_TRC_DEFERRED_EN         illegally #define'd in 'rkhcfg.h'"
+    #error "                                    [MUST be  RKH_ENABLED ]       "
+    #error "                                    [     ||  RKH_DISABLED]       "
+    #endif
+    #endif
+
+    #ifdef RKH_CFG_TRC_SIZEOF_RECORD
+    #if ((RKH_CFG_TRC_SIZEOF_RECORD < 0) || (RKH_CFG_TRC_SIZEOF_RECORD > 64))
+    #error "RKH_CFG_TRC_SIZEOF_RECORD       illegally #define'd in 'rkhcfg.h'"
+    #error  "                               [MUST be >=  0]                   "
+    #error  "                               [     && <= 64]                   "
+    #endif
+    #endif
+
+    #ifdef RKH_CFG_TRC_COMPACT_EN
+    #if ((RKH_CFG_TRC_COMPACT_EN != RKH_ENABLED) && \
+         (RKH_CFG_TRC_COMPACT_EN != RKH_DISABLED))
+    #error "RKH_CFG_TRC_COMPACT_EN          illegally #define'd in 'rkhcfg.h'"
+    #error "                                    [MUST be  RKH_ENABLED ]       "
+    #error "                                    [     ||  RKH_DISABLED]       "
+    #elif ((RKH_CFG_TRC_COMPACT_EN == RKH_ENABLED) && \
+           (RKH_CFG_TRC_TSTAMP_EN == RKH_DISABLED))
+    #error "RKH_CFG_TRC_COMPACT_EN          illegally #define'd in 'rkhcfg.h'"
+    #error  "                               [MUST be disabled without ]       "
+    #error  "                               [the trace timestamp      ]       "
+    #elif ((RKH_CFG_TRC_COMPACT_EN == RKH_ENABLED) && \
+           ((RKH_CFG_TRC_MAX_RINGS > 0) || \
+            (RKH_CFG_TRC_DEFERRED_EN == RKH_ENABLED)))
+    #error "RKH_CFG_TRC_COMPACT_EN          illegally #define'd in 'rkhcfg.h'"
+    #error  "                               [MUST be disabled when the]       "
+    #error  "                               [trace rings are used     ]       "
+    #endif
+    #endif
+
+    #ifdef RKH_CFG_TRC_SIZEOF_SYMTBL
+    #if ((RKH_CFG_TRC_SIZEOF_SYMTBL < 4) || \
+         (RKH_CFG_TRC_SIZEOF_SYMTBL > 256) || \
+         ((RKH_CFG_TRC_SIZEOF_SYMTBL & (RKH_CFG_TRC_SIZEOF_SYMTBL - 1)) != 0))
+    #error "RKH_CFG_TRC_SIZEOF_SYMTBL       illegally #define'd in 'rkhcfg.h'"
+    #error  "                               [MUST be a power of two]          "
+    #error  "                               [     && <= 256        ]          "
+    #endif
+    #endif
+
+    #ifdef RKH_CFG_TRC_SYNC_PERIOD
+    #if ((RKH_CFG_TRC_SYNC_PERIOD < 1) || (RKH_CFG_TRC_SYNC_PERIOD > 255))
+    #error "RKH_CFG_TRC_SYNC_PERIOD         illegally #define'd in 'rkhcfg.h'"
+    #error  "                               [MUST be >=   1]                  "
+    #error  "                               [     && <= 255]                  "
+    #endif
+    #endif
+
+    #ifdef RKH_CFG_TRC_SHARED_EN
+    #if ((RKH_CFG_TRC_SHARED_EN != RKH_ENABLED) && \
+         (RKH_CFG_TRC_SHARED_EN != RKH_DISABLED))
+    #error "RKH_CFG_TRC_SHARED_EN           illegally #define'd in 'rkhcfg.h'"
+    #error "                                    [MUST be  RKH_ENABLED ]       "
+    #error "                                    [     ||  RKH_DISABLED]       "
+    #elif ((RKH_CFG_TRC_SHARED_EN == RKH_ENABLED) && \
+           ((RKH_CFG_TRC_SIZEOF_STREAM & (RKH_CFG_TRC_SIZEOF_STREAM - 1)) != 0))
+    #error "RKH_CFG_TRC_SHARED_EN           illegally #define'd in 'rkhcfg.h'"
+    #error  "                               [MUST be disabled when the]       "
+    #error  "                               [stream size is not a     ]       "
+    #error  "                               [power of two             ]       "
+    #elif ((RKH_CFG_TRC_SHARED_EN == RKH_ENABLED) && \
+           ((RKH_CFG_TRC_MAX_RINGS > 0) || \
+            (RKH_CFG_TRC_DEFERRED_EN == RKH_ENABLED)))
+    #error "RKH_CFG_TRC_SHARED_EN           illegally #define'd in 'rkhcfg.h'"
+    #error  "                               [MUST be disabled when the]       "
+    #error  "                               [trace rings are used     ]       "
+    #endif
+    #endif
+
+    #ifdef RKH_CFG_TRC_FLIGHT_EN
+    #if ((RKH_CFG_TRC_FLIGHT_EN != RKH_ENABLED) && \
+         (RKH_CFG_TRC_FLIGHT_EN != RKH_DISABLED))
+    #error "RKH_CFG_TRC_FLIGHT_EN           illegally #define'd in 'rkhcfg.h'"
+    #error "                                    [MUST be  RKH_ENABLED ]       "
+    #error "                                    [     ||  RKH_DISABLED]       "
+    #elif ((RKH_CFG_TRC_FLIGHT_EN == RKH_ENABLED) && \
+           ((RKH_CFG_TRC_MAX_RINGS > 0) || \
+            (RKH_CFG_TRC_DEFERRED_EN == RKH_ENABLED)))
+    #error "RKH_CFG_TRC_FLIGHT_EN           illegally #define'd in 'rkhcfg.h'"
+    #error  "                               [MUST be disabled when the]       "
+    #error  "                               [trace rings are used     ]       "
+    #endif
+    #endif
+
+    #ifdef RKH_CFG_TRC_SAMPLING_EN
+    #if ((RKH_CFG_TRC_SAMPLING_EN != RKH_ENABLED) && \
+         (RKH_CFG_TRC_SAMPLING_EN != RKH_DISABLED))
+    #error "RKH_CFG_TRC_SAMPLING_EN         illegally #define'd in 'rkhcfg.h'"
+    #error "                                    [MUST be  RKH_ENABLED ]       "
+    #error "                                    [     ||  RKH_DISABLED]       "
+    #elif ((RKH_CFG_TRC_SAMPLING_EN == RKH_ENABLED) && \
+           (RKH_CFG_TRC_RTFIL_EN == RKH_DISABLED))
+    #error "RKH_CFG_TRC_SAMPLING_EN         illegally #define'd in 'rkhcfg.h'"
+    #error  "                               [MUST be disabled without ]       "
+    #error  "                               [the runtime filters      ]       "
+    #endif
+    #endif
+
+    #ifdef RKH_CFG_TRC_RTFIL_FAST_EN
+    #if ((RKH_CFG_TRC_RTFIL_FAST_EN != RKH_ENABLED) && \
+         (RKH_CFG_TRC_RTFIL_FAST_EN != RKH_DISABLED))
+    #error "RKH_CFG_TRC_RTFIL_FAST_EN       illegally #define'd in 'rkhcfg.h'"
+    #error "                                    [MUST be  RKH_ENABLED ]       "
+    #error "                                    [     ||  RKH_DISABLED]       "
+    #elif ((RKH_CFG_TRC_RTFIL_FAST_EN == RKH_ENABLED) && \
+           (RKH_CFG_TRC_RTFIL_EN == RKH_DISABLED))
+    #error "RKH_CFG_TRC_RTFIL_FAST_EN       illegally #define'd in 'rkhcfg.h'"
+    #error  "                               [MUST be disabled without ]       "
+    #error  "                               [the runtime filters      ]       "
+    #endif
+    #endif
+
+    #ifdef RKH_CFG_TRC_MAX_SAMPLERS
+    #if ((RKH_CFG_TRC_MAX_SAMPLERS < 1) || (RKH_CFG_TRC_MAX_SAMPLERS > 255))
+    #error "RKH_CFG_TRC_MAX_SAMPLERS        illegally #define'd in 'rkhcfg.h'"
+    #error  "                               [MUST be >=   1]                  "
+    #error  "                               [     && <= 255]                  "
+    #endif
     #endif
 
 #endif
@@ -1244,12 +1394,12 @@ extern "C" {
 #ifndef RKH_CFG_FWK_MAX_SMA
     #error "RKH_CFG_FWK_MAX_SMA                   not #define'd in 'rkhcfg.h'"
     #error  "                               [MUST be >=  1]                   "
-    #error  "                               [     && <= 64]                   "
+    #error  "                               [     && <= 256]                  "
 
-#elif ((RKH_CFG_FWK_MAX_SMA == 0) || (RKH_CFG_FWK_MAX_SMA > 64))
+#elif ((RKH_CFG_FWK_MAX_SMA == 0) || (RKH_CFG_FWK_MAX_SMA > 256))
     #error "RKH_CFG_FWK_MAX_SMA             illegally #define'd in 'rkhcfg.h'"
     #error  "                               [MUST be >=  1]                   "
-    #error  "                               [     && <= 64]                   "
+    #error  "                               [     && <= 256]                  "
 
 #endif
 
@@ -1467,6 +1617,92 @@ extern "C" {
 #endif
 #endif
 
+#ifdef RKH_CFG_FWK_MAX_SUBS_SIGNALS
+#if ((RKH_CFG_FWK_MAX_SUBS_SIGNALS < 0) || \
+     (RKH_CFG_FWK_MAX_SUBS_SIGNALS > 1024))
+    #error "RKH_CFG_FWK_MAX_SUBS_SIGNALS    illegally #define'd in 'rkhcfg.h'"
+    #error "                                    [MUST be >= 0]                "
+    #error "                                    [     && <= 1024]             "
+#endif
+#endif
+
+#ifdef RKH_CFG_HOOK_POST_EN
+#if ((RKH_CFG_HOOK_POST_EN != RKH_ENABLED) && \
+     (RKH_CFG_HOOK_POST_EN != RKH_DISABLED))
+    #error "RKH_CFG_HOOK_POST_EN            illegally #define'd in 'rkhcfg.h'"
+    #error "                                    [MUST be  RKH_ENABLED ]       "
+    #error "                                    [     ||  RKH_DISABLED]       "
+#endif
+#endif
+
+#ifdef RKH_CFG_FWK_PUBSUB_FILTER_EN
+#if ((RKH_CFG_FWK_PUBSUB_FILTER_EN != RKH_ENABLED) && \
+     (RKH_CFG_FWK_PUBSUB_FILTER_EN != RKH_DISABLED))
+    #error "RKH_CFG_FWK_PUBSUB_FILTER_EN    illegally #define'd in 'rkhcfg.h'"
+    #error "                                    [MUST be  RKH_ENABLED ]       "
+    #error "                                    [     ||  RKH_DISABLED]       "
+#endif
+#endif
+
+#ifdef RKH_CFG_FWK_SIZEOF_RDYGRP_WORD
+#if ((RKH_CFG_FWK_SIZEOF_RDYGRP_WORD != 8) && \
+     (RKH_CFG_FWK_SIZEOF_RDYGRP_WORD != 16) && \
+     (RKH_CFG_FWK_SIZEOF_RDYGRP_WORD != 32))
+    #error "RKH_CFG_FWK_SIZEOF_RDYGRP_WORD  illegally #define'd in 'rkhcfg.h'"
+    #error "                                    [MUST be  8 ]                 "
+    #error "                                    [     || 16 ]                 "
+    #error "                                    [     || 32 ]                 "
+#endif
+#endif
+
+#ifdef RKH_CFG_FWK_SCHED_FAIR_EN
+#if ((RKH_CFG_FWK_SCHED_FAIR_EN != RKH_ENABLED) && \
+     (RKH_CFG_FWK_SCHED_FAIR_EN != RKH_DISABLED))
+    #error "RKH_CFG_FWK_SCHED_FAIR_EN       illegally #define'd in 'rkhcfg.h'"
+    #error "                                    [MUST be  RKH_ENABLED ]       "
+    #error "                                    [     ||  RKH_DISABLED]       "
+#endif
+#endif
+
+#ifdef RKH_CFG_FWK_SCHED_BURST
+#if ((RKH_CFG_FWK_SCHED_BURST < 1) || (RKH_CFG_FWK_SCHED_BURST > 255))
+    #error "RKH_CFG_FWK_SCHED_BURST         illegally #define'd in 'rkhcfg.h'"
+    #error "                                    [MUST be >= 1]                "
+    #error "                                    [     && <= 255]              "
+#endif
+#endif
+
+#ifdef RKH_CFG_FWK_SCHED_RR_GROUP
+#if ((RKH_CFG_FWK_SCHED_RR_GROUP < 1) || \
+     (RKH_CFG_FWK_SCHED_RR_GROUP > RKH_CFG_FWK_MAX_SMA))
+    #error "RKH_CFG_FWK_SCHED_RR_GROUP      illegally #define'd in 'rkhcfg.h'"
+    #error "                                    [MUST be >= 1]                "
+    #error "                                    [     && <= MAX_SMA]          "
+#endif
+#endif
+
+#ifdef RKH_CFG_SMA_EDF_EN
+#if ((RKH_CFG_SMA_EDF_EN != RKH_ENABLED) && \
+     (RKH_CFG_SMA_EDF_EN != RKH_DISABLED))
+    #error "RKH_CFG_SMA_EDF_EN              illegally #define'd in 'rkhcfg.h'"
+    #error "                                    [MUST be  RKH_ENABLED ]       "
+    #error "                                    [     ||  RKH_DISABLED]       "
+#elif ((RKH_CFG_SMA_EDF_EN == RKH_ENABLED) && \
+       ((RKH_CFG_TMR_EN == RKH_DISABLED) || \
+        (RKH_CFGPORT_NATIVE_EQUEUE_EN == RKH_DISABLED)))
+    #error "RKH_CFG_SMA_EDF_EN              illegally #define'd in 'rkhcfg.h'"
+    #error "                                    [MUST be  RKH_DISABLED]       "
+    #error "                                    [when RKH_CFG_TMR_EN or]      "
+    #error "                                    [the native queue are ]       "
+    #error "                                    [disabled             ]       "
+#elif ((RKH_CFG_SMA_EDF_EN == RKH_ENABLED) && (RKH_CFG_FWK_MAX_SMA > 255))
+    #error "RKH_CFG_FWK_MAX_SMA             illegally #define'd in 'rkhcfg.h'"
+    #error "                                    [MUST be <= 255 when  ]       "
+    #error "                                    [RKH_CFG_SMA_EDF_EN is]       "
+    #error "                                    [enabled              ]       "
+#endif
+#endif
+
 /*  PORT          --------------------------------------------------------- */
 #ifndef RKH_CFGPORT_SMA_THREAD_EN
     #error "RKH_CFGPORT_SMA_THREAD_EN            not #define'd in 'rkhport.h'"
@@ -63,6 +63,8 @@
     #include "..\..\portable\80x86\win32_mt\vc\rkhport.h"
 #elif defined(__LNXGNU__)
     #include "../../portable/80x86/linux_st/gnu/rkhport.h"
+#elif defined(__LNXMTGNU__)
+    #include "../../portable/80x86/linux_mt/gnu/rkhport.h"
 #elif defined(__S08CW63__)
     #include "..\..\portable\s08\rkhs\cw6_3\rkhport.h"
 #elif defined(__CFV1CW63__)
@@ -64,6 +64,8 @@
     #include "..\..\portable\80x86\win32_mt\vc\rkht.h"
 #elif defined(__LNXGNU__)
     #include "../../portable/80x86/linux_st/gnu/rkht.h"
+#elif defined(__LNXMTGNU__)
+    #include "../../portable/80x86/linux_mt/gnu/rkht.h"
 #elif defined(__S08CW63__)
     #include "..\..\portable\s08\rkhs\cw6_3\rkht.h"
 #elif defined(__CFV1CW63__)
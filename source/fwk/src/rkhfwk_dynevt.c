@@ -67,6 +67,8 @@ struct RKHEvtPoolMgr
 {
     RKH_ES_T blockSize;
     RKHEvtPool *evtPool;
+    void *sstart;
+    rui32_t ssize;
 };
 
 /* ---------------------------- Global variables --------------------------- */
@@ -163,11 +165,26 @@ rkh_fwk_registerEvtPool(void *sstart, rui32_t ssize, RKH_ES_T esize)
     ep = rkh_evtPool_getPool(sstart, (rui16_t)ssize, esize);
     RKH_ENSURE(ep != (RKHEvtPool *)0);
     evtPools[nextFreeEvtPool].evtPool = ep;
+    evtPools[nextFreeEvtPool].sstart = sstart;
+    evtPools[nextFreeEvtPool].ssize = ssize;
     ++nextFreeEvtPool;
     RKH_TR_FWK_EPREG(nextFreeEvtPool, ssize, esize, 
                      rkh_evtPool_getNumBlock(ep));
 }
 
+rbool_t
+rkh_fwk_getEvtPoolStorage(rui8_t index, void **sstart, rui32_t *ssize)
+{
+    RKH_REQUIRE((sstart != (void **)0) && (ssize != (rui32_t *)0));
+    if (index >= nextFreeEvtPool)
+    {
+        return RKH_FALSE;
+    }
+    *sstart = evtPools[index].sstart;
+    *ssize = evtPools[index].ssize;
+    return RKH_TRUE;
+}
+
 void
 rkh_dynEvt_init(void)
 {
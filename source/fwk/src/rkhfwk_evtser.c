@@ -0,0 +1,336 @@
+/*
+ *  --------------------------------------------------------------------------
+ *
+ *                                Framework RKH
+ *                                -------------
+ *
+ *            State-machine framework for reactive embedded systems
+ *
+ *                      Copyright (C) 2010 Leandro Francucci.
+ *          All rights reserved. Protected by international copyright laws.
+ *
+ *
+ *  RKH is free software: you can redistribute it and/or modify it under the
+ *  terms of the GNU General Public License as published by the Free Software
+ *  Foundation, either version 3 of the License, or (at your option) any
+ *  later version.
+ *
+ *  RKH is distributed in the hope that it will be useful, but WITHOUT ANY
+ *  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with RKH, see copying.txt file.
+ *
+ *  Contact information:
+ *  RKH site: http://vortexmakes.com/que-es/
+ *  RKH GitHub: https://github.com/vortexmakes/RKH
+ *  RKH Sourceforge: https://sourceforge.net/projects/rkh-reactivesys/
+ *  e-mail: lf@vortexmakes.com
+ *  ---------------------------------------------------------------------------
+ */
+
+
+/**
+ *  \file       rkhfwk_evtser.c
+ *  \ingroup    fwk
+ *  \brief      Implements the descriptor-based event serialization.
+ */
+
+/* -------------------------- Development history -------------------------- */
+/*
+ *  2026.10.19  LeFr  v3.4.00  Initial version
+ */
+
+/* -------------------------------- Authors -------------------------------- */
+/*
+ *  LeFr  Leandro Francucci  lf@vortexmakes.com
+ */
+
+/* --------------------------------- Notes --------------------------------- */
+/* ----------------------------- Include files ----------------------------- */
+#include <string.h>
+#include "rkhfwk_evtser.h"
+#include "rkhassert.h"
+#include "rkhevt.h"
+
+#if RKH_CFG_FWK_MAX_SER_SIGNALS > 0
+
+RKH_MODULE_NAME(rkhfwk_evtser)
+
+/* ----------------------------- Local macros ------------------------------ */
+#define isInteger(field_) \
+    ((field_)->kind != RKH_SER_RAW)
+
+/* ------------------------------- Constants ------------------------------- */
+/* ---------------------------- Local data types --------------------------- */
+/* ---------------------------- Global variables --------------------------- */
+/* ---------------------------- Local variables ---------------------------- */
+static const RKHSerLayout *layouts[RKH_CFG_FWK_MAX_SER_SIGNALS];
+
+/* ----------------------- Local function prototypes ----------------------- */
+/* ---------------------------- Local functions ---------------------------- */
+static rbool_t
+isHostBigEndian(void)
+{
+    static const rui16_t probe = 1;
+
+    return (*(const rui8_t *)&probe == 0) ? RKH_TRUE : RKH_FALSE;
+}
+
+/*
+ *  Copies an item of a field. The bytes of an integer are reversed if the 
+ *  byte order of the wire differs from the host one.
+ */
+static void
+copyItem(rui8_t *dst, const rui8_t *src, rui16_t size, rui8_t kind)
+{
+    rui16_t i;
+
+    if ((kind == RKH_SER_RAW) || 
+        ((kind == RKH_SER_BE) == isHostBigEndian()))
+    {
+        memcpy(dst, src, size);
+    }
+    else
+    {
+        for (i = 0; i < size; ++i)
+        {
+            dst[i] = src[size - 1 - i];
+        }
+    }
+}
+
+static rbool_t
+isValidField(const RKHSerField *field, RKH_ES_T evtSize, rui16_t count)
+{
+    if (isInteger(field) && (field->size != 1) && (field->size != 2) && 
+        (field->size != 4) && (field->size != 8))
+    {
+        return RKH_FALSE;
+    }
+    return ((field->offset >= sizeof(RKH_EVT_T)) && (field->size != 0) &&
+            (((rui32_t)field->offset + (rui32_t)field->size * count) <= 
+             evtSize)) ? RKH_TRUE : RKH_FALSE;
+}
+
+/* The count field is an integer in host byte order */
+static rui32_t
+getCount(const RKH_EVT_T *e, const RKHSerLayout *layout)
+{
+    const RKHSerField *field;
+    const rui8_t *p;
+    rui8_t u8;
+    rui16_t u16;
+    rui32_t u32;
+    unsigned long long u64;
+
+    field = &layout->fields[layout->tail->countField];
+    p = (const rui8_t *)e + field->offset;
+    switch (field->size)
+    {
+        case 1:
+            memcpy(&u8, p, 1);
+            return u8;
+        case 2:
+            memcpy(&u16, p, 2);
+            return u16;
+        case 4:
+            memcpy(&u32, p, 4);
+            return u32;
+        default:
+            memcpy(&u64, p, 8);
+            return (u64 > 0xffffffffu) ? 0xffffffffu : (rui32_t)u64;
+    }
+}
+
+static const RKHSerLayout *
+getLayout(RKH_SIG_T signal)
+{
+    return (signal < RKH_CFG_FWK_MAX_SER_SIGNALS) ? layouts[signal] : 
+                                                     (const RKHSerLayout *)0;
+}
+
+/* ---------------------------- Global functions --------------------------- */
+void
+rkh_evtser_init(void)
+{
+    memset(layouts, 0, sizeof(layouts));
+}
+
+void
+rkh_evtser_register(RKH_SIG_T signal, const RKHSerLayout *layout)
+{
+    rui8_t i;
+
+    RKH_REQUIRE(signal < RKH_CFG_FWK_MAX_SER_SIGNALS);
+    if (layout != (const RKHSerLayout *)0)
+    {
+        RKH_REQUIRE((layout->evtSize >= sizeof(RKH_EVT_T)) &&
+                    ((layout->nFields == 0) || 
+                     (layout->fields != (const RKHSerField *)0)));
+        for (i = 0; i < layout->nFields; ++i)
+        {
+            RKH_REQUIRE(isValidField(&layout->fields[i], layout->evtSize, 1));
+        }
+        if (layout->tail != (const RKHSerTail *)0)
+        {
+            RKH_REQUIRE((layout->tail->countField < layout->nFields) &&
+                isInteger(&layout->fields[layout->tail->countField]) &&
+                isValidField(&layout->tail->elem, layout->evtSize, 
+                             layout->tail->maxCount));
+        }
+    }
+    layouts[signal] = layout;
+}
+
+RKH_ES_T
+rkh_evtser_getEvtSize(RKH_SIG_T signal)
+{
+    const RKHSerLayout *layout;
+
+    layout = getLayout(signal);
+    return (layout != (const RKHSerLayout *)0) ? layout->evtSize : 0;
+}
+
+rui32_t
+rkh_evtser_encode(const RKH_EVT_T *e, rui8_t *buf, rui32_t size)
+{
+    const RKHSerLayout *layout;
+    const RKHSerField *field;
+    const rui8_t *src;
+    rui32_t n, count, value, i;
+
+    RKH_REQUIRE((e != (const RKH_EVT_T *)0) && (buf != (rui8_t *)0));
+    layout = getLayout(e->e);
+    if (layout == (const RKHSerLayout *)0)
+    {
+        return 0;
+    }
+
+    /* Signal */
+    n = 0;
+    value = (rui32_t)e->e;
+    do
+    {
+        if (n >= size)
+        {
+            return 0;
+        }
+        buf[n++] = (rui8_t)((value & 0x7f) | ((value > 0x7f) ? 0x80 : 0));
+        value >>= 7;
+    }
+    while (value != 0);
+
+    /* Fields */
+    src = (const rui8_t *)e;
+    for (i = 0, field = layout->fields; i < layout->nFields; ++i, ++field)
+    {
+        if ((n + field->size) > size)
+        {
+            return 0;
+        }
+        copyItem(&buf[n], src + field->offset, field->size, field->kind);
+        n += field->size;
+    }
+
+    /* Tail */
+    if (layout->tail != (const RKHSerTail *)0)
+    {
+        field = &layout->tail->elem;
+        count = getCount(e, layout);
+        if ((count > layout->tail->maxCount) || 
+            ((n + count * field->size) > size))
+        {
+            return 0;
+        }
+        for (i = 0; i < count; ++i)
+        {
+            copyItem(&buf[n], src + field->offset + i * field->size, 
+                     field->size, field->kind);
+            n += field->size;
+        }
+    }
+    return n;
+}
+
+rui32_t
+rkh_evtser_getSig(const rui8_t *buf, rui32_t size, RKH_SIG_T *signal)
+{
+    rui32_t n, value;
+    rui8_t shift;
+
+    RKH_REQUIRE((buf != (const rui8_t *)0) && 
+                (signal != (RKH_SIG_T *)0));
+    for (n = 0, value = 0, shift = 0; n < size; shift += 7)
+    {
+        if (shift > 28)
+        {
+            return 0;
+        }
+        value |= (rui32_t)(buf[n] & 0x7f) << shift;
+        if ((buf[n++] & 0x80) == 0)
+        {
+            *signal = (RKH_SIG_T)value;
+            return ((rui32_t)*signal == value) ? n : 0;
+        }
+    }
+    return 0;
+}
+
+rui32_t
+rkh_evtser_decode(const rui8_t *buf, rui32_t size, RKH_EVT_T *e)
+{
+    const RKHSerLayout *layout;
+    const RKHSerField *field;
+    RKH_SIG_T signal;
+    rui8_t *dst;
+    rui32_t n, count, i;
+
+    RKH_REQUIRE(e != (RKH_EVT_T *)0);
+    n = rkh_evtser_getSig(buf, size, &signal);
+    if (n == 0)
+    {
+        return 0;
+    }
+    layout = getLayout(signal);
+    if (layout == (const RKHSerLayout *)0)
+    {
+        return 0;
+    }
+
+    dst = (rui8_t *)e;
+    for (i = 0, field = layout->fields; i < layout->nFields; ++i, ++field)
+    {
+        if ((n + field->size) > size)
+        {
+            return 0;
+        }
+        copyItem(dst + field->offset, &buf[n], field->size, field->kind);
+        n += field->size;
+    }
+
+    if (layout->tail != (const RKHSerTail *)0)
+    {
+        field = &layout->tail->elem;
+        count = getCount(e, layout);
+        if ((count > layout->tail->maxCount) || 
+            ((n + count * field->size) > size))
+        {
+            return 0;
+        }
+        for (i = 0; i < count; ++i)
+        {
+            copyItem(dst + field->offset + i * field->size, &buf[n], 
+                     field->size, field->kind);
+            n += field->size;
+        }
+    }
+    e->e = signal;
+    return n;
+}
+
+#endif
+
+/* ------------------------------ End of file ------------------------------ */
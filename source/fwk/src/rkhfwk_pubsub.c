@@ -80,12 +80,23 @@
 RKH_MODULE_NAME(rkhfwk_pubsub)
 
 /* ----------------------------- Local macros ------------------------------ */
+#if RKH_CFG_FWK_PUBSUB_FILTER_EN == RKH_DISABLED
+    #define isAccepted(prio_, event_)   1
+#endif
+
 /* ------------------------------- Constants ------------------------------- */
 /* ---------------------------- Local data types --------------------------- */
 typedef struct PubSub PubSub;
 struct PubSub
 {
     RKHRdyGrp channels[RKH_CFG_FWK_MAX_SUBS_CHANNELS];
+#if RKH_CFG_FWK_MAX_SUBS_SIGNALS > 0
+    RKHRdyGrp signals[RKH_CFG_FWK_MAX_SUBS_SIGNALS];
+#endif
+#if RKH_CFG_FWK_PUBSUB_FILTER_EN == RKH_ENABLED
+    RKHPubSubFilter filters[RKH_CFG_FWK_MAX_SMA];
+    RKHPubSubFilterInfo filterInfo[RKH_CFG_FWK_MAX_SMA];
+#endif
 };
 
 typedef struct PubArg PubArg;
@@ -101,13 +112,79 @@ struct PubArg
 static PubSub observer;     /* Singleton */
 
 /* ----------------------- Local function prototypes ----------------------- */
+void publish(RdyCbArg *arg);
+
 /* ---------------------------- Local functions ---------------------------- */
+#if RKH_CFG_FWK_PUBSUB_FILTER_EN == RKH_ENABLED
+static rbool_t
+isAccepted(rui8_t prio, const RKH_EVT_T *event)
+{
+    RKHPubSubFilter filter;
+    RKHPubSubFilterInfo *info;
+    rbool_t result;
+    RKH_SR_ALLOC();
+
+    filter = observer.filters[prio];
+    if (filter == (RKHPubSubFilter)0)
+    {
+        return 1;
+    }
+
+    result = (*filter)(RKH_GET_SMA(prio), event);
+    info = &observer.filterInfo[prio];
+    RKH_ENTER_CRITICAL_();
+    if (result != 0)
+    {
+        ++info->nPassed;
+    }
+    else
+    {
+        ++info->nRejected;
+    }
+    RKH_EXIT_CRITICAL_();
+    return result;
+}
+#endif
+
+static rui16_t
+publishTo(RKHRdyGrp *const channel, RKH_EVT_T *event, 
+          const void *const sender)
+{
+    rui16_t nRdyAo;
+    PubArg publishArg;
+    RKHRdyGrp subscribers;
+    RKH_SR_ALLOC();
+
+    publishArg.event = event;
+    publishArg.sender = sender;
+
+    /* 
+     * The extra reference keeps the event alive along the fan-out, so that 
+     * a subscriber that consumes it earlier can not recycle it. 
+     */
+    RKH_ENTER_CRITICAL_();
+    subscribers = *channel;
+    RKH_INC_REF(event);
+    RKH_EXIT_CRITICAL_();
+
+    nRdyAo = rkh_rdygrp_traverse(&subscribers, publish, 
+                                 (RdyCbArg *)&publishArg);
+    RKH_FWK_GC(event, sender);
+    return nRdyAo;
+}
+
 /* ---------------------------- Global functions --------------------------- */
 void 
 rkh_pubsub_init(void)
 {
     RKHRdyGrp *pCh;
     rui8_t nCh;
+#if RKH_CFG_FWK_MAX_SUBS_SIGNALS > 0
+    rui16_t nSig;
+#endif
+#if RKH_CFG_FWK_PUBSUB_FILTER_EN == RKH_ENABLED
+    rui16_t nAo;
+#endif
 
     for (pCh = observer.channels, nCh = 0; 
          nCh < RKH_CFG_FWK_MAX_SUBS_CHANNELS; 
@@ -115,6 +192,22 @@ rkh_pubsub_init(void)
     {
         rkh_rdygrp_init(pCh);
     }
+#if RKH_CFG_FWK_MAX_SUBS_SIGNALS > 0
+    for (pCh = observer.signals, nSig = 0; 
+         nSig < RKH_CFG_FWK_MAX_SUBS_SIGNALS; 
+         ++nSig, ++pCh)
+    {
+        rkh_rdygrp_init(pCh);
+    }
+#endif
+#if RKH_CFG_FWK_PUBSUB_FILTER_EN == RKH_ENABLED
+    for (nAo = 0; nAo < RKH_CFG_FWK_MAX_SMA; ++nAo)
+    {
+        observer.filters[nAo] = (RKHPubSubFilter)0;
+        observer.filterInfo[nAo].nPassed = 0;
+        observer.filterInfo[nAo].nRejected = 0;
+    }
+#endif
 }
 
 void
@@ -141,11 +234,40 @@ rkh_pubsub_unsubscribe(rui8_t channel, const RKH_SMA_T *ao)
     RKH_EXIT_CRITICAL_();
 }
 
+#if RKH_CFG_FWK_MAX_SUBS_SIGNALS > 0
+void
+rkh_pubsub_subscribeSig(RKH_SIG_T signal, const RKH_SMA_T *ao)
+{
+    RKH_SR_ALLOC();
+
+    RKH_REQUIRE((ao != (const RKH_SMA_T *)0) && 
+                (signal < RKH_CFG_FWK_MAX_SUBS_SIGNALS));
+    RKH_ENTER_CRITICAL_();
+    rkh_rdygrp_setReady(&observer.signals[signal], RKH_GET_PRIO(ao));
+    RKH_EXIT_CRITICAL_();
+}
+
+void
+rkh_pubsub_unsubscribeSig(RKH_SIG_T signal, const RKH_SMA_T *ao)
+{
+    RKH_SR_ALLOC();
+
+    RKH_REQUIRE((ao != (const RKH_SMA_T *)0) && 
+                (signal < RKH_CFG_FWK_MAX_SUBS_SIGNALS));
+    RKH_ENTER_CRITICAL_();
+    rkh_rdygrp_setUnready(&observer.signals[signal], RKH_GET_PRIO(ao));
+    RKH_EXIT_CRITICAL_();
+}
+#endif
+
 void 
 rkh_pubsub_unsubscribeAll(const RKH_SMA_T *ao)
 {
     RKHRdyGrp *pCh;
     rui8_t nCh;
+#if RKH_CFG_FWK_MAX_SUBS_SIGNALS > 0
+    rui16_t nSig;
+#endif
 
     RKH_SR_ALLOC();
 
@@ -157,41 +279,86 @@ rkh_pubsub_unsubscribeAll(const RKH_SMA_T *ao)
     {
         rkh_rdygrp_setUnready(pCh, RKH_GET_PRIO(ao));
     }
+#if RKH_CFG_FWK_MAX_SUBS_SIGNALS > 0
+    for (pCh = observer.signals, nSig = 0; 
+         nSig < RKH_CFG_FWK_MAX_SUBS_SIGNALS; 
+         ++nSig, ++pCh)
+    {
+        rkh_rdygrp_setUnready(pCh, RKH_GET_PRIO(ao));
+    }
+#endif
+    RKH_EXIT_CRITICAL_();
+}
+
+#if RKH_CFG_FWK_PUBSUB_FILTER_EN == RKH_ENABLED
+void
+rkh_pubsub_setFilter(const RKH_SMA_T *ao, RKHPubSubFilter filter)
+{
+    rui8_t prio;
+    RKH_SR_ALLOC();
+
+    RKH_REQUIRE(ao != (const RKH_SMA_T *)0);
+    prio = RKH_GET_PRIO(ao);
+    RKH_ENTER_CRITICAL_();
+    observer.filters[prio] = filter;
+    observer.filterInfo[prio].nPassed = 0;
+    observer.filterInfo[prio].nRejected = 0;
     RKH_EXIT_CRITICAL_();
 }
 
+void
+rkh_pubsub_getFilterInfo(const RKH_SMA_T *ao, RKHPubSubFilterInfo *info)
+{
+    RKH_SR_ALLOC();
+
+    RKH_REQUIRE((ao != (const RKH_SMA_T *)0) && 
+                (info != (RKHPubSubFilterInfo *)0));
+    RKH_ENTER_CRITICAL_();
+    *info = observer.filterInfo[RKH_GET_PRIO(ao)];
+    RKH_EXIT_CRITICAL_();
+}
+#endif
+
 void
 publish(RdyCbArg *arg)
 {
     PubArg *realArg;
+    RKH_SMA_T *ao;
 
-    RKH_REQUIRE(RKH_GET_SMA(arg->aoRdyPrio) != (const RKH_SMA_T *)0); 
+    /* 
+     * The fan-out runs outside the critical section, thus a subscriber 
+     * might have been unregistered meanwhile. It is skipped.
+     */
+    ao = RKH_GET_SMA(arg->aoRdyPrio);
+    if (ao == (RKH_SMA_T *)0)
+    {
+        return;
+    }
     realArg = (PubArg *)arg;
-    if (RKH_GET_SMA(arg->aoRdyPrio) != realArg->sender)
+    if ((ao != realArg->sender) &&
+        (isAccepted(arg->aoRdyPrio, realArg->event) != 0))
     {
-        RKH_SMA_POST_FIFO(RKH_GET_SMA(arg->aoRdyPrio), 
-                          realArg->event, realArg->sender);
+        RKH_SMA_POST_FIFO(ao, realArg->event, realArg->sender);
     }
 }
 
-rui8_t 
+rui16_t 
 rkh_pubsub_publish(rui8_t channel, RKH_EVT_T *event, 
                    const void *const sender)
 {
-    rui8_t nRdyAo;
-    PubArg publishArg;
-    RKH_SR_ALLOC();
+    RKH_REQUIRE(channel < RKH_CFG_FWK_MAX_SUBS_CHANNELS);
+    return publishTo(&observer.channels[channel], event, sender);
+}
 
-    publishArg.event = event;
-    publishArg.sender = sender;
-    RKH_ENTER_CRITICAL_();
-    RKH_INC_REF(event);
-    nRdyAo = rkh_rdygrp_traverse(&observer.channels[channel], 
-                                 publish, (RdyCbArg *)&publishArg);
-    RKH_EXIT_CRITICAL_();
-    RKH_FWK_GC(event, sender);
-    return nRdyAo;
+#if RKH_CFG_FWK_MAX_SUBS_SIGNALS > 0
+rui16_t 
+rkh_pubsub_publishSig(RKH_EVT_T *event, const void *const sender)
+{
+    RKH_REQUIRE((event != (RKH_EVT_T *)0) && 
+                (event->e < RKH_CFG_FWK_MAX_SUBS_SIGNALS));
+    return publishTo(&observer.signals[event->e], event, sender);
 }
+#endif
 
 #endif
 /* ------------------------------ End of file ------------------------------ */
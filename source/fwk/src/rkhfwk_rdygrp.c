@@ -58,84 +58,213 @@
 #include "rkhassert.h"
 #include "rkhfwk_module.h"
 
+#if RKH_CFG_FWK_MAX_SMA < 256
 RKH_MODULE_NAME(rkhfwk_rdygrp)
+#endif
 
 /* ----------------------------- Local macros ------------------------------ */
+#define RKH_RDYGRP_BIT_MASK(pos_) \
+    (RKH_RDYGRP_WORD_T)((RKH_RDYGRP_WORD_T)1 << \
+                        ((pos_) & (RKH_RDYGRP_BITS - 1u)))
+
+/* A rui8_t priority can not exceed the 256 levels of a full bitmap, */
+/* hence, the range is only checked if it holds fewer levels */
+#if RKH_CFG_FWK_MAX_SMA < 256
+    #define RKH_RDYGRP_REQUIRE_PRIO(prio_) \
+        RKH_REQUIRE((prio_) < RKH_CFG_FWK_MAX_SMA)
+#else
+    #define RKH_RDYGRP_REQUIRE_PRIO(prio_)
+#endif
+
 /* ------------------------------- Constants ------------------------------- */
+/* Index of the first word of every level into RKHRdyGrp::map[] */
+static RKHROM rui16_t levelOffset[RKH_RDYGRP_NUM_LEVELS] =
+{
+    0u
+#if RKH_RDYGRP_NUM_LEVELS == 2u
+    , 1u
+#elif RKH_RDYGRP_NUM_LEVELS == 3u
+    , 1u, 1u + RKH_RDYGRP_NUM_MIDS
+#endif
+};
+
 /* ---------------------------- Local data types --------------------------- */
 /* ---------------------------- Global variables --------------------------- */
 /* ---------------------------- Local variables ---------------------------- */
 /* ----------------------- Local function prototypes ----------------------- */
 /* ---------------------------- Local functions ---------------------------- */
+static rui8_t
+getLeastBitSetPos(RKH_RDYGRP_WORD_T word)
+{
+#if RKH_CFG_FWK_SIZEOF_RDYGRP_WORD == 8
+    return RKH_BITTBL_LSB_POS(word);
+#elif defined(__GNUC__)
+    return (rui8_t)__builtin_ctzl((unsigned long)word);
+#else
+    rui8_t pos;
+
+    for (pos = 0; (word & 0xff) == 0; word >>= 8)
+    {
+        pos += 8;
+    }
+    return (rui8_t)(pos + rkh_bittbl_getLeastBitSetPos((rui8_t)word));
+#endif
+}
+
 /* ---------------------------- Global functions --------------------------- */
 void 
 rkh_rdygrp_init(RKHRdyGrp *const me)
 {
-    rui8_t *pTbl, i;
+    RKH_RDYGRP_WORD_T *pWord;
+    rui16_t i;
 
-    me->grp = 0;
-    for (pTbl = me->tbl, i = 0; i < RKH_NUM_RDYGRP; ++i, ++pTbl)
+    for (pWord = me->map, i = 0; i < RKH_RDYGRP_NUM_WORDS; ++i, ++pWord)
     {
-        *pTbl = 0;
+        *pWord = 0;
     }
 }
 
 rbool_t 
 rkh_rdygrp_isReady(RKHRdyGrp *const me)
 {
-    return me->grp != 0;
+    return me->map[0] != 0;
 }
 
 void 
 rkh_rdygrp_setReady(RKHRdyGrp *const me, rui8_t prio)
 {
-    RKH_REQUIRE(prio < RKH_CFG_FWK_MAX_SMA);
-    me->grp |= rkh_bittbl_getBitMask(prio >> 3);
-    me->tbl[prio >> 3] |= rkh_bittbl_getBitMask(prio & 0x07);
+    RKH_RDYGRP_WORD_T *pWord, word;
+    rui16_t pos;
+    rui8_t level;
+
+    RKH_RDYGRP_REQUIRE_PRIO(prio);
+    pos = prio;
+    for (level = RKH_RDYGRP_NUM_LEVELS; level-- != 0; 
+         pos >>= RKH_RDYGRP_LOG2_BITS)
+    {
+        pWord = &me->map[levelOffset[level] + (pos >> RKH_RDYGRP_LOG2_BITS)];
+        word = *pWord;
+        *pWord = (RKH_RDYGRP_WORD_T)(word | RKH_RDYGRP_BIT_MASK(pos));
+        if (word != 0)      /* was the group already marked as ready? */
+        {
+            break;
+        }
+    }
 }
 
 void 
 rkh_rdygrp_setUnready(RKHRdyGrp *const me, rui8_t prio)
 {
-    RKH_REQUIRE(prio < RKH_CFG_FWK_MAX_SMA);
-    if ((me->tbl[prio >> 3] &= ~rkh_bittbl_getBitMask(prio & 0x07)) == 0)
+    RKH_RDYGRP_WORD_T *pWord;
+    rui16_t pos;
+    rui8_t level;
+
+    RKH_RDYGRP_REQUIRE_PRIO(prio);
+    pos = prio;
+    for (level = RKH_RDYGRP_NUM_LEVELS; level-- != 0; 
+         pos >>= RKH_RDYGRP_LOG2_BITS)
     {
-        me->grp &= ~rkh_bittbl_getBitMask(prio >> 3);
+        pWord = &me->map[levelOffset[level] + (pos >> RKH_RDYGRP_LOG2_BITS)];
+        *pWord &= (RKH_RDYGRP_WORD_T)~RKH_RDYGRP_BIT_MASK(pos);
+        if (*pWord != 0)    /* is there any other ready one in the group? */
+        {
+            break;
+        }
     }
 }
 
 rui8_t 
 rkh_rdygrp_findHighest(RKHRdyGrp *const me)
 {
-    rui8_t prio;
+    rui16_t pos;
+    rui8_t level;
 
-    prio = rkh_bittbl_getLeastBitSetPos(me->grp);
-    prio = (rui8_t)((prio << 3) +
-                    (rui8_t)rkh_bittbl_getLeastBitSetPos(me->tbl[prio]));
-    return prio;
+    for (pos = 0, level = 0; level < RKH_RDYGRP_NUM_LEVELS; ++level)
+    {
+        pos = (rui16_t)((pos << RKH_RDYGRP_LOG2_BITS) |
+                        getLeastBitSetPos(me->map[levelOffset[level] + pos]));
+    }
+    return (rui8_t)pos;
 }
 
 rui8_t 
+rkh_rdygrp_findNext(RKHRdyGrp *const me, rui8_t prio)
+{
+    RKH_RDYGRP_WORD_T word, mask;
+    rui16_t pos;
+    rui8_t level;
+
+    RKH_RDYGRP_REQUIRE_PRIO(prio);
+    pos = prio;
+    level = RKH_RDYGRP_NUM_LEVELS;
+    do      /* go up until a word has a bit set after the visited one */
+    {
+        --level;
+        mask = RKH_RDYGRP_BIT_MASK(pos);
+        word = (RKH_RDYGRP_WORD_T)
+               (me->map[levelOffset[level] + (pos >> RKH_RDYGRP_LOG2_BITS)] &
+                ~(mask | (RKH_RDYGRP_WORD_T)(mask - 1u)));
+        if (word != 0)
+        {
+            break;
+        }
+        pos >>= RKH_RDYGRP_LOG2_BITS;
+    }
+    while (level != 0);
+
+    if (word == 0)
+    {
+        return prio;
+    }
+
+    /* then go down taking the least significant bit set */
+    pos = (rui16_t)((pos & ~(RKH_RDYGRP_BITS - 1u)) | getLeastBitSetPos(word));
+    for (++level; level < RKH_RDYGRP_NUM_LEVELS; ++level)
+    {
+        pos = (rui16_t)((pos << RKH_RDYGRP_LOG2_BITS) |
+                        getLeastBitSetPos(me->map[levelOffset[level] + pos]));
+    }
+    return (rui8_t)pos;
+}
+
+rui16_t 
 rkh_rdygrp_traverse(RKHRdyGrp *const me, void (*rdyCb)(RdyCbArg *), 
                     RdyCbArg *rdyCbArg)
 {
-    rui8_t row, column, *pTbl, nBit, nRdyAO;
+    RKH_RDYGRP_WORD_T pending[RKH_RDYGRP_NUM_LEVELS];
+    rui16_t index[RKH_RDYGRP_NUM_LEVELS], pos, nRdyAO;
+    rui8_t level;
 
     nRdyAO = 0;
-    if (me->grp != 0)
+    level = 0;
+    index[0] = 0;
+    pending[0] = me->map[0];
+    for (;;)
     {
-        for (row = 0, pTbl = me->tbl; row < RKH_NUM_RDYGRP; ++pTbl, ++row)
+        if (pending[level] == 0)
         {
-            for (column = *pTbl, nBit = 0; (column != 0) && (nBit < 8); 
-                 ++nBit, column >>= 1)
+            if (level == 0)
             {
-                if ((column & 1) != 0)
-                {
-                    ++nRdyAO;
-                    rdyCbArg->aoRdyPrio = (row << 3) | nBit;
-                    (*rdyCb)(rdyCbArg);
-                }
+                break;
             }
+            --level;        /* this group is done, go back to its parent */
+            continue;
+        }
+
+        pos = (rui16_t)((index[level] << RKH_RDYGRP_LOG2_BITS) |
+                        getLeastBitSetPos(pending[level]));
+        pending[level] &= (RKH_RDYGRP_WORD_T)(pending[level] - 1);
+        if (level == (RKH_RDYGRP_NUM_LEVELS - 1u))
+        {
+            ++nRdyAO;
+            rdyCbArg->aoRdyPrio = (rui8_t)pos;
+            (*rdyCb)(rdyCbArg);
+        }
+        else
+        {
+            ++level;        /* go down into the non-empty group */
+            index[level] = pos;
+            pending[level] = me->map[levelOffset[level] + pos];
         }
     }
     return nRdyAO;
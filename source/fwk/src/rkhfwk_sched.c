@@ -62,21 +62,134 @@
 #include "rkhfwk_dynevt.h"
 #include "rkhfwk_hook.h"
 #include "rkhsm.h"
+#include "rkhassert.h"
 
 #if (RKH_CFGPORT_NATIVE_SCHEDULER_EN == RKH_ENABLED)
 
 RKH_MODULE_NAME(rkhfwk_sched)
 
 /* ----------------------------- Local macros ------------------------------ */
+#if ((RKH_CFG_SMA_GET_INFO_EN == RKH_ENABLED) && \
+     (RKH_CFG_FWK_SCHED_FAIR_EN == RKH_ENABLED))
+    #define INFO_DISPATCH(sma_)     ++(sma_)->sinfo.ndpolicy[policy]
+#else
+    #define INFO_DISPATCH(sma_)     (void)0
+#endif
+
+#if RKH_CFG_FWK_SCHED_FAIR_EN == RKH_ENABLED
+    #define RR_NUM_GROUPS \
+        ((RKH_CFG_FWK_MAX_SMA + RKH_CFG_FWK_SCHED_RR_GROUP - 1u) / \
+         RKH_CFG_FWK_SCHED_RR_GROUP)
+    #define IS_READY(prio_) \
+        ((rkh_sptbl[(prio_)] != (RKH_SMA_T *)0) && \
+         (rkh_sptbl[(prio_)]->equeue.qty != 0))
+#else
+    #define schedule()  rkh_sptbl[rkh_smaPrio_findHighest()]
+#endif
+
 /* ------------------------------- Constants ------------------------------- */
 /* ---------------------------- Local data types --------------------------- */
 /* ---------------------------- Global variables --------------------------- */
 /* ---------------------------- Local variables ---------------------------- */
+#if RKH_CFG_FWK_SCHED_FAIR_EN == RKH_ENABLED
+static rui8_t policy;
+static rui8_t quota[RKH_CFG_FWK_MAX_SMA];
+static RKH_SMA_T *burstAo;          /* active object running a burst */
+static rui8_t burstLeft;            /* events left to its quota */
+static rui8_t rrLast[RR_NUM_GROUPS];    /* last one served in the group */
+#endif
+
 /* ----------------------- Local function prototypes ----------------------- */
 /* ---------------------------- Local functions ---------------------------- */
+#if RKH_CFG_FWK_SCHED_FAIR_EN == RKH_ENABLED
+static rui8_t
+findHighestBut(rui8_t prio)
+{
+    rui8_t highest;
+
+    highest = rkh_smaPrio_findHighest();
+    return (highest != prio) ? highest : rkh_smaPrio_findNext(prio);
+}
+
+static rui8_t
+findNextInGroup(rui8_t prio)
+{
+    rui16_t group, first, offset, i;
+
+    group = (rui16_t)(prio / RKH_CFG_FWK_SCHED_RR_GROUP);
+    first = (rui16_t)(group * RKH_CFG_FWK_SCHED_RR_GROUP);
+    offset = rrLast[group];
+    for (i = 0; i < RKH_CFG_FWK_SCHED_RR_GROUP; ++i)
+    {
+        offset = (rui16_t)((offset + 1u) % RKH_CFG_FWK_SCHED_RR_GROUP);
+        if (((first + offset) < RKH_CFG_FWK_MAX_SMA) && 
+            IS_READY(first + offset))
+        {
+            break;
+        }
+    }
+    rrLast[group] = (rui8_t)offset;
+    return (rui8_t)(first + offset);
+}
+
+/*
+ *  It must be called with interrupts disabled and, at least, one active 
+ *  object ready to run.
+ */
+static RKH_SMA_T *
+schedule(void)
+{
+    RKH_SMA_T *sma;
+    rui8_t prio;
+
+    switch (policy)
+    {
+        case RKH_SCHED_BURST:
+            if ((burstAo != (RKH_SMA_T *)0) && (burstAo->equeue.qty != 0))
+            {
+                if (burstLeft != 0)
+                {
+                    --burstLeft;
+                    return burstAo;
+                }
+                prio = findHighestBut(RKH_GET_PRIO(burstAo));
+            }
+            else
+            {
+                prio = rkh_smaPrio_findHighest();
+            }
+            sma = burstAo = rkh_sptbl[prio];
+            burstLeft = (rui8_t)(quota[prio] - 1u);
+            break;
+        case RKH_SCHED_RR:
+            sma = rkh_sptbl[findNextInGroup(rkh_smaPrio_findHighest())];
+            break;
+        default:
+            sma = rkh_sptbl[rkh_smaPrio_findHighest()];
+            break;
+    }
+    return sma;
+}
+#endif
+
 void 
 rkh_fwk_init(void)
 {
+#if RKH_CFG_FWK_SCHED_FAIR_EN == RKH_ENABLED
+    rui16_t i;
+
+    policy = RKH_SCHED_STRICT;
+    burstAo = (RKH_SMA_T *)0;
+    burstLeft = 0;
+    for (i = 0; i < RKH_CFG_FWK_MAX_SMA; ++i)
+    {
+        quota[i] = RKH_CFG_FWK_SCHED_BURST;
+    }
+    for (i = 0; i < RR_NUM_GROUPS; ++i)
+    {
+        rrLast[i] = (rui8_t)(RKH_CFG_FWK_SCHED_RR_GROUP - 1u);
+    }
+#endif
 }
 
 /**
@@ -105,7 +218,6 @@ rkh_fwk_init(void)
 void 
 rkh_fwk_enter(void)
 {
-    rui8_t prio;
     RKH_SMA_T *sma;
     RKH_EVT_T *e;
     RKH_SR_ALLOC();
@@ -118,12 +230,12 @@ rkh_fwk_enter(void)
         RKH_DIS_INTERRUPT();
         if (rkh_smaPrio_isReady())
         {
-            prio = rkh_smaPrio_findHighest();
-            sma = rkh_sptbl[prio];
+            sma = schedule();
             RKH_ENA_INTERRUPT();
 
             e = rkh_sma_get(sma);
             (void)RKH_SMA_DISPATCH(sma, e);
+            INFO_DISPATCH(sma);
             RKH_FWK_GC(e, sma);
         }
         else
@@ -148,6 +260,31 @@ rkh_fwk_exit(void)
     RKH_TR_FWK_EX();
 }
 
+#if RKH_CFG_FWK_SCHED_FAIR_EN == RKH_ENABLED
+void
+rkh_fwk_setSchedPolicy(rui8_t newPolicy)
+{
+    RKH_SR_ALLOC();
+
+    RKH_REQUIRE(newPolicy < RKH_SCHED_NUM_POLICIES);
+    RKH_ENTER_CRITICAL_();
+    policy = newPolicy;
+    burstAo = (RKH_SMA_T *)0;
+    RKH_EXIT_CRITICAL_();
+}
+
+void
+rkh_fwk_setBurstQuota(const RKH_SMA_T *ao, rui8_t newQuota)
+{
+    rui8_t prio;
+
+    RKH_REQUIRE(ao != (const RKH_SMA_T *)0);
+    prio = RKH_GET_PRIO(ao);
+    RKH_REQUIRE(prio < RKH_CFG_FWK_MAX_SMA);
+    quota[prio] = (newQuota != 0) ? newQuota : RKH_CFG_FWK_SCHED_BURST;
+}
+#endif
+
 #endif
 
 /* ---------------------------- Global functions --------------------------- */
@@ -147,6 +147,85 @@
  */
 #define RKH_CFG_FWK_MAX_SUBS_CHANNELS   16
 
+/**
+ *  \brief
+ *  Specify the number of signals to which an active object can subscribe 
+ *  by means of rkh_pubsub_subscribeSig(), in order to publish events by 
+ *  signal using RKH_PUBLISH(). Only signals less than this number can be 
+ *  subscribed and published. If it is zero or it is not defined, the 
+ *  signal-based subscription is not included.
+ *
+ *  \type       Integer
+ *  \range      [0..1024]
+ *  \default    0
+ */
+#define RKH_CFG_FWK_MAX_SUBS_SIGNALS    16
+
+/**
+ *  \brief
+ *  If the #RKH_CFG_FWK_PUBSUB_FILTER_EN is set to 1, subscribers can 
+ *  install a content filter by means of rkh_pubsub_setFilter(), which is 
+ *  evaluated in the context of the publisher before posting, so that 
+ *  unwanted events are never enqueued. Also, RKH counts the events 
+ *  accepted and rejected by every filter, see rkh_pubsub_getFilterInfo().
+ *
+ *  \type       Boolean
+ *  \range      
+ *  \default    RKH_DISABLED
+ */
+#define RKH_CFG_FWK_PUBSUB_FILTER_EN    RKH_ENABLED
+
+/**
+ *  \brief
+ *  Specify the number of signals which can register a serialization 
+ *  layout by means of rkh_evtser_register(), so that their events are 
+ *  encoded and decoded by rkh_evtser_encode() and rkh_evtser_decode(). 
+ *  Only signals less than this number can be registered. If it is zero or 
+ *  it is not defined, the event serialization is not included.
+ *
+ *  \type       Integer
+ *  \range      [0..1024]
+ *  \default    0
+ */
+#define RKH_CFG_FWK_MAX_SER_SIGNALS     16
+
+/**
+ *  \brief
+ *  If the #RKH_CFG_FWK_SCHED_FAIR_EN is set to 1, the native scheduler 
+ *  allows to select, by means of rkh_fwk_setSchedPolicy(), a bounded-burst 
+ *  policy (RKH_SCHED_BURST) or a round-robin one among groups of 
+ *  priorities (RKH_SCHED_RR), besides the strict priority one. Also, the 
+ *  events dispatched under every policy are counted in RKH_SMAI_T.
+ *
+ *  \type       Boolean
+ *  \range      
+ *  \default    RKH_DISABLED
+ */
+#define RKH_CFG_FWK_SCHED_FAIR_EN       RKH_ENABLED
+
+/**
+ *  \brief
+ *  Specify the default number of events that an active object dispatches 
+ *  in a row, without looking up the highest priority one, under the 
+ *  RKH_SCHED_BURST policy. See rkh_fwk_setBurstQuota().
+ *
+ *  \type       Integer
+ *  \range      [1..255]
+ *  \default    4
+ */
+#define RKH_CFG_FWK_SCHED_BURST         4
+
+/**
+ *  \brief
+ *  Specify the number of consecutive priorities which are served in 
+ *  round-robin order under the RKH_SCHED_RR policy.
+ *
+ *  \type       Integer
+ *  \range      [1..RKH_CFG_FWK_MAX_SMA]
+ *  \default    4
+ */
+#define RKH_CFG_FWK_SCHED_RR_GROUP      4
+
 /**
  *	If the #RKH_CFG_HOOK_DISPATCH_EN is set to 1, RKH will invoke the 
  *	dispatch hook function rkh_hook_dispatch() when dispatching an event to 
@@ -337,6 +337,25 @@ test_RecycleEvt(void)
     rkh_fwk_gc(&evt, (const void *)0xdead);
 }
 
+void
+test_RetrievesTheStorageOfARegisteredPool(void)
+{
+    rbool_t result;
+    void *sstart;
+    rui32_t ssize;
+
+    rkh_evtPool_getPool_ExpectAndReturn(storage, sizeof(storage), 4, 
+                                     (RKHEvtPool *)1);
+    rkh_fwk_registerEvtPool(storage, sizeof(storage), 4);
+
+    result = rkh_fwk_getEvtPoolStorage(0, &sstart, &ssize);
+    TEST_ASSERT_TRUE(result);
+    TEST_ASSERT_EQUAL_PTR(storage, sstart);
+    TEST_ASSERT_EQUAL(sizeof(storage), ssize);
+    result = rkh_fwk_getEvtPoolStorage(1, &sstart, &ssize);
+    TEST_ASSERT_FALSE(result);
+}
+
 void
 test_Fails_OnRecycleEvtNullPool(void)
 {
@@ -0,0 +1,322 @@
+/*
+ *  --------------------------------------------------------------------------
+ *
+ *                                Framework RKH
+ *                                -------------
+ *
+ *            State-machine framework for reactive embedded systems
+ *
+ *                      Copyright (C) 2010 Leandro Francucci.
+ *          All rights reserved. Protected by international copyright laws.
+ *
+ *
+ *  RKH is free software: you can redistribute it and/or modify it under the
+ *  terms of the GNU General Public License as published by the Free Software
+ *  Foundation, either version 3 of the License, or (at your option) any
+ *  later version.
+ *
+ *  RKH is distributed in the hope that it will be useful, but WITHOUT ANY
+ *  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with RKH, see copying.txt file.
+ *
+ *  Contact information:
+ *  RKH site: http://vortexmakes.com/que-es/
+ *  RKH GitHub: https://github.com/vortexmakes/RKH
+ *  RKH Sourceforge: https://sourceforge.net/projects/rkh-reactivesys/
+ *  e-mail: lf@vortexmakes.com
+ *  ---------------------------------------------------------------------------
+ */
+
+
+/**
+ *  \file       test_rkhfwk_evtser.c
+ *  \ingroup    test_fwk
+ *  \brief      Unit test for event serialization of fwk module.
+ *
+ *  \addtogroup test
+ *  @{
+ *  \addtogroup test_fwk Framework
+ *  @{
+ *  \brief      Unit test for framework module.
+ */
+
+/* -------------------------- Development history -------------------------- */
+/*
+ *  2026.10.19  LeFr  v3.4.00  Initial version
+ */
+
+/* -------------------------------- Authors -------------------------------- */
+/*
+ *  LeFr  Leandro Francucci  lf@vortexmakes.com
+ */
+
+/* --------------------------------- Notes --------------------------------- */
+/* ----------------------------- Include files ----------------------------- */
+#include <string.h>
+#include "unity.h"
+#include "rkhfwk_evtser.h"
+#include "Mock_rkhassert.h"
+
+/* ----------------------------- Local macros ------------------------------ */
+/* ------------------------------- Constants ------------------------------- */
+enum
+{
+    SET_POINT, FRAME
+};
+
+/* ---------------------------- Local data types --------------------------- */
+typedef struct SetPointEvt SetPointEvt;
+struct SetPointEvt
+{
+    RKH_EVT_T evt;
+    rui16_t value;
+    rui16_t id;
+    char unit[3];
+};
+
+typedef struct FrameEvt FrameEvt;
+struct FrameEvt
+{
+    RKH_EVT_T evt;
+    rui8_t len;
+    rui16_t data[4];
+};
+
+/* ---------------------------- Global variables --------------------------- */
+int GlobalExpectCount;
+int GlobalVerifyOrder;
+char *GlobalOrderError;
+
+/* ---------------------------- Local variables ---------------------------- */
+static const RKHSerField setPointFields[] =
+{
+    RKH_SER_FIELD(SetPointEvt, value, RKH_SER_BE),
+    RKH_SER_FIELD(SetPointEvt, id, RKH_SER_LE),
+    RKH_SER_FIELD(SetPointEvt, unit, RKH_SER_RAW)
+};
+
+static const RKHSerLayout setPointLayout =
+{
+    sizeof(SetPointEvt), setPointFields, 3, (const RKHSerTail *)0
+};
+
+static const RKHSerField frameFields[] =
+{
+    RKH_SER_FIELD(FrameEvt, len, RKH_SER_LE)
+};
+
+static const RKHSerTail frameTail =
+{
+    {offsetof(FrameEvt, data), sizeof(rui16_t), RKH_SER_BE}, 0, 4
+};
+
+static const RKHSerLayout frameLayout =
+{
+    sizeof(FrameEvt), frameFields, 1, &frameTail
+};
+
+static SetPointEvt setPoint;
+static FrameEvt frame;
+static rui8_t buf[32];
+
+/* ----------------------- Local function prototypes ----------------------- */
+/* ---------------------------- Local functions ---------------------------- */
+static void 
+MockAssertCallback(const char* const file, int line, int cmock_num_calls)
+{
+    TEST_PASS();
+}
+
+/* ---------------------------- Global functions --------------------------- */
+void
+setUp(void)
+{
+    Mock_rkhassert_Init();
+    rkh_evtser_init();
+    rkh_evtser_register(SET_POINT, &setPointLayout);
+    rkh_evtser_register(FRAME, &frameLayout);
+
+    memset(&setPoint, 0, sizeof(setPoint));
+    setPoint.evt.e = SET_POINT;
+    setPoint.value = 0x1234;
+    setPoint.id = 0x0102;
+    strcpy(setPoint.unit, "mV");
+
+    memset(&frame, 0, sizeof(frame));
+    frame.evt.e = FRAME;
+    frame.len = 2;
+    frame.data[0] = 0xa1b2;
+    frame.data[1] = 0xc3d4;
+    frame.data[2] = 0xdead;
+}
+
+void
+tearDown(void)
+{
+    Mock_rkhassert_Verify();
+    Mock_rkhassert_Destroy();
+}
+
+/**
+ *  \addtogroup test_evtser Test cases of event serialization group
+ *  @{
+ *  \name Test cases of event serialization group
+ *  @{ 
+ */
+void
+test_EncodeFieldsInWireByteOrder(void)
+{
+    rui8_t expected[] = 
+    {
+        SET_POINT, 0x12, 0x34, 0x02, 0x01, 'm', 'V', '\0'
+    };
+    rui32_t n;
+
+    n = rkh_evtser_encode(&setPoint.evt, buf, sizeof(buf));
+
+    TEST_ASSERT_EQUAL(sizeof(expected), n);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, buf, sizeof(expected));
+}
+
+void
+test_DecodeAnEncodedEvent(void)
+{
+    SetPointEvt decoded;
+    rui32_t n;
+
+    memset(&decoded, 0, sizeof(decoded));
+    n = rkh_evtser_encode(&setPoint.evt, buf, sizeof(buf));
+
+    TEST_ASSERT_EQUAL(n, rkh_evtser_decode(buf, n, &decoded.evt));
+    TEST_ASSERT_EQUAL(SET_POINT, decoded.evt.e);
+    TEST_ASSERT_EQUAL_HEX16(setPoint.value, decoded.value);
+    TEST_ASSERT_EQUAL_HEX16(setPoint.id, decoded.id);
+    TEST_ASSERT_EQUAL_STRING(setPoint.unit, decoded.unit);
+}
+
+void
+test_EncodeOnlyTheUsedElementsOfTail(void)
+{
+    rui8_t expected[] = {FRAME, 2, 0xa1, 0xb2, 0xc3, 0xd4};
+    FrameEvt decoded;
+    rui32_t n;
+
+    memset(&decoded, 0, sizeof(decoded));
+    n = rkh_evtser_encode(&frame.evt, buf, sizeof(buf));
+
+    TEST_ASSERT_EQUAL(sizeof(expected), n);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, buf, sizeof(expected));
+    TEST_ASSERT_EQUAL(n, rkh_evtser_decode(buf, n, &decoded.evt));
+    TEST_ASSERT_EQUAL(2, decoded.len);
+    TEST_ASSERT_EQUAL_HEX16(0xa1b2, decoded.data[0]);
+    TEST_ASSERT_EQUAL_HEX16(0xc3d4, decoded.data[1]);
+    TEST_ASSERT_EQUAL_HEX16(0, decoded.data[2]);
+}
+
+void
+test_RetrieveSignalOfEncodedEvent(void)
+{
+    rui8_t encoded[] = {0x81, 0x01};
+    RKH_SIG_T signal;
+
+    TEST_ASSERT_EQUAL(2, rkh_evtser_getSig(encoded, sizeof(encoded), 
+                                           &signal));
+    TEST_ASSERT_EQUAL(129, signal);
+    TEST_ASSERT_EQUAL(0, rkh_evtser_getSig(encoded, 1, &signal));
+    TEST_ASSERT_EQUAL(sizeof(SetPointEvt), rkh_evtser_getEvtSize(SET_POINT));
+    TEST_ASSERT_EQUAL(0, rkh_evtser_getEvtSize(FRAME + 1));
+}
+
+void
+test_Fails_EncodeIntoSmallBuffer(void)
+{
+    TEST_ASSERT_EQUAL(0, rkh_evtser_encode(&setPoint.evt, buf, 7));
+    TEST_ASSERT_EQUAL(0, rkh_evtser_encode(&frame.evt, buf, 5));
+}
+
+void
+test_Fails_DecodeTruncatedEvent(void)
+{
+    SetPointEvt decoded;
+    rui32_t n;
+
+    n = rkh_evtser_encode(&setPoint.evt, buf, sizeof(buf));
+
+    TEST_ASSERT_EQUAL(0, rkh_evtser_decode(buf, n - 1, &decoded.evt));
+}
+
+void
+test_Fails_DecodeMalformedSignal(void)
+{
+    SetPointEvt decoded;
+    rui8_t encoded[] = {0x80, 0x80};
+
+    TEST_ASSERT_EQUAL(0, rkh_evtser_decode(encoded, sizeof(encoded), 
+                                           &decoded.evt));
+    TEST_ASSERT_EQUAL(0, rkh_evtser_decode(encoded, 0, &decoded.evt));
+}
+
+void
+test_Fails_TailLongerThanItsCapacity(void)
+{
+    FrameEvt decoded;
+    rui8_t encoded[] = {FRAME, 5, 0, 1, 0, 2, 0, 3, 0, 4, 0, 5};
+
+    frame.len = 5;
+
+    TEST_ASSERT_EQUAL(0, rkh_evtser_encode(&frame.evt, buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL(0, rkh_evtser_decode(encoded, sizeof(encoded), 
+                                           &decoded.evt));
+}
+
+void
+test_Fails_SignalWithoutLayout(void)
+{
+    rui8_t encoded[] = {FRAME + 1, 0};
+
+    setPoint.evt.e = FRAME + 1;
+
+    TEST_ASSERT_EQUAL(0, rkh_evtser_encode(&setPoint.evt, buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL(0, rkh_evtser_decode(encoded, sizeof(encoded), 
+                                           &setPoint.evt));
+}
+
+void
+test_Fails_RegisterFieldOutOfEvent(void)
+{
+    static const RKHSerField fields[] =
+    {
+        {sizeof(SetPointEvt) - 1, 2, RKH_SER_LE}
+    };
+    static const RKHSerLayout layout =
+    {
+        sizeof(SetPointEvt), fields, 1, (const RKHSerTail *)0
+    };
+
+    rkh_assert_Expect("rkhfwk_evtser", 0);
+    rkh_assert_IgnoreArg_line();
+    rkh_assert_StubWithCallback(MockAssertCallback);
+
+    rkh_evtser_register(SET_POINT, &layout);
+}
+
+void
+test_Fails_RegisterInvalidSignal(void)
+{
+    rkh_assert_Expect("rkhfwk_evtser", 0);
+    rkh_assert_IgnoreArg_line();
+    rkh_assert_StubWithCallback(MockAssertCallback);
+
+    rkh_evtser_register(RKH_CFG_FWK_MAX_SER_SIGNALS, &setPointLayout);
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+
+/* ------------------------------ End of file ------------------------------ */
@@ -96,6 +96,18 @@ MockAssertCallback(const char* const file, int line, int cmock_num_calls)
     TEST_PASS();
 }
 
+static rbool_t
+rejectAll(const RKH_SMA_T *subscriber, const RKH_EVT_T *event)
+{
+    return 0;
+}
+
+static rbool_t
+acceptAll(const RKH_SMA_T *subscriber, const RKH_EVT_T *event)
+{
+    return 1;
+}
+
 /* ---------------------------- Global functions --------------------------- */
 void
 setUp(void)
@@ -188,6 +200,11 @@ test_UnsubscribeAllActiveObjects(void)
         rkh_rdygrp_setUnready_Expect(0, RKH_GET_PRIO(ao));
         rkh_rdygrp_setUnready_IgnoreArg_me();
     }
+    for (nCh = 0; nCh < RKH_CFG_FWK_MAX_SUBS_SIGNALS; ++nCh)
+    {
+        rkh_rdygrp_setUnready_Expect(0, RKH_GET_PRIO(ao));
+        rkh_rdygrp_setUnready_IgnoreArg_me();
+    }
     rkh_exit_critical_Expect();
 
     rkh_pubsub_unsubscribeAll(ao);
@@ -198,12 +215,12 @@ test_PublishOneActiveObject(void)
 {
     int me;
     RKH_EVT_T evt;
-    rui8_t nRdyAo;
+    rui16_t nRdyAo;
 
     rkh_rdygrp_init_Ignore();
     rkh_enter_critical_Expect();
-    rkh_rdygrp_traverse_ExpectAndReturn(0, 0, 0, 1);
     rkh_exit_critical_Expect();
+    rkh_rdygrp_traverse_ExpectAndReturn(0, 0, 0, 1);
     rkh_fwk_gc_Expect(&evt, &me);
     rkh_rdygrp_traverse_IgnoreArg_me();
     rkh_rdygrp_traverse_IgnoreArg_rdyCb();
@@ -214,6 +231,67 @@ test_PublishOneActiveObject(void)
     TEST_ASSERT_EQUAL(1, nRdyAo);
 }
 
+void
+test_SubscribeOneActiveObjectToSignal(void)
+{
+    rkh_rdygrp_init_Ignore();
+    rkh_enter_critical_Expect();
+    rkh_rdygrp_setReady_Expect(0, RKH_GET_PRIO(ao));
+    rkh_rdygrp_setReady_IgnoreArg_me();
+    rkh_exit_critical_Expect();
+
+    rkh_pubsub_init();
+    rkh_pubsub_subscribeSig(1, ao);
+}
+
+void
+test_UnsubscribeOneActiveObjectFromSignal(void)
+{
+    rkh_rdygrp_init_Ignore();
+    rkh_enter_critical_Expect();
+    rkh_rdygrp_setUnready_Expect(0, RKH_GET_PRIO(ao));
+    rkh_rdygrp_setUnready_IgnoreArg_me();
+    rkh_exit_critical_Expect();
+
+    rkh_pubsub_init();
+    rkh_pubsub_unsubscribeSig(1, ao);
+}
+
+void
+test_Fails_SubscribeToInvalidSignal(void)
+{
+    rkh_rdygrp_init_Ignore();
+    rkh_assert_Expect("rkhfwk_pubsub", 0);
+    rkh_assert_IgnoreArg_file();
+    rkh_assert_IgnoreArg_line();
+    rkh_assert_StubWithCallback(MockAssertCallback);
+
+    rkh_pubsub_init();
+    rkh_pubsub_subscribeSig(RKH_CFG_FWK_MAX_SUBS_SIGNALS, ao);
+}
+
+void
+test_PublishBySignal(void)
+{
+    int me;
+    RKH_EVT_T evt;
+    rui16_t nRdyAo;
+
+    evt.e = 1;
+    rkh_rdygrp_init_Ignore();
+    rkh_enter_critical_Expect();
+    rkh_exit_critical_Expect();
+    rkh_rdygrp_traverse_ExpectAndReturn(0, 0, 0, 2);
+    rkh_fwk_gc_Expect(&evt, &me);
+    rkh_rdygrp_traverse_IgnoreArg_me();
+    rkh_rdygrp_traverse_IgnoreArg_rdyCb();
+    rkh_rdygrp_traverse_IgnoreArg_rdyCbArg();
+
+    rkh_pubsub_init();
+    nRdyAo = RKH_PUBLISH(&evt, &me);
+    TEST_ASSERT_EQUAL(2, nRdyAo);
+}
+
 void
 test_InvokePublishCallbackOnPublish(void)
 {
@@ -244,6 +322,74 @@ test_IgnoreSelfPublishing(void)
     publish((RdyCbArg *)&publishArg);
 }
 
+void
+test_SkipUnregisteredSubscriber(void)
+{
+    PubArg publishArg;
+
+    rkh_sptbl[RKH_GET_PRIO(ao)] = (RKH_SMA_T *)0;
+    publishArg.base.aoRdyPrio = RKH_GET_PRIO(ao);   /* subscriber */
+    publishArg.event = &event;
+    publishArg.sender = aoSender;
+
+    publish((RdyCbArg *)&publishArg);
+}
+
+void
+test_FilterRejectsPublishedEvent(void)
+{
+    PubArg publishArg;
+    RKHPubSubFilterInfo info;
+
+    rkh_rdygrp_init_Ignore();
+    rkh_pubsub_init();
+    rkh_enter_critical_Expect();
+    rkh_exit_critical_Expect();
+    rkh_pubsub_setFilter(ao, rejectAll);
+
+    rkh_sptbl[RKH_GET_PRIO(ao)] = ao;
+    publishArg.base.aoRdyPrio = RKH_GET_PRIO(ao);   /* subscriber */
+    publishArg.event = &event;
+    publishArg.sender = aoSender;
+    rkh_enter_critical_Expect();
+    rkh_exit_critical_Expect();
+    publish((RdyCbArg *)&publishArg);
+
+    rkh_enter_critical_Expect();
+    rkh_exit_critical_Expect();
+    rkh_pubsub_getFilterInfo(ao, &info);
+    TEST_ASSERT_EQUAL(0, info.nPassed);
+    TEST_ASSERT_EQUAL(1, info.nRejected);
+}
+
+void
+test_FilterAcceptsPublishedEvent(void)
+{
+    PubArg publishArg;
+    RKHPubSubFilterInfo info;
+
+    rkh_rdygrp_init_Ignore();
+    rkh_pubsub_init();
+    rkh_enter_critical_Expect();
+    rkh_exit_critical_Expect();
+    rkh_pubsub_setFilter(ao, acceptAll);
+
+    rkh_sptbl[RKH_GET_PRIO(ao)] = ao;
+    publishArg.base.aoRdyPrio = RKH_GET_PRIO(ao);   /* subscriber */
+    publishArg.event = &event;
+    publishArg.sender = aoSender;
+    rkh_enter_critical_Expect();
+    rkh_exit_critical_Expect();
+    rkh_sma_post_fifo_Expect(ao, &event, aoSender);
+    publish((RdyCbArg *)&publishArg);
+
+    rkh_enter_critical_Expect();
+    rkh_exit_critical_Expect();
+    rkh_pubsub_getFilterInfo(ao, &info);
+    TEST_ASSERT_EQUAL(1, info.nPassed);
+    TEST_ASSERT_EQUAL(0, info.nRejected);
+}
+
 void
 test_Fails_SubscribeWithWrongArgs(void)
 {
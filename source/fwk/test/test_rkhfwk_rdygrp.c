@@ -57,36 +57,11 @@
 /* ----------------------------- Include files ----------------------------- */
 #include "unity.h"
 #include "rkhfwk_rdygrp.h"
-#include "Mock_rkhfwk_bittbl.h"
+#include "rkhfwk_bittbl.h"
 #include "Mock_rkhassert.h"
 
 /* ----------------------------- Local macros ------------------------------ */
 /* ------------------------------- Constants ------------------------------- */
-static const rui8_t bitMaskTbl[] =
-{
-    0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80
-};
-
-static const rui8_t leastBitSetTbl[] =
-{
-    0, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,     /* 0x00 to 0x0F */
-    4, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,     /* 0x10 to 0x1F */
-    5, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,     /* 0x20 to 0x2F */
-    4, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,     /* 0x30 to 0x3F */
-    6, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,     /* 0x40 to 0x4F */
-    4, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,     /* 0x50 to 0x5F */
-    5, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,     /* 0x60 to 0x6F */
-    4, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,     /* 0x70 to 0x7F */
-    7, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,     /* 0x80 to 0x8F */
-    4, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,     /* 0x90 to 0x9F */
-    5, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,     /* 0xA0 to 0xAF */
-    4, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,     /* 0xB0 to 0xBF */
-    6, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,     /* 0xC0 to 0xCF */
-    4, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,     /* 0xD0 to 0xDF */
-    5, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,     /* 0xE0 to 0xEF */
-    4, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0      /* 0xF0 to 0xFF */
-};
-
 /* ---------------------------- Local data types --------------------------- */
 typedef struct DerivedRdyCbArg DerivedRdyCbArg;
 struct DerivedRdyCbArg
@@ -119,7 +94,6 @@ rdyCb(RdyCbArg *arg)
 void
 setUp(void)
 {
-    Mock_rkhfwk_bittbl_Init();
     Mock_rkhassert_Init();
     rkh_rdygrp_init(&rdyTbl);
 }
@@ -127,8 +101,6 @@ setUp(void)
 void
 tearDown(void)
 {
-    Mock_rkhfwk_bittbl_Verify();
-    Mock_rkhfwk_bittbl_Destroy();
     Mock_rkhassert_Verify();
     Mock_rkhassert_Destroy();
 }
@@ -152,19 +124,12 @@ void
 test_SetOneActiveObjectReady(void)
 {
     rbool_t result;
-    rui8_t prio = 1, resultPrio, column, row;
-
-    column = prio >> 3;
-    row = prio & 7;
-    rkh_bittbl_getBitMask_ExpectAndReturn(column, bitMaskTbl[column]);
-    rkh_bittbl_getBitMask_ExpectAndReturn(row, bitMaskTbl[row]);
+    rui8_t prio = 1, resultPrio;
 
     rkh_rdygrp_setReady(&rdyTbl, prio);
     result = rkh_rdygrp_isReady(&rdyTbl);
     TEST_ASSERT_EQUAL(1, result);
 
-    rkh_bittbl_getLeastBitSetPos_ExpectAndReturn(1, leastBitSetTbl[1]);
-    rkh_bittbl_getLeastBitSetPos_ExpectAndReturn(2, leastBitSetTbl[2]);
     resultPrio = rkh_rdygrp_findHighest(&rdyTbl);
     TEST_ASSERT_EQUAL(prio, resultPrio);
 }
@@ -172,52 +137,36 @@ test_SetOneActiveObjectReady(void)
 void
 test_SetMultipleActiveObjectsReady(void)
 {
-    rui8_t prioA = 1, prioC = 0, prioB = 15, resultPrio, column, row;
+    rui8_t prioA = 1, prioC = 0, prioB = 15, resultPrio;
 
-    column = prioA >> 3;
-    row = prioA & 7;
-    rkh_bittbl_getBitMask_ExpectAndReturn(column, bitMaskTbl[column]);
-    rkh_bittbl_getBitMask_ExpectAndReturn(row, bitMaskTbl[row]);
     rkh_rdygrp_setReady(&rdyTbl, prioA);
-
-    column = prioB >> 3;
-    row = prioB & 7;
-    rkh_bittbl_getBitMask_ExpectAndReturn(column, bitMaskTbl[column]);
-    rkh_bittbl_getBitMask_ExpectAndReturn(row, bitMaskTbl[row]);
     rkh_rdygrp_setReady(&rdyTbl, prioB);
-
-    column = prioC >> 3;
-    row = prioC & 7;
-    rkh_bittbl_getBitMask_ExpectAndReturn(column, bitMaskTbl[column]);
-    rkh_bittbl_getBitMask_ExpectAndReturn(row, bitMaskTbl[row]);
     rkh_rdygrp_setReady(&rdyTbl, prioC);
 
-    rkh_bittbl_getLeastBitSetPos_ExpectAndReturn(3, leastBitSetTbl[3]);
-    rkh_bittbl_getLeastBitSetPos_ExpectAndReturn(3, leastBitSetTbl[3]);
     resultPrio = rkh_rdygrp_findHighest(&rdyTbl);
     TEST_ASSERT_EQUAL(prioC, resultPrio);
 }
 
+void
+test_SetLowestPriorityActiveObjectReady(void)
+{
+    rui8_t resultPrio;
+
+    rkh_rdygrp_setReady(&rdyTbl, RKH_LOWEST_PRIO);
+    resultPrio = rkh_rdygrp_findHighest(&rdyTbl);
+    TEST_ASSERT_EQUAL(RKH_LOWEST_PRIO, resultPrio);
+}
+
 void
 test_SetOneActiveObjectUnready(void)
 {
     rbool_t result;
-    rui8_t prio = 1, resultPrio, column, row;
-
-    column = prio >> 3;
-    row = prio & 7;
-    rkh_bittbl_getBitMask_ExpectAndReturn(column, bitMaskTbl[column]);
-    rkh_bittbl_getBitMask_ExpectAndReturn(row, bitMaskTbl[row]);
+    rui8_t prio = 1, resultPrio;
 
     rkh_rdygrp_setReady(&rdyTbl, prio);
-
-    rkh_bittbl_getLeastBitSetPos_ExpectAndReturn(1, leastBitSetTbl[1]);
-    rkh_bittbl_getLeastBitSetPos_ExpectAndReturn(2, leastBitSetTbl[2]);
     resultPrio = rkh_rdygrp_findHighest(&rdyTbl);
     TEST_ASSERT_EQUAL(prio, resultPrio);
 
-    rkh_bittbl_getBitMask_ExpectAndReturn(row, bitMaskTbl[row]);
-    rkh_bittbl_getBitMask_ExpectAndReturn(column, bitMaskTbl[column]);
     rkh_rdygrp_setUnready(&rdyTbl, prio);
     result = rkh_rdygrp_isReady(&rdyTbl);
     TEST_ASSERT_EQUAL(0, result);
@@ -227,47 +176,85 @@ void
 test_SetMultipleActiveObjectsUnready(void)
 {
     rbool_t result;
-    rui8_t prioA = 1, prioC = 0, prioB = 15, column, row;
+    rui8_t prioA = 1, prioC = 0, prioB = 15;
 
-    column = prioA >> 3;
-    row = prioA & 7;
-    rkh_bittbl_getBitMask_ExpectAndReturn(column, bitMaskTbl[column]);
-    rkh_bittbl_getBitMask_ExpectAndReturn(row, bitMaskTbl[row]);
     rkh_rdygrp_setReady(&rdyTbl, prioA);
-
-    column = prioB >> 3;
-    row = prioB & 7;
-    rkh_bittbl_getBitMask_ExpectAndReturn(column, bitMaskTbl[column]);
-    rkh_bittbl_getBitMask_ExpectAndReturn(row, bitMaskTbl[row]);
     rkh_rdygrp_setReady(&rdyTbl, prioB);
-
-    column = prioC >> 3;
-    row = prioC & 7;
-    rkh_bittbl_getBitMask_ExpectAndReturn(column, bitMaskTbl[column]);
-    rkh_bittbl_getBitMask_ExpectAndReturn(row, bitMaskTbl[row]);
     rkh_rdygrp_setReady(&rdyTbl, prioC);
 
-    column = prioA >> 3;
-    row = prioA & 7;
-    rkh_bittbl_getBitMask_ExpectAndReturn(row, bitMaskTbl[row]);
     rkh_rdygrp_setUnready(&rdyTbl, prioA);
-
-    column = prioB >> 3;
-    row = prioB & 7;
-    rkh_bittbl_getBitMask_ExpectAndReturn(row, bitMaskTbl[row]);
-    rkh_bittbl_getBitMask_ExpectAndReturn(column, bitMaskTbl[column]);
     rkh_rdygrp_setUnready(&rdyTbl, prioB);
-
-    column = prioC >> 3;
-    row = prioC & 7;
-    rkh_bittbl_getBitMask_ExpectAndReturn(row, bitMaskTbl[row]);
-    rkh_bittbl_getBitMask_ExpectAndReturn(column, bitMaskTbl[column]);
     rkh_rdygrp_setUnready(&rdyTbl, prioC);
 
     result = rkh_rdygrp_isReady(&rdyTbl);
     TEST_ASSERT_EQUAL(0, result);
 }
 
+void
+test_UnreadyKeepsTheRestOfGroupReady(void)
+{
+    rui8_t prioA = 8, prioB = 9, prioC = 40, resultPrio;
+
+    rkh_rdygrp_setReady(&rdyTbl, prioA);
+    rkh_rdygrp_setReady(&rdyTbl, prioB);
+    rkh_rdygrp_setReady(&rdyTbl, prioC);
+
+    rkh_rdygrp_setUnready(&rdyTbl, prioA);
+    resultPrio = rkh_rdygrp_findHighest(&rdyTbl);
+    TEST_ASSERT_EQUAL(prioB, resultPrio);
+
+    rkh_rdygrp_setUnready(&rdyTbl, prioB);
+    resultPrio = rkh_rdygrp_findHighest(&rdyTbl);
+    TEST_ASSERT_EQUAL(prioC, resultPrio);
+    TEST_ASSERT_EQUAL(1, rkh_rdygrp_isReady(&rdyTbl));
+}
+
+void
+test_FindNextReadyActiveObject(void)
+{
+    rui8_t ix, nRdyAo;
+
+    nRdyAo = (rui8_t)(sizeof(prio) / sizeof(prio[0]));
+    for (ix = 0; ix < nRdyAo; ++ix)
+    {
+        rkh_rdygrp_setReady(&rdyTbl, prio[ix]);
+    }
+
+    for (ix = 0; ix < (nRdyAo - 1); ++ix)
+    {
+        TEST_ASSERT_EQUAL(prio[ix + 1], 
+                          rkh_rdygrp_findNext(&rdyTbl, prio[ix]));
+    }
+    TEST_ASSERT_EQUAL(prio[nRdyAo - 1], 
+                      rkh_rdygrp_findNext(&rdyTbl, prio[nRdyAo - 1]));
+}
+
+void
+test_FindNextFromUnreadyActiveObject(void)
+{
+    rui8_t prioA = 9, prioB = 40;
+
+    rkh_rdygrp_setReady(&rdyTbl, prioA);
+    rkh_rdygrp_setReady(&rdyTbl, prioB);
+
+    TEST_ASSERT_EQUAL(prioA, rkh_rdygrp_findNext(&rdyTbl, 0));
+    TEST_ASSERT_EQUAL(prioB, rkh_rdygrp_findNext(&rdyTbl, prioA + 1));
+    TEST_ASSERT_EQUAL(prioB + 1, rkh_rdygrp_findNext(&rdyTbl, prioB + 1));
+}
+
+void
+test_FindNextKeepsTheReadyGroup(void)
+{
+    RKHRdyGrp copy;
+
+    rkh_rdygrp_setReady(&rdyTbl, 3);
+    rkh_rdygrp_setReady(&rdyTbl, 17);
+    copy = rdyTbl;
+
+    TEST_ASSERT_EQUAL(17, rkh_rdygrp_findNext(&rdyTbl, 3));
+    TEST_ASSERT_EQUAL_MEMORY(&copy, &rdyTbl, sizeof(RKHRdyGrp));
+}
+
 void
 test_Fails_InvalidActiveObjectOnSet(void)
 {
@@ -284,10 +271,7 @@ test_Fails_InvalidActiveObjectOnSet(void)
 void
 test_TraverseWithOneReadyActiveObject(void)
 {
-    rui8_t nRdyAo, resultNRdyAo;
-
-    rkh_bittbl_getBitMask_IgnoreAndReturn(bitMaskTbl[prio[0] >> 3]);
-    rkh_bittbl_getBitMask_IgnoreAndReturn(bitMaskTbl[prio[0] & 7]);
+    rui16_t nRdyAo, resultNRdyAo;
 
     rdyCbArg.cnt = 0;
     nRdyAo = 1;
@@ -300,14 +284,13 @@ test_TraverseWithOneReadyActiveObject(void)
 void
 test_TraverseWithMultipleReadyActiveObject(void)
 {
-    rui8_t nRdyAo, resultNRdyAo, ix;
+    rui16_t nRdyAo, resultNRdyAo;
+    rui8_t ix;
 
     nRdyAo = 9;
     for (ix = 0; ix < nRdyAo; ++ix)
     {
-        rkh_bittbl_getBitMask_IgnoreAndReturn(bitMaskTbl[prio[ix] >> 3]);
-        rkh_bittbl_getBitMask_IgnoreAndReturn(bitMaskTbl[prio[ix] & 7]);
-        rkh_rdygrp_setReady(&rdyTbl, prio[ix]);
+        rkh_rdygrp_setReady(&rdyTbl, prio[nRdyAo - 1 - ix]);
     }
 
     rdyCbArg.cnt = 0;
@@ -319,7 +302,7 @@ test_TraverseWithMultipleReadyActiveObject(void)
 void
 test_TraverseWithWithoutReadyActiveObject(void)
 {
-    rui8_t nRdyAo, resultNRdyAo;
+    rui16_t nRdyAo, resultNRdyAo;
 
     rdyCbArg.cnt = 0;
     nRdyAo = 0;
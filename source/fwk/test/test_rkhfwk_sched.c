@@ -0,0 +1,322 @@
+/*
+ *  --------------------------------------------------------------------------
+ *
+ *                                Framework RKH
+ *                                -------------
+ *
+ *            State-machine framework for reactive embedded systems
+ *
+ *                      Copyright (C) 2010 Leandro Francucci.
+ *          All rights reserved. Protected by international copyright laws.
+ *
+ *
+ *  RKH is free software: you can redistribute it and/or modify it under the
+ *  terms of the GNU General Public License as published by the Recycle Software
+ *  Foundation, either version 3 of the License, or (at your option) any
+ *  later version.
+ *
+ *  RKH is distributed in the hope that it will be useful, but WITHOUT ANY
+ *  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with RKH, see copying.txt file.
+ *
+ *  Contact information:
+ *  RKH site: http://vortexmakes.com/que-es/
+ *  RKH GitHub: https://github.com/vortexmakes/RKH
+ *  RKH Sourceforge: https://sourceforge.net/projects/rkh-reactivesys/
+ *  e-mail: lf@vortexmakes.com
+ *  ---------------------------------------------------------------------------
+ */
+
+
+/**
+ *  \file       test_rkhfwk_sched.c
+ *  \ingroup    test_fwk
+ *  \brief      Unit test for the scheduling policies of the native scheduler.
+ *
+ *  \addtogroup test
+ *  @{
+ *  \addtogroup test_fwk Framework
+ *  @{
+ *  \brief      Unit test for framework module.
+ */
+
+/* -------------------------- Development history -------------------------- */
+/*
+ *  2026.10.19  LeFr  v3.4.00  Initial version
+ */
+
+/* -------------------------------- Authors -------------------------------- */
+/*
+ *  LeFr  Leandro Francucci  lf@vortexmakes.com
+ */
+
+/* --------------------------------- Notes --------------------------------- */
+/*
+ *  The ready list and the event queues are replaced by a fake one, driven 
+ *  by the number of queued events of every active object, so that the 
+ *  scheduler runs until there is nothing else to dispatch. Then, the idle 
+ *  hook checks the order in which the active objects were served and ends 
+ *  the test.
+ */
+
+/* ----------------------------- Include files ----------------------------- */
+#include <string.h>
+#include "unity.h"
+#include "rkhfwk_sched.h"
+#include "Mock_rkhsma_prio.h"
+#include "Mock_rkhsma.h"
+#include "Mock_rkhfwk_dynevt.h"
+#include "Mock_rkhfwk_hook.h"
+#include "Mock_rkhtrc_record.h"
+#include "Mock_rkhtrc_filter.h"
+#include "Mock_rkhport.h"
+#include "Mock_rkhassert.h"
+
+/* ----------------------------- Local macros ------------------------------ */
+#define setQueued(ao_, nEvts_)      ((ao_)->equeue.qty = (nEvts_))
+
+/* ------------------------------- Constants ------------------------------- */
+#define MAX_DISPATCHES      32
+
+/* ---------------------------- Local data types --------------------------- */
+/* ---------------------------- Global variables --------------------------- */
+int GlobalExpectCount;
+int GlobalVerifyOrder;
+char *GlobalOrderError;
+RKH_SMA_T *rkh_sptbl[RKH_CFG_FWK_MAX_SMA];
+
+/* ---------------------------- Local variables ---------------------------- */
+RKH_SMA_CREATE(RKH_SMA_T, ao0, 0, HCAL, NULL, NULL, NULL);
+RKH_SMA_DEF_PTR(ao0);
+RKH_SMA_CREATE(RKH_SMA_T, ao1, 1, HCAL, NULL, NULL, NULL);
+RKH_SMA_DEF_PTR(ao1);
+RKH_SMA_CREATE(RKH_SMA_T, ao2, 2, HCAL, NULL, NULL, NULL);
+RKH_SMA_DEF_PTR(ao2);
+RKH_SMA_CREATE(RKH_SMA_T, ao4, 4, HCAL, NULL, NULL, NULL);
+RKH_SMA_DEF_PTR(ao4);
+
+static RKH_EVT_T event;
+static char dispatched[MAX_DISPATCHES + 1];
+static int nDispatched;
+static const char *expected;
+
+/* ----------------------- Local function prototypes ----------------------- */
+/* ---------------------------- Local functions ---------------------------- */
+static void 
+MockAssertCallback(const char* const file, int line, int cmock_num_calls)
+{
+    TEST_PASS();
+}
+
+static rbool_t
+isQueued(rui16_t prio)
+{
+    return (rkh_sptbl[prio] != (RKH_SMA_T *)0) && 
+           (rkh_sptbl[prio]->equeue.qty != 0);
+}
+
+static rui8_t
+findQueuedFrom(rui16_t prio, rui8_t none)
+{
+    for (; prio < RKH_CFG_FWK_MAX_SMA; ++prio)
+    {
+        if (isQueued(prio))
+        {
+            return (rui8_t)prio;
+        }
+    }
+    return none;
+}
+
+static rbool_t
+Fake_isReady(int cmock_num_calls)
+{
+    return findQueuedFrom(0, RKH_CFG_FWK_MAX_SMA) != RKH_CFG_FWK_MAX_SMA;
+}
+
+static rui8_t
+Fake_findHighest(int cmock_num_calls)
+{
+    return findQueuedFrom(0, 0);
+}
+
+static rui8_t
+Fake_findNext(rui8_t prio, int cmock_num_calls)
+{
+    return findQueuedFrom((rui16_t)(prio + 1u), prio);
+}
+
+static RKH_EVT_T *
+Fake_get(RKH_SMA_T *me, int cmock_num_calls)
+{
+    TEST_ASSERT_TRUE(me->equeue.qty != 0);
+    TEST_ASSERT_TRUE(nDispatched < MAX_DISPATCHES);
+    --me->equeue.qty;
+    dispatched[nDispatched++] = (char)('0' + RKH_GET_PRIO(me));
+    return &event;
+}
+
+static void
+Fake_idle(int cmock_num_calls)
+{
+    TEST_ASSERT_EQUAL_STRING(expected, dispatched);
+    TEST_PASS();
+}
+
+static void
+runUntilIdle(const char *order)
+{
+    expected = order;
+    rkh_fwk_enter();
+}
+
+/* ---------------------------- Global functions --------------------------- */
+void
+setUp(void)
+{
+    Mock_rkhsma_prio_Init();
+    Mock_rkhsma_Init();
+    Mock_rkhfwk_dynevt_Init();
+    Mock_rkhfwk_hook_Init();
+    Mock_rkhtrc_record_Init();
+    Mock_rkhtrc_filter_Init();
+    Mock_rkhport_Init();
+    Mock_rkhassert_Init();
+
+    rkh_enter_critical_Ignore();
+    rkh_exit_critical_Ignore();
+    rkh_trc_isoff__IgnoreAndReturn(RKH_FALSE);
+    rkh_smaPrio_isReady_StubWithCallback(Fake_isReady);
+    rkh_smaPrio_findHighest_StubWithCallback(Fake_findHighest);
+    rkh_smaPrio_findNext_StubWithCallback(Fake_findNext);
+    rkh_sma_get_StubWithCallback(Fake_get);
+    rkh_sma_dispatch_Ignore();
+    rkh_fwk_gc_Ignore();
+    rkh_hook_idle_StubWithCallback(Fake_idle);
+
+    memset(rkh_sptbl, 0, sizeof(rkh_sptbl));
+    rkh_sptbl[RKH_GET_PRIO(ao0)] = ao0;
+    rkh_sptbl[RKH_GET_PRIO(ao1)] = ao1;
+    rkh_sptbl[RKH_GET_PRIO(ao2)] = ao2;
+    rkh_sptbl[RKH_GET_PRIO(ao4)] = ao4;
+    setQueued(ao0, 0);
+    setQueued(ao1, 0);
+    setQueued(ao2, 0);
+    setQueued(ao4, 0);
+    memset(dispatched, 0, sizeof(dispatched));
+    nDispatched = 0;
+
+    rkh_fwk_init();
+}
+
+void
+tearDown(void)
+{
+    Mock_rkhsma_prio_Verify();
+    Mock_rkhsma_Verify();
+    Mock_rkhfwk_dynevt_Verify();
+    Mock_rkhfwk_hook_Verify();
+    Mock_rkhtrc_record_Verify();
+    Mock_rkhtrc_filter_Verify();
+    Mock_rkhport_Verify();
+    Mock_rkhassert_Verify();
+    Mock_rkhsma_prio_Destroy();
+    Mock_rkhsma_Destroy();
+    Mock_rkhfwk_dynevt_Destroy();
+    Mock_rkhfwk_hook_Destroy();
+    Mock_rkhtrc_record_Destroy();
+    Mock_rkhtrc_filter_Destroy();
+    Mock_rkhport_Destroy();
+    Mock_rkhassert_Destroy();
+}
+
+/**
+ *  \addtogroup test_sched Test cases of native scheduler group
+ *  @{
+ *  \name Test cases of native scheduler group
+ *  @{ 
+ */
+void
+test_StrictPolicyServesTheHighestPriorityFirst(void)
+{
+    setQueued(ao1, 2);
+    setQueued(ao0, 3);
+
+    runUntilIdle("00011");
+}
+
+void
+test_BurstPolicyYieldsWhenTheQuotaRunsOut(void)
+{
+    rkh_fwk_setSchedPolicy(RKH_SCHED_BURST);
+    rkh_fwk_setBurstQuota(ao0, 2);
+    rkh_fwk_setBurstQuota(ao1, 1);
+    setQueued(ao0, 5);
+    setQueued(ao1, 2);
+
+    runUntilIdle("0010010");
+}
+
+void
+test_BurstPolicyKeepsServingTheOnlyReadyOne(void)
+{
+    rkh_fwk_setSchedPolicy(RKH_SCHED_BURST);
+    rkh_fwk_setBurstQuota(ao0, 2);
+    setQueued(ao0, 5);
+
+    runUntilIdle("00000");
+}
+
+void
+test_BurstPolicyUsesTheDefaultQuota(void)
+{
+    rkh_fwk_setSchedPolicy(RKH_SCHED_BURST);
+    rkh_fwk_setBurstQuota(ao0, 0);
+    setQueued(ao0, RKH_CFG_FWK_SCHED_BURST + 1);
+    setQueued(ao1, 1);
+
+    runUntilIdle("000010");
+}
+
+void
+test_RoundRobinPolicyAlternatesWithinAGroup(void)
+{
+    rkh_fwk_setSchedPolicy(RKH_SCHED_RR);
+    setQueued(ao0, 3);
+    setQueued(ao1, 2);
+    setQueued(ao2, 1);
+    setQueued(ao4, 2);
+
+    runUntilIdle("01201044");
+}
+
+void
+test_RoundRobinPolicyResumesAfterTheLastServed(void)
+{
+    rkh_fwk_setSchedPolicy(RKH_SCHED_RR);
+    setQueued(ao1, 1);
+    setQueued(ao2, 2);
+
+    runUntilIdle("122");
+}
+
+void
+test_Fails_InvalidSchedPolicy(void)
+{
+    rkh_assert_Expect("rkhfwk_sched", 0);
+    rkh_assert_IgnoreArg_line();
+    rkh_assert_StubWithCallback(MockAssertCallback);
+
+    rkh_fwk_setSchedPolicy(RKH_SCHED_NUM_POLICIES);
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+
+/* ------------------------------ End of file ------------------------------ */
@@ -0,0 +1,426 @@
+/*
+ *  --------------------------------------------------------------------------
+ *
+ *                                Framework RKH
+ *                                -------------
+ *
+ *            State-machine framework for reactive embedded systems
+ *
+ *                      Copyright (C) 2010 Leandro Francucci.
+ *          All rights reserved. Protected by international copyright laws.
+ *
+ *
+ *  RKH is free software: you can redistribute it and/or modify it under the
+ *  terms of the GNU General Public License as published by the Free Software
+ *  Foundation, either version 3 of the License, or (at your option) any
+ *  later version.
+ *
+ *  RKH is distributed in the hope that it will be useful, but WITHOUT ANY
+ *  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with RKH, see copying.txt file.
+ *
+ *  Contact information:
+ *  RKH site: http://vortexmakes.com/que-es/
+ *  RKH GitHub: https://github.com/vortexmakes/RKH
+ *  RKH Sourceforge: https://sourceforge.net/projects/rkh-reactivesys/
+ *  e-mail: lf@vortexmakes.com
+ *  ---------------------------------------------------------------------------
+ */
+
+
+/**
+ *  \file       rkhport.c
+ *  \brief      Linux Multi-Thread port (POSIX threads)
+ *
+ *  \ingroup    port
+ */
+
+/* -------------------------- Development history -------------------------- */
+/*
+ *  2026.10.19  LeFr  v3.4.00  Initial version
+ */
+
+/* -------------------------------- Authors -------------------------------- */
+/*
+ *  LeFr  Leandro Francucci  lf@vortexmakes.com
+ */
+
+/* --------------------------------- Notes --------------------------------- */
+/* ----------------------------- Include files ----------------------------- */
+#define _GNU_SOURCE
+#include <pthread.h>
+#include <sched.h>
+#include <limits.h>
+#include <time.h>
+
+#include "rkh.h"
+#include "rkhfwk_dynevt.h"
+
+/* ----------------------------- Local macros ------------------------------ */
+/* ------------------------------- Constants ------------------------------- */
+RKH_MODULE_NAME(rkhport)
+RKH_MODULE_VERSION(rkhport, 1.00)
+RKH_MODULE_DESC(rkhport, "Linux (multi thread)")
+
+#define MAX_CPUS        64
+
+/* ---------------------------- Local data types --------------------------- */
+/* ---------------------------- Global variables --------------------------- */
+/* ---------------------------- Local variables ---------------------------- */
+static pthread_mutex_t csection;
+static __thread rui32_t csNesting;  /* of the critical section per thread */
+static rui8_t running;
+static pthread_t idle_thread;
+static pthread_cond_t idleSignal;
+static rui8_t idleRequested;        /* an active object is about to block */
+static int threadError[RKH_CFG_FWK_MAX_SMA];
+static rbool_t isDetached[RKH_CFG_FWK_MAX_SMA];
+static rui8_t l_isr_tick;
+
+/* ----------------------- Local function prototypes ----------------------- */
+/* ---------------------------- Local functions ---------------------------- */
+static void *
+idle_thread_function(void *par)
+{
+    (void)par;
+
+    RKH_ENTER_CRITICAL(dummy);
+    while (running)
+    {
+        while (running && !idleRequested)
+        {
+            pthread_cond_wait(&idleSignal, &csection);
+        }
+        idleRequested = 0;
+        RKH_EXIT_CRITICAL(dummy);
+
+        RKH_TRC_FLUSH();
+        rkhport_wait_for_events();
+
+        RKH_ENTER_CRITICAL(dummy);
+    }
+    RKH_EXIT_CRITICAL(dummy);
+    return (void *)0;
+}
+
+static void
+stopIdle(void)
+{
+    RKH_ENTER_CRITICAL(dummy);
+    running = 0;
+    pthread_cond_signal(&idleSignal);
+    RKH_EXIT_CRITICAL(dummy);
+}
+
+static void
+unregister(RKH_SMA_T *sma)
+{
+    RKH_SR_ALLOC();
+
+    rkh_sma_unregister(sma);
+    RKH_TR_SMA_TERM(sma, RKH_GET_PRIO(sma));
+    if (isDetached[RKH_GET_PRIO(sma)])  /* nobody joins it */
+    {
+        pthread_cond_destroy(&sma->os_signal);
+    }
+}
+
+static void *
+thread_function(void *arg)
+{
+    RKH_SMA_T *sma;
+
+    sma = (RKH_SMA_T *)arg;
+    do
+    {
+        RKH_EVT_T *e = rkh_sma_get(sma);
+        RKH_SMA_DISPATCH(sma, e);
+        RKH_FWK_GC(e, sma);
+    }
+    while (sma->running);
+
+    unregister(sma);
+    return (void *)0;
+}
+
+/*
+ *  The highest RKH priority, zero, is mapped to the maximum priority of the 
+ *  policy, and the others downwards, saturating at its minimum.
+ */
+static int
+mapPriority(int policy, rui8_t prio)
+{
+    int max, min, priority;
+
+    max = sched_get_priority_max(policy);
+    min = sched_get_priority_min(policy);
+    priority = max - (int)prio;
+    return (priority < min) ? min : priority;
+}
+
+static int
+setThreadAttr(pthread_attr_t *attr, const RKHThreadAttr *thAttr, rui8_t prio)
+{
+    cpu_set_t cpus;
+    struct sched_param param;
+    int cpu, error;
+
+    error = 0;
+    if (thAttr->cpuMask != 0)
+    {
+        CPU_ZERO(&cpus);
+        for (cpu = 0; cpu < MAX_CPUS; ++cpu)
+        {
+            if ((thAttr->cpuMask & ((uint64_t)1 << cpu)) != 0)
+            {
+                CPU_SET(cpu, &cpus);
+            }
+        }
+        error = pthread_attr_setaffinity_np(attr, sizeof(cpus), &cpus);
+    }
+    if ((error == 0) && (thAttr->policy != SCHED_OTHER))
+    {
+        param.sched_priority = (thAttr->priority != 0) ? 
+                               thAttr->priority : 
+                               mapPriority(thAttr->policy, prio);
+        error = pthread_attr_setinheritsched(attr, PTHREAD_EXPLICIT_SCHED);
+        if (error == 0)
+        {
+            error = pthread_attr_setschedpolicy(attr, thAttr->policy);
+        }
+        if (error == 0)
+        {
+            error = pthread_attr_setschedparam(attr, &param);
+        }
+    }
+    return error;
+}
+
+/* ---------------------------- Global functions --------------------------- */
+const
+char *
+rkhport_get_version(void)
+{
+    return RKH_MODULE_GET_VERSION();
+}
+
+const
+char *
+rkhport_get_desc(void)
+{
+    return RKH_MODULE_GET_DESC();
+}
+
+rui8_t
+rkhport_fwk_is_running(void)
+{
+    return running;
+}
+
+void
+rkhport_fwk_stop(void)
+{
+    stopIdle();
+}
+
+/*
+ *  The critical section is nested, i.e. a timer posts its event while the 
+ *  timers are ticked, hence the nesting is counted per thread and the 
+ *  mutex, which is a normal one, is locked only by the outermost level. 
+ *  Thus, pthread_cond_wait() always releases it.
+ */
+void
+rkhport_enter_critical(void)
+{
+    if (csNesting++ == 0)
+    {
+        pthread_mutex_lock(&csection);
+    }
+}
+
+void
+rkhport_exit_critical(void)
+{
+    if (--csNesting == 0)
+    {
+        pthread_mutex_unlock(&csection);
+    }
+}
+
+void
+rkhport_wait_for_events(void)
+{
+}
+
+int
+rkhport_sma_getThreadError(const RKH_SMA_T *sma)
+{
+    RKH_REQUIRE(sma != (const RKH_SMA_T *)0);
+    return threadError[RKH_GET_PRIO(sma)];
+}
+
+void
+rkh_sma_block(RKH_SMA_T *const me)
+{
+    RKH_ASSERT(csNesting == 1);
+    if (me->equeue.qty == 0)
+    {
+        idleRequested = 1;
+        pthread_cond_signal(&idleSignal);
+    }
+    while ((me->equeue.qty == 0) && me->running)
+    {
+        pthread_cond_wait(&me->os_signal, &csection);
+    }
+
+    /* Terminated by another thread, which joins it */
+    if (me->equeue.qty == 0)
+    {
+        csNesting = 0;
+        pthread_mutex_unlock(&csection);
+        unregister(me);
+        pthread_exit((void *)0);
+    }
+}
+
+void
+rkh_sma_setReady(RKH_SMA_T *const me)
+{
+    pthread_cond_signal(&me->os_signal);
+}
+
+void
+rkh_sma_setUnready(RKH_SMA_T *const me)
+{
+    (void)me;
+}
+
+void
+rkh_fwk_init(void)
+{
+    pthread_mutex_init(&csection, (const pthread_mutexattr_t *)0);
+    pthread_cond_init(&idleSignal, (const pthread_condattr_t *)0);
+}
+
+void
+rkh_fwk_enter(void)
+{
+    struct timespec tick;
+    int result;
+    RKH_SR_ALLOC();
+
+    tick.tv_sec = 0;
+    tick.tv_nsec = 1000000000L / RKH_CFG_FWK_TICK_RATE_HZ;
+    running = (rui8_t)1;
+
+    result = pthread_create(&idle_thread, NULL, &idle_thread_function, 
+                            (void *)0);
+    RKH_ASSERT(result == 0);
+
+    RKH_HOOK_START();                       /* start-up callback */
+    RKH_TR_FWK_EN();
+    RKH_TR_FWK_OBJ(&l_isr_tick);
+
+    while (running)
+    {
+        nanosleep(&tick, (struct timespec *)0); /* wait for the tick */
+                                                /* interval */
+        RKH_TIM_TICK(&l_isr_tick);      /* tick handler */
+    }
+    pthread_join(idle_thread, (void **)0);
+    RKH_HOOK_EXIT();                    /* cleanup callback */
+    RKH_TRC_CLOSE();                    /* cleanup the trace session */
+    pthread_cond_destroy(&idleSignal);
+    pthread_mutex_destroy(&csection);
+}
+
+void
+rkh_fwk_exit(void)
+{
+    RKH_SR_ALLOC();
+
+    RKH_TR_FWK_EX();
+    RKH_HOOK_EXIT();
+    stopIdle();
+}
+
+void
+rkh_sma_activate(RKH_SMA_T *sma, const RKH_EVT_T **qs, RKH_QUENE_T qsize,
+                 void *stks, rui32_t stksize)
+{
+    pthread_attr_t attr;
+    const RKHThreadAttr *thAttr;
+    rui8_t prio;
+    int error, result;
+    RKH_SR_ALLOC();
+
+    RKH_REQUIRE(qs != (const RKH_EVT_T **)0);
+
+    thAttr = (const RKHThreadAttr *)stks;
+    prio = RKH_GET_PRIO(sma);
+    rkh_queue_init(&sma->equeue, (const void **)qs, qsize, sma);
+    rkh_sma_register(sma);
+    pthread_cond_init(&sma->os_signal, NULL);
+    rkh_sm_init((RKH_SM_T *)sma);
+    sma->running = (rbool_t)1;
+    isDetached[prio] = RKH_FALSE;
+
+    pthread_attr_init(&attr);
+    error = 0;
+    if (stksize != 0)
+    {
+        error = pthread_attr_setstacksize(&attr, 
+                    ((size_t)stksize < (size_t)PTHREAD_STACK_MIN) ? 
+                    (size_t)PTHREAD_STACK_MIN : (size_t)stksize);
+    }
+    if ((error == 0) && (thAttr != (const RKHThreadAttr *)0))
+    {
+        error = setThreadAttr(&attr, thAttr, prio);
+    }
+    if (error == 0)
+    {
+        error = pthread_create(&sma->thread, &attr, thread_function, sma);
+    }
+    pthread_attr_destroy(&attr);
+
+    threadError[prio] = error;
+    if (error != 0)     /* see rkhport_sma_getThreadError() */
+    {
+        result = pthread_create(&sma->thread, NULL, thread_function, sma);
+        RKH_ASSERT(result == 0);
+    }
+    RKH_TR_SMA_ACT(sma, prio, qsize);
+}
+
+void
+rkh_sma_terminate(RKH_SMA_T *sma)
+{
+    rbool_t isSelf;
+
+    isSelf = pthread_equal(pthread_self(), sma->thread);
+    RKH_ENTER_CRITICAL(dummy);
+    sma->running = (rbool_t)0;
+    isDetached[RKH_GET_PRIO(sma)] = isSelf;
+    pthread_cond_signal(&sma->os_signal);
+    RKH_EXIT_CRITICAL(dummy);
+
+    /* 
+     * Terminated from its own thread, it ends once the current event has 
+     * been dispatched, otherwise it is waited for.
+     */
+    if (isSelf)
+    {
+        pthread_detach(sma->thread);
+    }
+    else
+    {
+        pthread_join(sma->thread, (void **)0);
+        pthread_cond_destroy(&sma->os_signal);
+    }
+}
+
+/* ------------------------------ End of file ------------------------------ */
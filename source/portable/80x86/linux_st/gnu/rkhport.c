@@ -52,7 +52,9 @@
 /* --------------------------------- Notes --------------------------------- */
 /* ----------------------------- Include files ----------------------------- */
 #include <pthread.h>
-#include <semaphore.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
 
 #include "rkh.h"
 #include "rkhfwk_dynevt.h"
@@ -66,14 +68,54 @@ RKH_MODULE_VERSION(rkhport, 1.00)
 RKH_MODULE_DESC(rkhport, "Linux 32-bits (single thread)")
 
 /* ---------------------------- Local data types --------------------------- */
+typedef struct IoWatch IoWatch;
+struct IoWatch
+{
+    RKHIoEvt evt;
+    rui32_t events;
+    RKH_SMA_T *ao;
+};
+
 /* ---------------------------- Global variables --------------------------- */
 /* ---------------------------- Local variables ---------------------------- */
 pthread_mutex_t csection;
-static sem_t sma_is_rdy;
+static int sma_is_rdy;      /* eventfd, written only to wake up the idle */
+static rui8_t idle;         /* set when the scheduler is about to sleep */
 static rui8_t running;
+static rui8_t dispatching;  /* set while the scheduler dispatches an event */
+static pthread_t scheduler;
+static int ioReactor;       /* epoll instance, it waits for AOs and I/O */
+static IoWatch ioWatches[RKH_CFGPORT_IO_MAX_WATCHES];
 
 /* ----------------------- Local function prototypes ----------------------- */
 /* ---------------------------- Local functions ---------------------------- */
+static IoWatch *
+findWatch(int fd)
+{
+    IoWatch *watch;
+
+    for (watch = ioWatches; 
+         watch < &ioWatches[RKH_CFGPORT_IO_MAX_WATCHES]; 
+         ++watch)
+    {
+        if (watch->evt.fd == fd)
+        {
+            return watch;
+        }
+    }
+    return (IoWatch *)0;
+}
+
+static int
+armWatch(IoWatch *watch, int op)
+{
+    struct epoll_event ev;
+
+    ev.events = watch->events | EPOLLONESHOT;
+    ev.data.ptr = watch;
+    return epoll_ctl(ioReactor, op, watch->evt.fd, &ev);
+}
+
 /* ---------------------------- Global functions --------------------------- */
 const
 char *
@@ -89,6 +131,12 @@ rkhport_get_desc(void)
     return RKH_MODULE_GET_DESC();
 }
 
+rbool_t
+rkhport_isDispatching(void)
+{
+    return (dispatching != 0) && pthread_equal(pthread_self(), scheduler);
+}
+
 rui8_t
 rkhport_fwk_is_running(void)
 {
@@ -116,7 +164,89 @@ rkhport_exit_critical(void)
 void
 rkhport_wait_for_events(void)
 {
-    ((void)sem_wait(&sma_is_rdy));
+    struct epoll_event ready[RKH_CFGPORT_IO_MAX_WATCHES + 1];
+    int nReady, i;
+    IoWatch *watch;
+    eventfd_t nWakeUps;
+
+    nReady = epoll_wait(ioReactor, ready, RKH_CFGPORT_IO_MAX_WATCHES + 1, -1);
+
+    RKH_ENTER_CRITICAL(dummy);
+    idle = 0;           /* the I/O events posted below need no wake up */
+    RKH_EXIT_CRITICAL(dummy);
+
+    for (i = 0; i < nReady; ++i)
+    {
+        watch = (IoWatch *)ready[i].data.ptr;
+        if (watch == (IoWatch *)0)      /* an active object is ready */
+        {
+            (void)eventfd_read(sma_is_rdy, &nWakeUps);
+        }
+        else
+        {
+            watch->evt.events = ready[i].events;
+            RKH_SMA_POST_FIFO(watch->ao, (RKH_EVT_T *)&watch->evt, 
+                              &ioReactor);
+        }
+    }
+}
+
+void
+rkhport_io_watch(int fd, rui32_t events, RKH_SMA_T *ao, RKH_SIG_T signal)
+{
+    IoWatch *watch;
+    int result;
+
+    RKH_REQUIRE((fd >= 0) && (ao != (RKH_SMA_T *)0));
+    RKH_ENTER_CRITICAL(dummy);
+    watch = findWatch(-1);
+    RKH_ASSERT(watch != (IoWatch *)0);
+    RKH_SET_STATIC_EVENT(&watch->evt, signal);
+    watch->evt.fd = fd;
+    watch->events = events;
+    watch->ao = ao;
+    result = armWatch(watch, EPOLL_CTL_ADD);
+    if (result != 0)    /* e.g. EEXIST, the slot is not claimed */
+    {
+        watch->evt.fd = -1;
+    }
+    RKH_EXIT_CRITICAL(dummy);
+    RKH_ENSURE(result == 0);
+}
+
+void
+rkhport_io_rearm(int fd)
+{
+    IoWatch *watch;
+    int result;
+
+    RKH_ENTER_CRITICAL(dummy);
+    watch = findWatch(fd);
+    RKH_ASSERT((fd >= 0) && (watch != (IoWatch *)0));
+    result = armWatch(watch, EPOLL_CTL_MOD);
+    RKH_EXIT_CRITICAL(dummy);
+    RKH_ENSURE(result == 0);
+}
+
+void
+rkhport_io_unwatch(int fd)
+{
+    IoWatch *watch;
+
+    RKH_ENTER_CRITICAL(dummy);
+    watch = findWatch(fd);
+    RKH_ASSERT((fd >= 0) && (watch != (IoWatch *)0));
+    (void)epoll_ctl(ioReactor, EPOLL_CTL_DEL, fd, (struct epoll_event *)0);
+    watch->evt.fd = -1;
+    RKH_EXIT_CRITICAL(dummy);
+}
+
+rbool_t
+rkhport_io_isEvt(const RKH_EVT_T *e)
+{
+    return ((const void *)e >= (const void *)ioWatches) && 
+           ((const void *)e < 
+            (const void *)&ioWatches[RKH_CFGPORT_IO_MAX_WATCHES]);
 }
 
 void
@@ -129,7 +259,11 @@ void
 rkh_sma_setReady(RKH_SMA_T *const me)
 {
     rkh_smaPrio_setReady(RKH_SMA_ACCESS_CONST(me, prio));
-    (void)sem_post(&sma_is_rdy);
+    if (idle != 0)      /* only the idle -> ready edge costs a syscall */
+    {
+        idle = 0;
+        (void)eventfd_write(sma_is_rdy, 1);
+    }
 }
 
 void
@@ -142,12 +276,29 @@ void
 rkh_fwk_init(void)
 {
     pthread_mutexattr_t attr;
+    struct epoll_event ev;
+    IoWatch *watch;
+    int result;
 
     pthread_mutexattr_init(&attr);
     pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
     pthread_mutex_init(&csection, &attr);
 
-    sem_init(&sma_is_rdy, 0, 0);
+    sma_is_rdy = eventfd(0, EFD_CLOEXEC);
+    ioReactor = epoll_create1(EPOLL_CLOEXEC);
+    RKH_ASSERT((sma_is_rdy >= 0) && (ioReactor >= 0));
+    idle = 0;
+
+    for (watch = ioWatches; 
+         watch < &ioWatches[RKH_CFGPORT_IO_MAX_WATCHES]; 
+         ++watch)
+    {
+        watch->evt.fd = -1;
+    }
+    ev.events = EPOLLIN;
+    ev.data.ptr = (void *)0;
+    result = epoll_ctl(ioReactor, EPOLL_CTL_ADD, sma_is_rdy, &ev);
+    RKH_ENSURE(result == 0);
 }
 
 void
@@ -159,6 +310,7 @@ rkh_fwk_enter(void)
     RKH_SR_ALLOC();
 
     running = 1;
+    scheduler = pthread_self();
     RKH_HOOK_START();
     RKH_TR_FWK_EN();
 
@@ -172,17 +324,26 @@ rkh_fwk_enter(void)
 
             sma = rkh_sptbl[prio];
             e = rkh_sma_get(sma);
+            dispatching = 1;
             RKH_SMA_DISPATCH(sma, e);
+            dispatching = 0;
             RKH_FWK_GC(e, sma);
         }
         else
         {
+            /* 
+             * The flag is set within the critical section, so a post 
+             * arriving after the idle hook exits it writes the eventfd 
+             * and the wait returns at once.
+             */
+            idle = 1;
             rkh_hook_idle();
         }
     }
 
     rkh_hook_exit();
-    sem_destroy(&sma_is_rdy);
+    close(ioReactor);
+    close(sma_is_rdy);
 
     pthread_mutex_destroy(&csection);
 }
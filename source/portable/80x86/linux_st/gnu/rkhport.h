@@ -55,9 +55,9 @@
 
 /* ----------------------------- Include files ----------------------------- */
 #include <pthread.h>
-#include <semaphore.h>
 
 #include "rkhtype.h"
+#include "rkhevt.h"
 #include "rkhqueue.h"
 #include "rkhmempool.h"
 #include "rkhsma_prio.h"
@@ -154,6 +154,14 @@ extern "C" {
  */
 #define RKH_CFGPORT_SMA_STK_EN              RKH_DISABLED
 
+/**
+ *  Specify the maximum number of file descriptors that can be watched at 
+ *  the same time by means of rkhport_io_watch().
+ */
+#ifndef RKH_CFGPORT_IO_MAX_WATCHES
+#define RKH_CFGPORT_IO_MAX_WATCHES          8u
+#endif
+
 /*
  *  Declaring an object RKHROM announces that its value will
  *  not be changed and it will be stored in ROM.
@@ -181,6 +189,19 @@ extern "C" {
 /* #define RKH_THREAD_STK_TYPE */
 
 /* ------------------------------- Data types ------------------------------ */
+/**
+ *  \brief
+ *  Event posted to an active object when a watched file descriptor becomes 
+ *  ready. Its signal is the one given to rkhport_io_watch().
+ */
+typedef struct RKHIoEvt RKHIoEvt;
+struct RKHIoEvt
+{
+    RKH_EVT_T evt;
+    int fd;             /**< ready file descriptor */
+    rui32_t events;     /**< reported epoll events, i.e. EPOLLIN */
+};
+
 /* -------------------------- External variables --------------------------- */
 /* -------------------------- Function prototypes -------------------------- */
 const char *rkhport_get_version(void);
@@ -191,6 +212,64 @@ void rkhport_enter_critical(void);
 void rkhport_exit_critical(void);
 void rkhport_wait_for_events(void);
 
+/**
+ *  \brief
+ *  Evaluates to true if it is called by the scheduler while it dispatches 
+ *  an event, thus an event posted by the caller is produced by an active 
+ *  object, otherwise it is produced by a hook, a timer or another thread.
+ */
+rbool_t rkhport_isDispatching(void);
+
+/**
+ *  \brief
+ *  Registers a file descriptor into the I/O reactor of the scheduler. 
+ *
+ *  When the scheduler goes idle, it waits on a single epoll instance both 
+ *  for posted events and for the watched file descriptors, so that no 
+ *  extra thread is needed to convert I/O into events. When \a fd becomes 
+ *  ready, a RKHIoEvt with signal \a signal is posted to \a ao. The watch 
+ *  is one-shot: it is disarmed until the active object calls 
+ *  rkhport_io_rearm(), usually after reading or writing \a fd, thus the 
+ *  event is never posted again while it is still queued.
+ *
+ *  \param[in] fd       file descriptor to watch, i.e. a socket.
+ *  \param[in] events   epoll events of interest, i.e. EPOLLIN.
+ *  \param[in] ao       active object that receives the readiness events.
+ *  \param[in] signal   signal of the readiness events.
+ *
+ *  \note
+ *  The readiness is collected when the scheduler has not any ready active 
+ *  object, so that the posted events have priority over I/O.
+ */
+void rkhport_io_watch(int fd, rui32_t events, struct RKH_SMA_T *ao, 
+                      RKH_SIG_T signal);
+
+/**
+ *  \brief
+ *  Arms again a file descriptor previously watched by means of 
+ *  rkhport_io_watch().
+ *
+ *  \param[in] fd       watched file descriptor.
+ */
+void rkhport_io_rearm(int fd);
+
+/**
+ *  \brief
+ *  Removes a file descriptor from the I/O reactor.
+ *
+ *  \param[in] fd       watched file descriptor.
+ */
+void rkhport_io_unwatch(int fd);
+
+/**
+ *  \brief
+ *  Evaluates to true if \a e is a readiness event posted by the I/O 
+ *  reactor, which is owned by the port.
+ *
+ *  \param[in] e        event to check.
+ */
+rbool_t rkhport_io_isEvt(const RKH_EVT_T *e);
+
 /* -------------------- External C language linkage end -------------------- */
 #ifdef __cplusplus
 }
@@ -0,0 +1,512 @@
+/*
+ *  --------------------------------------------------------------------------
+ *
+ *                                Framework RKH
+ *                                -------------
+ *
+ *            State-machine framework for reactive embedded systems
+ *
+ *                      Copyright (C) 2010 Leandro Francucci.
+ *          All rights reserved. Protected by international copyright laws.
+ *
+ *
+ *  RKH is free software: you can redistribute it and/or modify it under the
+ *  terms of the GNU General Public License as published by the Free Software
+ *  Foundation, either version 3 of the License, or (at your option) any
+ *  later version.
+ *
+ *  RKH is distributed in the hope that it will be useful, but WITHOUT ANY
+ *  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with RKH, see copying.txt file.
+ *
+ *  Contact information:
+ *  RKH site: http://vortexmakes.com/que-es/
+ *  RKH GitHub: https://github.com/vortexmakes/RKH
+ *  RKH Sourceforge: https://sourceforge.net/projects/rkh-reactivesys/
+ *  e-mail: lf@vortexmakes.com
+ *  ---------------------------------------------------------------------------
+ */
+
+/**
+ *  \file       rkhport_aio.c
+ *  \brief      Asynchronous I/O service active object of Linux port.
+ *
+ *  \ingroup    port
+ */
+
+/* -------------------------- Development history -------------------------- */
+/*
+ *  2026.10.19  LeFr  v3.4.00  Initial version
+ */
+
+/* -------------------------------- Authors -------------------------------- */
+/*
+ *  LeFr  Leandro Francucci  lf@vortexmakes.com
+ */
+
+/* --------------------------------- Notes --------------------------------- */
+/*
+ *  The io_uring instance is driven by means of raw system calls, so that
+ *  liburing is not required. Completions are signaled through an eventfd
+ *  which is watched by the epoll reactor of the port, hence rkhAio is
+ *  dispatched as any other active object and never blocks.
+ *
+ *  Submissions are batched: the queued SQEs are handed to the kernel when
+ *  the event queue of rkhAio becomes empty. io_uring_enter() is called
+ *  again while it makes progress or it is interrupted. The SQEs refused
+ *  with EAGAIN or EBUSY are kept in the ring and submitted again after the
+ *  next completion, unless there is no request left in the kernel to
+ *  complete. In that case, or if io_uring_enter() fails otherwise, they
+ *  are taken back and replied with the error as result.
+ *
+ *  When io_uring is not available, regular files are transferred
+ *  synchronously, since they are always reported as ready, and other
+ *  descriptors are watched until they become readable or writable. Each
+ *  watched request takes a watch of the port's epoll reactor, so that no
+ *  more than RKH_CFGPORT_IO_MAX_WATCHES of them are pending at once, the
+ *  rest being replied with -EBUSY.
+ */
+
+/* ----------------------------- Include files ----------------------------- */
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <linux/io_uring.h>
+
+#include "rkh.h"
+#include "rkhfwk_dynevt.h"
+#include "rkhport_aio.h"
+
+/* ----------------------------- Local macros ------------------------------ */
+/* ------------------------------- Constants ------------------------------- */
+RKH_MODULE_NAME(rkhport_aio)
+
+#if RKH_CFGPORT_AIO_ENTRIES < RKH_CFGPORT_IO_MAX_WATCHES
+#define AIO_MAX_PENDING     RKH_CFGPORT_AIO_ENTRIES
+#else
+#define AIO_MAX_PENDING     RKH_CFGPORT_IO_MAX_WATCHES
+#endif
+
+/* ---------------------------- Local data types --------------------------- */
+typedef struct Uring Uring;
+struct Uring
+{
+    int fd;
+    int cqEvt;
+    rui8_t *sqRing;
+    rui8_t *cqRing;
+    size_t sqRingSize;
+    size_t cqRingSize;
+    struct io_uring_sqe *sqes;
+    size_t sqesSize;
+    __u32 *sqHead;          /* shared indexes are 32-bit wide */
+    __u32 *sqTail;
+    __u32 *sqMask;
+    __u32 *sqArray;
+    __u32 *cqHead;
+    __u32 *cqTail;
+    __u32 *cqMask;
+    struct io_uring_cqe *cqes;
+    rui32_t nToSubmit;
+};
+
+typedef struct Aio Aio;
+struct Aio
+{
+    RKH_SMA_T base;
+    rbool_t isUring;
+    Uring ring;
+    rui32_t nInFlight;
+    RKHAioReq *pending[AIO_MAX_PENDING];
+};
+
+/* ---------------------------- Local variables ---------------------------- */
+static void init(Aio *const me, RKH_EVT_T *pe);
+static void request(Aio *const me, RKH_EVT_T *pe);
+static void complete(Aio *const me, RKH_EVT_T *pe);
+
+RKH_DCLR_BASIC_STATE aioReady;
+
+RKH_CREATE_BASIC_STATE(aioReady, NULL, NULL, RKH_ROOT, NULL);
+RKH_CREATE_TRANS_TABLE(aioReady)
+    RKH_TRINT(RKH_AIO_REQ_EVENT, NULL, request),
+    RKH_TRINT(RKH_AIO_CQ_EVENT, NULL, complete),
+RKH_END_TRANS_TABLE
+
+RKH_SMA_CREATE(Aio, rkhAio, RKH_CFGPORT_AIO_PRIO, HCAL, &aioReady, init, 
+               NULL);
+
+/* ---------------------------- Global variables --------------------------- */
+RKH_SMA_DEF_PTR(rkhAio);
+
+/* ----------------------- Local function prototypes ----------------------- */
+/* ---------------------------- Local functions ---------------------------- */
+static void
+uringRelease(Uring *ring)
+{
+    if (ring->sqes != (struct io_uring_sqe *)0)
+    {
+        (void)munmap(ring->sqes, ring->sqesSize);
+    }
+    if ((ring->cqRing != (rui8_t *)0) && (ring->cqRing != ring->sqRing))
+    {
+        (void)munmap(ring->cqRing, ring->cqRingSize);
+    }
+    if (ring->sqRing != (rui8_t *)0)
+    {
+        (void)munmap(ring->sqRing, ring->sqRingSize);
+    }
+    if (ring->cqEvt >= 0)
+    {
+        (void)close(ring->cqEvt);
+    }
+    (void)close(ring->fd);
+}
+
+static void *
+uringMap(Uring *ring, size_t size, off_t offset)
+{
+    void *addr;
+
+    addr = mmap((void *)0, size, PROT_READ | PROT_WRITE, 
+                MAP_SHARED | MAP_POPULATE, ring->fd, offset);
+    return (addr == MAP_FAILED) ? (void *)0 : addr;
+}
+
+static rbool_t
+uringSetup(Uring *ring)
+{
+    struct io_uring_params params;
+
+    memset(ring, 0, sizeof(Uring));
+    ring->cqEvt = -1;
+    memset(&params, 0, sizeof(params));
+    ring->fd = (int)syscall(__NR_io_uring_setup, RKH_CFGPORT_AIO_ENTRIES, 
+                            &params);
+    if (ring->fd < 0)
+    {
+        return 0;
+    }
+
+    ring->sqRingSize = params.sq_off.array + 
+                       (params.sq_entries * sizeof(__u32));
+    ring->cqRingSize = params.cq_off.cqes + 
+                       (params.cq_entries * sizeof(struct io_uring_cqe));
+    if ((params.features & IORING_FEAT_SINGLE_MMAP) != 0)
+    {
+        if (ring->cqRingSize > ring->sqRingSize)
+        {
+            ring->sqRingSize = ring->cqRingSize;
+        }
+        ring->sqRing = uringMap(ring, ring->sqRingSize, IORING_OFF_SQ_RING);
+        ring->cqRing = ring->sqRing;
+    }
+    else
+    {
+        ring->sqRing = uringMap(ring, ring->sqRingSize, IORING_OFF_SQ_RING);
+        ring->cqRing = uringMap(ring, ring->cqRingSize, IORING_OFF_CQ_RING);
+    }
+    ring->sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+    ring->sqes = uringMap(ring, ring->sqesSize, IORING_OFF_SQES);
+    if ((ring->sqRing == (rui8_t *)0) || (ring->cqRing == (rui8_t *)0) || 
+        (ring->sqes == (struct io_uring_sqe *)0))
+    {
+        uringRelease(ring);
+        return 0;
+    }
+
+    ring->sqHead = (__u32 *)(ring->sqRing + params.sq_off.head);
+    ring->sqTail = (__u32 *)(ring->sqRing + params.sq_off.tail);
+    ring->sqMask = (__u32 *)(ring->sqRing + params.sq_off.ring_mask);
+    ring->sqArray = (__u32 *)(ring->sqRing + params.sq_off.array);
+    ring->cqHead = (__u32 *)(ring->cqRing + params.cq_off.head);
+    ring->cqTail = (__u32 *)(ring->cqRing + params.cq_off.tail);
+    ring->cqMask = (__u32 *)(ring->cqRing + params.cq_off.ring_mask);
+    ring->cqes = (struct io_uring_cqe *)(ring->cqRing + params.cq_off.cqes);
+
+    ring->cqEvt = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if ((ring->cqEvt < 0) || 
+        (syscall(__NR_io_uring_register, ring->fd, IORING_REGISTER_EVENTFD, 
+                 &ring->cqEvt, 1) < 0))
+    {
+        uringRelease(ring);
+        return 0;
+    }
+    return 1;
+}
+
+static void
+uringPrepare(Uring *ring, RKHAioReq *req)
+{
+    __u32 tail, index;
+    struct io_uring_sqe *sqe;
+
+    tail = *ring->sqTail;   /* only written by this side */
+    index = tail & *ring->sqMask;
+    sqe = &ring->sqes[index];
+    memset(sqe, 0, sizeof(struct io_uring_sqe));
+    sqe->opcode = (req->op == RKH_AIO_READ) ? IORING_OP_READ : 
+                                              IORING_OP_WRITE;
+    sqe->fd = req->fd;
+    sqe->addr = (unsigned long)req->buf;
+    sqe->len = req->size;
+    sqe->off = (req->offset < 0) ? (__u64)-1 : (__u64)req->offset;
+    sqe->user_data = (unsigned long)req;
+    ring->sqArray[index] = index;
+    __atomic_store_n(ring->sqTail, tail + 1, __ATOMIC_RELEASE);
+    ++ring->nToSubmit;
+}
+
+static void
+reply(Aio *const me, RKHAioReq *req)
+{
+    --me->nInFlight;
+    req->evt.e = req->replySig;
+    RKH_SMA_POST_FIFO(req->client, &req->evt, me);
+    RKH_FWK_GC(&req->evt, me);  /* releases the reservation of request() */
+}
+
+static void
+uringCancel(Aio *const me, int error)
+{
+    Uring *ring;
+    __u32 head, tail;
+    RKHAioReq *req;
+
+    /* without SQPOLL the kernel only reads the SQ ring within 
+     * io_uring_enter(), so the SQEs it did not consume can be taken back */
+    ring = &me->ring;
+    head = __atomic_load_n(ring->sqHead, __ATOMIC_ACQUIRE);
+    tail = *ring->sqTail;
+    __atomic_store_n(ring->sqTail, head, __ATOMIC_RELEASE);
+    ring->nToSubmit = 0;
+    for (; head != tail; ++head)
+    {
+        req = (RKHAioReq *)(unsigned long)
+              ring->sqes[ring->sqArray[head & *ring->sqMask]].user_data;
+        req->result = -error;
+        reply(me, req);
+    }
+}
+
+static void
+uringSubmit(Aio *const me)
+{
+    Uring *ring;
+    long result;
+    int error;
+
+    ring = &me->ring;
+    error = 0;
+    while (ring->nToSubmit != 0)
+    {
+        result = syscall(__NR_io_uring_enter, ring->fd, ring->nToSubmit, 0, 
+                         0, (void *)0, 0);
+        if (result > 0)
+        {
+            ring->nToSubmit -= (rui32_t)result;     /* short count */
+        }
+        else
+        {
+            error = (result < 0) ? errno : EAGAIN;
+            if (error != EINTR)
+            {
+                break;
+            }
+        }
+    }
+
+    if ((ring->nToSubmit != 0) && 
+        (((error != EAGAIN) && (error != EBUSY)) || 
+         (me->nInFlight == ring->nToSubmit)))
+    {
+        uringCancel(me, error);
+    }
+}
+
+static void
+uringReap(Aio *const me)
+{
+    Uring *ring;
+    __u32 head, tail;
+    struct io_uring_cqe *cqe;
+    RKHAioReq *req;
+    eventfd_t nCompleted;
+
+    ring = &me->ring;
+    (void)eventfd_read(ring->cqEvt, &nCompleted);
+    head = *ring->cqHead;
+    tail = __atomic_load_n(ring->cqTail, __ATOMIC_ACQUIRE);
+    while (head != tail)
+    {
+        cqe = &ring->cqes[head & *ring->cqMask];
+        req = (RKHAioReq *)(unsigned long)cqe->user_data;
+        req->result = cqe->res;
+        ++head;
+        __atomic_store_n(ring->cqHead, head, __ATOMIC_RELEASE);
+        reply(me, req);
+    }
+}
+
+static void
+transfer(RKHAioReq *req)
+{
+    ssize_t n;
+
+    if (req->op == RKH_AIO_READ)
+    {
+        n = (req->offset < 0) ? read(req->fd, req->buf, req->size) : 
+                        pread(req->fd, req->buf, req->size, req->offset);
+    }
+    else
+    {
+        n = (req->offset < 0) ? write(req->fd, req->buf, req->size) : 
+                        pwrite(req->fd, req->buf, req->size, req->offset);
+    }
+    req->result = (n < 0) ? -errno : (int)n;
+}
+
+static RKHAioReq **
+findPending(Aio *const me, int fd)
+{
+    RKHAioReq **slot;
+
+    for (slot = me->pending; 
+         slot < &me->pending[AIO_MAX_PENDING]; 
+         ++slot)
+    {
+        if ((*slot == (RKHAioReq *)0) ? (fd == -1) : ((*slot)->fd == fd))
+        {
+            return slot;
+        }
+    }
+    return (RKHAioReq **)0;
+}
+
+static void
+fallbackStart(Aio *const me, RKHAioReq *req)
+{
+    struct stat st;
+    RKHAioReq **slot;
+
+    if ((fstat(req->fd, &st) == 0) && S_ISREG(st.st_mode))
+    {
+        transfer(req);
+        reply(me, req);
+        return;
+    }
+
+    /* only one request per descriptor and no more than AIO_MAX_PENDING */
+    slot = (findPending(me, req->fd) == (RKHAioReq **)0) ? 
+           findPending(me, -1) : (RKHAioReq **)0;
+    if (slot == (RKHAioReq **)0)
+    {
+        req->result = -EBUSY;
+        reply(me, req);
+    }
+    else
+    {
+        *slot = req;
+        rkhport_io_watch(req->fd, 
+                         (req->op == RKH_AIO_READ) ? EPOLLIN : EPOLLOUT, 
+                         RKH_UPCAST(RKH_SMA_T, me), RKH_AIO_CQ_EVENT);
+    }
+}
+
+static void
+init(Aio *const me, RKH_EVT_T *pe)
+{
+    (void)pe;
+
+    RKH_TR_FWK_AO(me);
+    RKH_TR_FWK_STATE(me, &aioReady);
+    RKH_TR_FWK_SIG(RKH_AIO_REQ_EVENT);
+    RKH_TR_FWK_SIG(RKH_AIO_CQ_EVENT);
+
+    me->nInFlight = 0;
+    memset(me->pending, 0, sizeof(me->pending));
+    me->isUring = uringSetup(&me->ring);
+    if (me->isUring != 0)
+    {
+        rkhport_io_watch(me->ring.cqEvt, EPOLLIN, RKH_UPCAST(RKH_SMA_T, me), 
+                         RKH_AIO_CQ_EVENT);
+    }
+}
+
+static void
+request(Aio *const me, RKH_EVT_T *pe)
+{
+    RKHAioReq *req;
+
+    req = (RKHAioReq *)pe;
+    RKH_REQUIRE(req->client != (RKH_SMA_T *)0);
+    RKH_FWK_RSV(pe);    /* kept until the reply is posted */
+    ++me->nInFlight;
+    if (me->nInFlight > RKH_CFGPORT_AIO_ENTRIES)
+    {
+        req->result = -EBUSY;
+        reply(me, req);
+    }
+    else if (me->isUring != 0)
+    {
+        uringPrepare(&me->ring, req);
+        if (RKH_UPCAST(RKH_SMA_T, me)->equeue.qty == 0)
+        {
+            uringSubmit(me);
+        }
+    }
+    else
+    {
+        fallbackStart(me, req);
+    }
+}
+
+static void
+complete(Aio *const me, RKH_EVT_T *pe)
+{
+    RKHIoEvt *ioEvt;
+    RKHAioReq **slot;
+    RKHAioReq *req;
+
+    if (me->isUring != 0)
+    {
+        uringReap(me);
+        rkhport_io_rearm(me->ring.cqEvt);
+        uringSubmit(me);
+    }
+    else
+    {
+        ioEvt = (RKHIoEvt *)pe;
+        slot = findPending(me, ioEvt->fd);
+        RKH_ASSERT(slot != (RKHAioReq **)0);
+        rkhport_io_unwatch(ioEvt->fd);
+        req = *slot;
+        *slot = (RKHAioReq *)0;
+        transfer(req);
+        reply(me, req);
+    }
+}
+
+/* ---------------------------- Global functions --------------------------- */
+void
+rkhport_aio_start(const RKH_EVT_T **qs, RKH_QUENE_T qsize)
+{
+    RKH_SMA_ACTIVATE(rkhAio, qs, qsize, 0, 0);
+}
+
+rbool_t
+rkhport_aio_isUringUsed(void)
+{
+    return ((Aio *)rkhAio)->isUring;
+}
+
+/* ------------------------------ End of file ------------------------------ */
@@ -0,0 +1,168 @@
+/*
+ *  --------------------------------------------------------------------------
+ *
+ *                                Framework RKH
+ *                                -------------
+ *
+ *            State-machine framework for reactive embedded systems
+ *
+ *                      Copyright (C) 2010 Leandro Francucci.
+ *          All rights reserved. Protected by international copyright laws.
+ *
+ *
+ *  RKH is free software: you can redistribute it and/or modify it under the
+ *  terms of the GNU General Public License as published by the Free Software
+ *  Foundation, either version 3 of the License, or (at your option) any
+ *  later version.
+ *
+ *  RKH is distributed in the hope that it will be useful, but WITHOUT ANY
+ *  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with RKH, see copying.txt file.
+ *
+ *  Contact information:
+ *  RKH site: http://vortexmakes.com/que-es/
+ *  RKH GitHub: https://github.com/vortexmakes/RKH
+ *  RKH Sourceforge: https://sourceforge.net/projects/rkh-reactivesys/
+ *  e-mail: lf@vortexmakes.com
+ *  ---------------------------------------------------------------------------
+ */
+
+/**
+ *  \file       rkhport_aio.h
+ *  \brief      Asynchronous I/O service active object of Linux port.
+ *
+ *  \ingroup    port
+ */
+
+/* -------------------------- Development history -------------------------- */
+/*
+ *  2026.10.19  LeFr  v3.4.00  Initial version
+ */
+
+/* -------------------------------- Authors -------------------------------- */
+/*
+ *  LeFr  Leandro Francucci  lf@vortexmakes.com
+ */
+
+/* --------------------------------- Notes --------------------------------- */
+/*
+ *  Active objects request reads and writes by posting a RKHAioReq event,
+ *  usually a dynamic one, to rkhAio. The service submits them to the
+ *  kernel through io_uring and, when the operation completes, it posts the
+ *  very same event back to the requester with its reply signal, so that the
+ *  data buffer is never copied. If io_uring is not available, it falls
+ *  back to the epoll reactor of the port (see rkhport_io_watch()).
+ */
+
+/* --------------------------------- Module -------------------------------- */
+#ifndef __RKHPORT_AIO_H__
+#define __RKHPORT_AIO_H__
+
+/* ----------------------------- Include files ----------------------------- */
+#include "rkhsma.h"
+
+/* ---------------------- External C language linkage ---------------------- */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* --------------------------------- Macros -------------------------------- */
+/* -------------------------------- Constants ------------------------------ */
+/**
+ *  \brief
+ *  Signal of the I/O requests posted to rkhAio.
+ */
+#define RKH_AIO_REQ_EVENT           (RKH_ANY - 3)
+
+/**
+ *  \brief
+ *  Signal used internally by rkhAio to be notified about completions.
+ */
+#define RKH_AIO_CQ_EVENT            (RKH_ANY - 4)
+
+/**
+ *  \brief
+ *  Priority of the I/O service active object. It must not be used by any
+ *  other active object.
+ */
+#ifndef RKH_CFGPORT_AIO_PRIO
+#define RKH_CFGPORT_AIO_PRIO        RKH_LOWEST_PRIO
+#endif
+
+/**
+ *  \brief
+ *  Maximum number of I/O requests in flight, which is also the size of the
+ *  io_uring submission queue.
+ */
+#ifndef RKH_CFGPORT_AIO_ENTRIES
+#define RKH_CFGPORT_AIO_ENTRIES     32u
+#endif
+
+/* ------------------------------- Data types ------------------------------ */
+/**
+ *  \brief
+ *  I/O operations of a RKHAioReq.
+ */
+typedef enum RKHAioOp
+{
+    RKH_AIO_READ,
+    RKH_AIO_WRITE
+} RKHAioOp;
+
+/**
+ *  \brief
+ *  I/O request event. Its signal must be RKH_AIO_REQ_EVENT and it is
+ *  posted back to \c client with signal \c replySig when the operation
+ *  completes.
+ */
+typedef struct RKHAioReq RKHAioReq;
+struct RKHAioReq
+{
+    RKH_EVT_T evt;
+    RKHAioOp op;            /**< requested operation */
+    RKH_SMA_T *client;      /**< active object receiving the reply */
+    RKH_SIG_T replySig;     /**< signal of the reply */
+    int fd;                 /**< file descriptor */
+    rui8_t *buf;            /**< data buffer, owned by the client */
+    rui32_t size;           /**< number of bytes to transfer */
+    long long offset;       /**< file offset, or -1 to use the current one */
+    int result;             /**< transferred bytes or -errno, on reply */
+};
+
+/* -------------------------- External variables --------------------------- */
+RKH_SMA_DCLR(rkhAio);
+
+/* -------------------------- Function prototypes -------------------------- */
+/**
+ *  \brief
+ *  Activates the I/O service active object.
+ *
+ *  It tries to set up an io_uring instance, otherwise the requests are
+ *  served by means of the epoll reactor of the port.
+ *
+ *  \param[in] qs       base address of the event storage area.
+ *  \param[in] qsize    size of the storage event area [in number of
+ *                      entries].
+ */
+void rkhport_aio_start(const RKH_EVT_T **qs, RKH_QUENE_T qsize);
+
+/**
+ *  \brief
+ *  Evaluates to true if the requests are submitted through io_uring, or
+ *  false if the service fell back to the epoll reactor.
+ */
+rbool_t rkhport_aio_isUringUsed(void);
+
+/* -------------------- External C language linkage end -------------------- */
+#ifdef __cplusplus
+}
+#endif
+
+/* ------------------------------ Module end ------------------------------- */
+#endif
+
+/* ------------------------------ End of file ------------------------------ */
@@ -0,0 +1,220 @@
+/*
+ *  --------------------------------------------------------------------------
+ *
+ *                                Framework RKH
+ *                                -------------
+ *
+ *            State-machine framework for reactive embedded systems
+ *
+ *                      Copyright (C) 2010 Leandro Francucci.
+ *          All rights reserved. Protected by international copyright laws.
+ *
+ *
+ *  RKH is free software: you can redistribute it and/or modify it under the
+ *  terms of the GNU General Public License as published by the Free Software
+ *  Foundation, either version 3 of the License, or (at your option) any
+ *  later version.
+ *
+ *  RKH is distributed in the hope that it will be useful, but WITHOUT ANY
+ *  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with RKH, see copying.txt file.
+ *
+ *  Contact information:
+ *  RKH site: http://vortexmakes.com/que-es/
+ *  RKH GitHub: https://github.com/vortexmakes/RKH
+ *  RKH Sourceforge: https://sourceforge.net/projects/rkh-reactivesys/
+ *  e-mail: lf@vortexmakes.com
+ *  ---------------------------------------------------------------------------
+ */
+
+
+/**
+ *  \file       rkhport_mem.c
+ *  \brief      Memory-locked and pre-faulted startup of Linux port.
+ *
+ *  \ingroup    port
+ */
+
+/* -------------------------- Development history -------------------------- */
+/*
+ *  2026.10.19  LeFr  v3.4.00  Initial version
+ */
+
+/* -------------------------------- Authors -------------------------------- */
+/*
+ *  LeFr  Leandro Francucci  lf@vortexmakes.com
+ */
+
+/* --------------------------------- Notes --------------------------------- */
+/*
+ *  mlockall(MCL_CURRENT) already populates every mapped page, including 
+ *  the trace stream, but it requires CAP_IPC_LOCK or a large enough 
+ *  RLIMIT_MEMLOCK. Hence, pools and queues are pre-faulted explicitly, so 
+ *  that they are warm even if the memory could not be locked.
+ *
+ *  Pages are touched by writing back the value just read, within a 
+ *  critical section, thus the free lists of the pools are preserved.
+ */
+
+/* ----------------------------- Include files ----------------------------- */
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include "rkh.h"
+#include "rkhfwk_dynevt.h"
+#include "rkhport_mem.h"
+
+/* ----------------------------- Local macros ------------------------------ */
+/* ------------------------------- Constants ------------------------------- */
+#define HUGE_PAGE_SIZE      (2u * 1024u * 1024u)
+
+/* ---------------------------- Local data types --------------------------- */
+/* ---------------------------- Global variables --------------------------- */
+/* ---------------------------- Local variables ---------------------------- */
+/* ----------------------- Local function prototypes ----------------------- */
+/* ---------------------------- Local functions ---------------------------- */
+static void
+prefault(void *start, size_t size)
+{
+    volatile rui8_t *p, *end;
+    size_t pageSize;
+    RKH_SR_ALLOC();
+
+    if ((start == (void *)0) || (size == 0))
+    {
+        return;
+    }
+    pageSize = (size_t)sysconf(_SC_PAGESIZE);
+    p = (volatile rui8_t *)start;
+    end = p + size;
+    RKH_ENTER_CRITICAL_();
+    for (; p < end; p += pageSize)
+    {
+        *p = *p;
+    }
+    *(end - 1) = *(end - 1);
+    RKH_EXIT_CRITICAL_();
+}
+
+static void __attribute__((noinline))
+prefaultStack(void)
+{
+    volatile rui8_t stk[RKH_CFGPORT_MEM_STK_PREFAULT_SIZE];
+
+    memset((void *)stk, 0, sizeof(stk));
+}
+
+/* ---------------------------- Global functions --------------------------- */
+void *
+rkhport_mem_allocPool(rui32_t size)
+{
+    void *p;
+
+#if RKH_CFGPORT_MEM_HUGE_PAGES_EN == RKH_ENABLED
+    size_t len, head;
+    rui8_t *base;
+
+    len = ((size_t)size + HUGE_PAGE_SIZE - 1) & ~(size_t)(HUGE_PAGE_SIZE - 1);
+    p = mmap(NULL, len, PROT_READ | PROT_WRITE, 
+             MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (p != MAP_FAILED)
+    {
+        return p;
+    }
+
+    /* No reserved huge pages, falls back to transparent ones */
+    p = mmap(NULL, len + HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE, 
+             MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p == MAP_FAILED)
+    {
+        return (void *)0;
+    }
+
+    /* Trims the slack around the aligned region, so that the pool is */
+    /* the whole mapping and it can be released as any other one */
+    base = (rui8_t *)p;
+    head = (size_t)(-(uintptr_t)base & (uintptr_t)(HUGE_PAGE_SIZE - 1));
+    if (head != 0)
+    {
+        (void)munmap(base, head);
+    }
+    (void)munmap(base + head + len, HUGE_PAGE_SIZE - head);
+    p = (void *)(base + head);
+    (void)madvise(p, len, MADV_HUGEPAGE);
+#else
+    p = mmap(NULL, (size_t)size, PROT_READ | PROT_WRITE, 
+             MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p == MAP_FAILED)
+    {
+        return (void *)0;
+    }
+#endif
+    return p;
+}
+
+int
+rkhport_mem_lock(void)
+{
+    int result;
+    rui8_t pool;
+    rui16_t prio;
+    void *sstart;
+    rui32_t ssize;
+    RKH_SMA_T *sma;
+
+    result = 0;
+    if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0)
+    {
+        result = errno;
+    }
+
+    for (pool = 0; rkh_fwk_getEvtPoolStorage(pool, &sstart, &ssize); ++pool)
+    {
+        prefault(sstart, ssize);
+    }
+
+    for (prio = 0; prio < RKH_CFG_FWK_MAX_SMA; ++prio)
+    {
+        sma = rkh_sptbl[prio];
+        if (sma != (RKH_SMA_T *)0)
+        {
+            prefault((void *)sma->equeue.pstart, 
+                     sma->equeue.nelems * sizeof(void *));
+        }
+    }
+
+    prefaultStack();
+    return result;
+}
+
+rui32_t
+rkhport_mem_getLocked(void)
+{
+    FILE *file;
+    char line[128];
+    unsigned long kb;
+
+    kb = 0;
+    file = fopen("/proc/self/status", "r");
+    if (file != (FILE *)0)
+    {
+        while (fgets(line, sizeof(line), file) != (char *)0)
+        {
+            if (sscanf(line, "VmLck: %lu kB", &kb) == 1)
+            {
+                break;
+            }
+        }
+        fclose(file);
+    }
+    return (rui32_t)(kb * 1024u);
+}
+
+/* ------------------------------ End of file ------------------------------ */
@@ -0,0 +1,141 @@
+/*
+ *  --------------------------------------------------------------------------
+ *
+ *                                Framework RKH
+ *                                -------------
+ *
+ *            State-machine framework for reactive embedded systems
+ *
+ *                      Copyright (C) 2010 Leandro Francucci.
+ *          All rights reserved. Protected by international copyright laws.
+ *
+ *
+ *  RKH is free software: you can redistribute it and/or modify it under the
+ *  terms of the GNU General Public License as published by the Free Software
+ *  Foundation, either version 3 of the License, or (at your option) any
+ *  later version.
+ *
+ *  RKH is distributed in the hope that it will be useful, but WITHOUT ANY
+ *  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with RKH, see copying.txt file.
+ *
+ *  Contact information:
+ *  RKH site: http://vortexmakes.com/que-es/
+ *  RKH GitHub: https://github.com/vortexmakes/RKH
+ *  RKH Sourceforge: https://sourceforge.net/projects/rkh-reactivesys/
+ *  e-mail: lf@vortexmakes.com
+ *  ---------------------------------------------------------------------------
+ */
+
+
+/**
+ *  \file       rkhport_mem.h
+ *  \brief      Memory-locked and pre-faulted startup of Linux port.
+ *
+ *  \ingroup    port
+ */
+
+/* -------------------------- Development history -------------------------- */
+/*
+ *  2026.10.19  LeFr  v3.4.00  Initial version
+ */
+
+/* -------------------------------- Authors -------------------------------- */
+/*
+ *  LeFr  Leandro Francucci  lf@vortexmakes.com
+ */
+
+/* --------------------------------- Notes --------------------------------- */
+/*
+ *  The first access to every page of event pools, event queues, trace 
+ *  stream and stacks causes a page fault, which produces latency spikes 
+ *  until the application has touched all of them. To avoid it, call 
+ *  rkhport_mem_lock() once every event pool is registered and every active 
+ *  object is activated, just before rkh_fwk_enter(). It locks the whole 
+ *  address space of the process and pre-faults the storage of event pools 
+ *  and queues, and a region of the stack.
+ *
+ *  Optionally, the storage of event pools can be allocated by means of 
+ *  rkhport_mem_allocPool(), which backs it with huge pages if 
+ *  RKH_CFGPORT_MEM_HUGE_PAGES_EN is enabled.
+ */
+
+/* --------------------------------- Module -------------------------------- */
+#ifndef __RKHPORT_MEM_H__
+#define __RKHPORT_MEM_H__
+
+/* ----------------------------- Include files ----------------------------- */
+#include "rkhtype.h"
+
+/* ---------------------- External C language linkage ---------------------- */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* --------------------------------- Macros -------------------------------- */
+/* -------------------------------- Constants ------------------------------ */
+/**
+ *  \brief
+ *  If the RKH_CFGPORT_MEM_HUGE_PAGES_EN is set to 1, rkhport_mem_allocPool()
+ *  tries to back the event pool storage with huge pages, first explicitly 
+ *  and then as transparent huge pages.
+ */
+#ifndef RKH_CFGPORT_MEM_HUGE_PAGES_EN
+#define RKH_CFGPORT_MEM_HUGE_PAGES_EN       RKH_DISABLED
+#endif
+
+/**
+ *  \brief
+ *  Size of the stack region pre-faulted by rkhport_mem_lock() [in bytes].
+ */
+#ifndef RKH_CFGPORT_MEM_STK_PREFAULT_SIZE
+#define RKH_CFGPORT_MEM_STK_PREFAULT_SIZE   (64u * 1024u)
+#endif
+
+/* ------------------------------- Data types ------------------------------ */
+/* -------------------------- External variables --------------------------- */
+/* -------------------------- Function prototypes -------------------------- */
+/**
+ *  \brief
+ *  Allocates the storage of an event pool, to be registered by means of 
+ *  rkh_fwk_registerEvtPool().
+ *
+ *  \param[in] size     storage size in bytes.
+ *
+ *  \return
+ *  The storage start or NULL if it could not be allocated.
+ */
+void *rkhport_mem_allocPool(rui32_t size);
+
+/**
+ *  \brief
+ *  Locks the current and future pages of the process in memory and 
+ *  pre-faults the storage of registered event pools, event queues of 
+ *  active objects and a region of the stack.
+ *
+ *  \return
+ *  Zero if the memory was locked, otherwise the error number of mlockall(). 
+ *  Either way, the storage is pre-faulted.
+ */
+int rkhport_mem_lock(void);
+
+/**
+ *  \brief
+ *  Retrieves the total locked memory of the process [in bytes], as 
+ *  reported by the kernel.
+ */
+rui32_t rkhport_mem_getLocked(void);
+
+/* -------------------- External C language linkage end -------------------- */
+#ifdef __cplusplus
+}
+#endif
+
+/* ------------------------------ Module end ------------------------------- */
+#endif
+
+/* ------------------------------ End of file ------------------------------ */
@@ -0,0 +1,529 @@
+/*
+ *  --------------------------------------------------------------------------
+ *
+ *                                Framework RKH
+ *                                -------------
+ *
+ *            State-machine framework for reactive embedded systems
+ *
+ *                      Copyright (C) 2010 Leandro Francucci.
+ *          All rights reserved. Protected by international copyright laws.
+ *
+ *
+ *  RKH is free software: you can redistribute it and/or modify it under the
+ *  terms of the GNU General Public License as published by the Free Software
+ *  Foundation, either version 3 of the License, or (at your option) any
+ *  later version.
+ *
+ *  RKH is distributed in the hope that it will be useful, but WITHOUT ANY
+ *  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with RKH, see copying.txt file.
+ *
+ *  Contact information:
+ *  RKH site: http://vortexmakes.com/que-es/
+ *  RKH GitHub: https://github.com/vortexmakes/RKH
+ *  RKH Sourceforge: https://sourceforge.net/projects/rkh-reactivesys/
+ *  e-mail: lf@vortexmakes.com
+ *  ---------------------------------------------------------------------------
+ */
+
+
+/**
+ *  \file       rkhport_rec.c
+ *  \brief      Event recorder and replay driver of Linux port.
+ *
+ *  \ingroup    port
+ */
+
+/* -------------------------- Development history -------------------------- */
+/*
+ *  2026.10.19  LeFr  v3.4.00  Initial version
+ */
+
+/* -------------------------------- Authors -------------------------------- */
+/*
+ *  LeFr  Leandro Francucci  lf@vortexmakes.com
+ */
+
+/* --------------------------------- Notes --------------------------------- */
+/*
+ *  Under RKH_REPLAY_FAST, rkhReplay posts RKH_REPLAY_NEXT_EVENT to itself 
+ *  after injecting an event. Since it has the lowest priority, it is 
+ *  dispatched only when the event and every event it produced have been 
+ *  processed, so the replay is deterministic regardless of the host load.
+ *  Under RKH_REPLAY_RECORDED, it arms a timerfd, watched by the epoll 
+ *  reactor of the port, to the recorded time of the next event.
+ *
+ *  The timer events are not logged, since they are produced again by 
+ *  ticking the timers at the recorded ticks. That is why the tick source 
+ *  is gated off while replaying. Note that the log keeps the order in 
+ *  which the ticks and the external events occurred, but not the progress 
+ *  of the scheduler meanwhile: an event still being processed when a tick 
+ *  was recorded is completely processed before that tick is replayed.
+ */
+
+/* ----------------------------- Include files ----------------------------- */
+#include <errno.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
+
+#include "rkh.h"
+#include "rkhfwk_dynevt.h"
+#include "rkhfwk_evtser.h"
+#include "rkhport_rec.h"
+
+#if RKH_CFG_FWK_MAX_SER_SIGNALS > 0
+
+/* ----------------------------- Local macros ------------------------------ */
+/* ------------------------------- Constants ------------------------------- */
+RKH_MODULE_NAME(rkhport_rec)
+
+#define REC_MAGIC           "RKHR"
+#define REC_VERSION         2u
+#define REC_HEADER_SIZE     5u
+#define REC_BUF_SIZE        (64u * 1024u)
+#define REC_VARINT_SIZE     10u     /* of a 64-bit number */
+#define REC_HEADER_MAX      (REC_VARINT_SIZE + 1u + REC_VARINT_SIZE)
+
+/* ---------------------------- Local data types --------------------------- */
+typedef struct Record Record;
+struct Record
+{
+    uint64_t time;          /* since the beginning of the log [usec] */
+    rui8_t prio;
+    rui32_t size;           /* zero for a tick */
+    rui8_t evt[RKH_CFGPORT_REC_EVT_SIZE];
+};
+
+#if RKH_CFG_FWK_DYN_EVT_EN == RKH_ENABLED
+typedef struct Replay Replay;
+struct Replay
+{
+    RKH_SMA_T base;
+    FILE *log;
+    RKHReplayMode mode;
+    int timer;
+    rbool_t isPending;      /* next record is already read */
+    Record next;
+    uint64_t now;           /* virtual clock [usec] */
+    rui32_t nEvents;
+    struct timespec start;
+};
+#endif
+
+/* ---------------------------- Local variables ---------------------------- */
+static FILE *recLog;
+static struct timespec recLast;
+static char recBuf[REC_BUF_SIZE];
+static rbool_t ticking;
+static pthread_t ticker;
+
+#if RKH_CFG_FWK_DYN_EVT_EN == RKH_ENABLED
+static void init(Replay *const me, RKH_EVT_T *pe);
+static void next(Replay *const me, RKH_EVT_T *pe);
+static void expire(Replay *const me, RKH_EVT_T *pe);
+
+static RKH_EVT_T nextEvt;
+
+RKH_DCLR_BASIC_STATE replaying;
+
+RKH_CREATE_BASIC_STATE(replaying, NULL, NULL, RKH_ROOT, NULL);
+RKH_CREATE_TRANS_TABLE(replaying)
+    RKH_TRINT(RKH_REPLAY_NEXT_EVENT, NULL, next),
+    RKH_TRINT(RKH_REPLAY_TIMER_EVENT, NULL, expire),
+RKH_END_TRANS_TABLE
+
+RKH_SMA_CREATE(Replay, rkhReplay, RKH_CFGPORT_REPLAY_PRIO, HCAL, &replaying, 
+               init, NULL);
+#endif
+
+/* ---------------------------- Global variables --------------------------- */
+#if RKH_CFG_FWK_DYN_EVT_EN == RKH_ENABLED
+RKH_SMA_DEF_PTR(rkhReplay);
+#endif
+
+/* ----------------------- Local function prototypes ----------------------- */
+/* ---------------------------- Local functions ---------------------------- */
+static rui32_t
+putVarint(rui8_t *buf, uint64_t value)
+{
+    rui32_t n;
+
+    n = 0;
+    do
+    {
+        buf[n++] = (rui8_t)((value & 0x7f) | ((value > 0x7f) ? 0x80 : 0));
+        value >>= 7;
+    }
+    while (value != 0);
+    return n;
+}
+
+static uint64_t
+elapsedUsec(const struct timespec *from, const struct timespec *to)
+{
+    return (uint64_t)((int64_t)(to->tv_sec - from->tv_sec) * 1000000 + 
+                      (to->tv_nsec - from->tv_nsec) / 1000);
+}
+
+/* Must be called within a critical section */
+static void
+writeRecord(rui8_t prio, rui8_t *record, rui32_t size)
+{
+    rui8_t header[REC_HEADER_MAX];
+    rui32_t n;
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    n = putVarint(header, elapsedUsec(&recLast, &now));
+    recLast = now;
+    header[n++] = prio;
+    n += putVarint(&header[n], size);
+    fwrite(header, 1, n, recLog);
+    if (size != 0)
+    {
+        fwrite(record, 1, size, recLog);
+    }
+}
+
+static rbool_t
+isTicking(void)
+{
+    return ticking && pthread_equal(pthread_self(), ticker);
+}
+
+#if RKH_CFG_FWK_DYN_EVT_EN == RKH_ENABLED
+static rbool_t
+getVarint(FILE *log, uint64_t *value)
+{
+    int c;
+    rui8_t shift;
+
+    for (*value = 0, shift = 0; shift < 70; shift += 7)
+    {
+        c = fgetc(log);
+        if (c == EOF)
+        {
+            return RKH_FALSE;
+        }
+        *value |= (uint64_t)(c & 0x7f) << shift;
+        if ((c & 0x80) == 0)
+        {
+            return RKH_TRUE;
+        }
+    }
+    return RKH_FALSE;
+}
+
+static rbool_t
+readRecord(Replay *const me)
+{
+    uint64_t delta, size;
+    int prio;
+
+    me->isPending = RKH_FALSE;
+    if (!getVarint(me->log, &delta) || 
+        ((prio = fgetc(me->log)) == EOF) ||
+        !getVarint(me->log, &size) ||
+        (size > RKH_CFGPORT_REC_EVT_SIZE) ||
+        (fread(me->next.evt, 1, (size_t)size, me->log) != size))
+    {
+        return RKH_FALSE;
+    }
+    me->next.time = me->now + delta;
+    me->next.prio = (rui8_t)prio;
+    me->next.size = (rui32_t)size;
+    me->isPending = RKH_TRUE;
+    return RKH_TRUE;
+}
+
+static void
+inject(Replay *const me)
+{
+    RKH_SIG_T signal;
+    RKH_ES_T size;
+    RKH_EVT_T *e;
+    RKH_SMA_T *ao;
+
+    me->now = me->next.time;
+    if (me->next.size == 0)
+    {
+        RKH_TIM_TICK(me);
+        return;
+    }
+    ao = (me->next.prio < RKH_CFG_FWK_MAX_SMA) ? rkh_sptbl[me->next.prio] : 
+                                                  (RKH_SMA_T *)0;
+    if ((ao == (RKH_SMA_T *)0) || 
+        (rkh_evtser_getSig(me->next.evt, me->next.size, &signal) == 0))
+    {
+        return;
+    }
+
+    size = rkh_evtser_getEvtSize(signal);
+    if (size == 0)      /* only its signal was recorded */
+    {
+        e = rkh_fwk_ae((RKH_ES_T)sizeof(RKH_EVT_T), signal, me);
+    }
+    else
+    {
+        e = rkh_fwk_ae(size, signal, me);
+        if (rkh_evtser_decode(me->next.evt, me->next.size, e) == 0)
+        {
+            RKH_FWK_GC(e, me);
+            return;
+        }
+    }
+    ++me->nEvents;
+    RKH_SMA_POST_FIFO(ao, e, me);
+}
+
+static void
+schedule(Replay *const me)
+{
+    struct itimerspec at;
+    struct timespec now;
+
+    if (!me->isPending)
+    {
+        RKH_SMA_POST_FIFO(RKH_UPCAST(RKH_SMA_T, me), &nextEvt, me);
+        return;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    if ((me->mode == RKH_REPLAY_FAST) || 
+        (elapsedUsec(&me->start, &now) >= me->next.time))
+    {
+        RKH_SMA_POST_FIFO(RKH_UPCAST(RKH_SMA_T, me), &nextEvt, me);
+    }
+    else
+    {
+        memset(&at, 0, sizeof(at));
+        at.it_value.tv_sec = me->start.tv_sec + me->next.time / 1000000L;
+        at.it_value.tv_nsec = me->start.tv_nsec + 
+                              (me->next.time % 1000000L) * 1000L;
+        if (at.it_value.tv_nsec >= 1000000000L)
+        {
+            ++at.it_value.tv_sec;
+            at.it_value.tv_nsec -= 1000000000L;
+        }
+        timerfd_settime(me->timer, TFD_TIMER_ABSTIME, &at, 
+                        (struct itimerspec *)0);
+    }
+}
+
+static void
+init(Replay *const me, RKH_EVT_T *pe)
+{
+    (void)pe;
+
+    RKH_TR_FWK_AO(me);
+    RKH_TR_FWK_STATE(me, &replaying);
+    RKH_TR_FWK_SIG(RKH_REPLAY_NEXT_EVENT);
+    RKH_TR_FWK_SIG(RKH_REPLAY_TIMER_EVENT);
+
+    RKH_SET_STATIC_EVENT(&nextEvt, RKH_REPLAY_NEXT_EVENT);
+    if (me->mode == RKH_REPLAY_RECORDED)
+    {
+        rkhport_io_watch(me->timer, EPOLLIN, RKH_UPCAST(RKH_SMA_T, me), 
+                         RKH_REPLAY_TIMER_EVENT);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &me->start);
+    (void)readRecord(me);
+    schedule(me);
+}
+
+static void
+next(Replay *const me, RKH_EVT_T *pe)
+{
+    (void)pe;
+
+    if (!me->isPending)     /* log exhausted and everything processed */
+    {
+        fclose(me->log);
+        me->log = (FILE *)0;
+        if (me->mode == RKH_REPLAY_RECORDED)
+        {
+            rkhport_io_unwatch(me->timer);
+            close(me->timer);
+        }
+        rkhport_fwk_stop();
+        return;
+    }
+    inject(me);
+    (void)readRecord(me);
+    schedule(me);
+}
+
+static void
+expire(Replay *const me, RKH_EVT_T *pe)
+{
+    uint64_t nExpirations;
+
+    (void)read(me->timer, &nExpirations, sizeof(nExpirations));
+    rkhport_io_rearm(me->timer);
+    next(me, pe);
+}
+#endif
+
+/* ---------------------------- Global functions --------------------------- */
+int
+rkhport_rec_start(const char *path)
+{
+    RKH_REQUIRE((path != (const char *)0) && (recLog == (FILE *)0));
+    recLog = fopen(path, "wb");
+    if (recLog == (FILE *)0)
+    {
+        return errno;
+    }
+    setvbuf(recLog, recBuf, _IOFBF, sizeof(recBuf));
+    fwrite(REC_MAGIC, 1, 4, recLog);
+    fputc(REC_VERSION, recLog);
+    clock_gettime(CLOCK_MONOTONIC, &recLast);
+    return 0;
+}
+
+void
+rkhport_rec_stop(void)
+{
+    FILE *log;
+    RKH_SR_ALLOC();
+
+    RKH_ENTER_CRITICAL_();
+    log = recLog;
+    recLog = (FILE *)0;
+    RKH_EXIT_CRITICAL_();
+    if (log != (FILE *)0)
+    {
+        fclose(log);
+    }
+}
+
+void
+rkhport_rec_post(const RKH_SMA_T *me, const RKH_EVT_T *e)
+{
+    rui8_t record[RKH_CFGPORT_REC_EVT_SIZE];
+    rui32_t size;
+    RKH_SR_ALLOC();
+
+    /* 
+     * The readiness events are owned by the port and carry file descriptors 
+     * of the recording session, so they are neither logged nor replayed.
+     */
+    if ((recLog == (FILE *)0) || rkhport_isDispatching() || isTicking() ||
+        rkhport_io_isEvt(e))
+    {
+        return;
+    }
+
+    size = rkh_evtser_encode(e, record, RKH_CFGPORT_REC_EVT_SIZE);
+    if (size == 0)      /* without layout, only its signal is logged */
+    {
+        size = putVarint(record, (uint64_t)e->e);
+    }
+
+    RKH_ENTER_CRITICAL_();
+    if (recLog != (FILE *)0)
+    {
+        writeRecord(RKH_GET_PRIO(me), record, size);
+    }
+    RKH_EXIT_CRITICAL_();
+}
+
+void
+rkhport_rec_tick(const void *const sender)
+{
+    RKH_SR_ALLOC();
+
+    (void)sender;
+#if RKH_CFG_FWK_DYN_EVT_EN == RKH_ENABLED
+    if (((Replay *)rkhReplay)->log != (FILE *)0)
+    {
+        return;         /* the replay driver ticks the timers */
+    }
+#endif
+
+    /* 
+     * The critical section is recursive in this port, hence no event is 
+     * logged between the tick and the timeouts it produces.
+     */
+    RKH_ENTER_CRITICAL_();
+    if (recLog != (FILE *)0)
+    {
+        writeRecord(0, (rui8_t *)0, 0);
+    }
+    ticker = pthread_self();
+    ticking = RKH_TRUE;
+    RKH_TIM_TICK(sender);
+    ticking = RKH_FALSE;
+    RKH_EXIT_CRITICAL_();
+}
+
+#if RKH_CFG_FWK_DYN_EVT_EN == RKH_ENABLED
+int
+rkhport_replay_start(const char *path, RKHReplayMode mode, 
+                     const RKH_EVT_T **qs, RKH_QUENE_T qsize)
+{
+    Replay *me;
+    char header[REC_HEADER_SIZE];
+    int result;
+
+    RKH_REQUIRE(path != (const char *)0);
+    me = (Replay *)rkhReplay;
+    me->log = fopen(path, "rb");
+    if (me->log == (FILE *)0)
+    {
+        return errno;
+    }
+    if ((fread(header, 1, REC_HEADER_SIZE, me->log) != REC_HEADER_SIZE) ||
+        (memcmp(header, REC_MAGIC, 4) != 0) || 
+        (header[4] != REC_VERSION))
+    {
+        fclose(me->log);
+        me->log = (FILE *)0;
+        return EPROTO;
+    }
+    if (mode == RKH_REPLAY_RECORDED)
+    {
+        me->timer = timerfd_create(CLOCK_MONOTONIC, 
+                                   TFD_NONBLOCK | TFD_CLOEXEC);
+        if (me->timer < 0)
+        {
+            result = errno;
+            fclose(me->log);
+            me->log = (FILE *)0;
+            return result;
+        }
+    }
+    me->mode = mode;
+    me->now = 0;
+    me->nEvents = 0;
+    RKH_SMA_ACTIVATE(rkhReplay, qs, qsize, 0, 0);
+    return 0;
+}
+
+uint64_t
+rkhport_replay_getTime(void)
+{
+    return ((Replay *)rkhReplay)->now;
+}
+
+rui32_t
+rkhport_replay_getNumEvents(void)
+{
+    return ((Replay *)rkhReplay)->nEvents;
+}
+#endif
+
+#endif
+
+/* ------------------------------ End of file ------------------------------ */
@@ -0,0 +1,219 @@
+/*
+ *  --------------------------------------------------------------------------
+ *
+ *                                Framework RKH
+ *                                -------------
+ *
+ *            State-machine framework for reactive embedded systems
+ *
+ *                      Copyright (C) 2010 Leandro Francucci.
+ *          All rights reserved. Protected by international copyright laws.
+ *
+ *
+ *  RKH is free software: you can redistribute it and/or modify it under the
+ *  terms of the GNU General Public License as published by the Free Software
+ *  Foundation, either version 3 of the License, or (at your option) any
+ *  later version.
+ *
+ *  RKH is distributed in the hope that it will be useful, but WITHOUT ANY
+ *  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with RKH, see copying.txt file.
+ *
+ *  Contact information:
+ *  RKH site: http://vortexmakes.com/que-es/
+ *  RKH GitHub: https://github.com/vortexmakes/RKH
+ *  RKH Sourceforge: https://sourceforge.net/projects/rkh-reactivesys/
+ *  e-mail: lf@vortexmakes.com
+ *  ---------------------------------------------------------------------------
+ */
+
+
+/**
+ *  \file       rkhport_rec.h
+ *  \brief      Event recorder and replay driver of Linux port.
+ *
+ *  \ingroup    port
+ */
+
+/* -------------------------- Development history -------------------------- */
+/*
+ *  2026.10.19  LeFr  v3.4.00  Initial version
+ */
+
+/* -------------------------------- Authors -------------------------------- */
+/*
+ *  LeFr  Leandro Francucci  lf@vortexmakes.com
+ */
+
+/* --------------------------------- Notes --------------------------------- */
+/*
+ *  The recorder logs every external event, i.e. posted by a hook or another 
+ *  thread rather than by an active object being dispatched, together with 
+ *  its consumer and its timestamp. It is fed from the post hook:
+ *
+ *  \code
+ *  void
+ *  rkh_hook_post(const RKH_SMA_T *me, const RKH_EVT_T *e)
+ *  {
+ *      rkhport_rec_post(me, e);
+ *  }
+ *  \endcode
+ *
+ *  The timer events are not logged, the ticks are logged instead. Thus, the 
+ *  tick source must call rkhport_rec_tick() in place of RKH_TIM_TICK().
+ *
+ *  Events are encoded by means of rkh_evtser_encode(), thus their signals 
+ *  should have a registered layout, otherwise only the signal is logged 
+ *  and the event is replayed as a bare RKH_EVT_T. The readiness events of 
+ *  the I/O reactor, see rkhport_io_watch(), are not logged.
+ *  The log is a binary file made up of a header, "RKHR" and a version 
+ *  byte, followed by one record per event or tick: the time elapsed since 
+ *  the previous record [in microseconds] as an unsigned LEB128 number of 
+ *  up to 64 bits, the priority of the consumer, the size of the encoded 
+ *  event as an unsigned LEB128 number and the encoded event. A tick is a 
+ *  record of size zero.
+ *
+ *  The replay driver, the rkhReplay active object, feeds the log back to 
+ *  the same active objects under a virtual clock. It must have the lowest 
+ *  priority, so that an event is injected once the previous one has been 
+ *  completely processed. Meanwhile, rkhport_rec_tick() does not tick the 
+ *  timers, the replay driver does it at the recorded ticks instead, so 
+ *  that the timeouts are produced in the same order as they were 
+ *  recorded. When the log is exhausted, the framework is stopped.
+ */
+
+/* --------------------------------- Module -------------------------------- */
+#ifndef __RKHPORT_REC_H__
+#define __RKHPORT_REC_H__
+
+/* ----------------------------- Include files ----------------------------- */
+#include <stdint.h>
+#include "rkhsma.h"
+
+/* ---------------------- External C language linkage ---------------------- */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* --------------------------------- Macros -------------------------------- */
+/* -------------------------------- Constants ------------------------------ */
+/**
+ *  \brief
+ *  Signals used internally by rkhReplay.
+ */
+#define RKH_REPLAY_NEXT_EVENT       (RKH_ANY - 6)
+#define RKH_REPLAY_TIMER_EVENT      (RKH_ANY - 7)
+
+/**
+ *  \brief
+ *  Priority of the replay driver active object. It must be the lowest one 
+ *  and it must not be used by any other active object.
+ */
+#ifndef RKH_CFGPORT_REPLAY_PRIO
+#define RKH_CFGPORT_REPLAY_PRIO     RKH_LOWEST_PRIO
+#endif
+
+/**
+ *  \brief
+ *  Maximum size of an encoded event [in bytes].
+ */
+#ifndef RKH_CFGPORT_REC_EVT_SIZE
+#define RKH_CFGPORT_REC_EVT_SIZE    256u
+#endif
+
+/* ------------------------------- Data types ------------------------------ */
+/**
+ *  \brief
+ *  Pace of the replay.
+ */
+typedef enum RKHReplayMode
+{
+    RKH_REPLAY_FAST,        /**< next event as soon as the system is idle */
+    RKH_REPLAY_RECORDED     /**< events at their recorded time */
+} RKHReplayMode;
+
+/* -------------------------- External variables --------------------------- */
+RKH_SMA_DCLR(rkhReplay);
+
+/* -------------------------- Function prototypes -------------------------- */
+/**
+ *  \brief
+ *  Creates a log and starts recording.
+ *
+ *  \param[in] path     path of the log.
+ *
+ *  \return
+ *  Zero on success, otherwise an error number.
+ */
+int rkhport_rec_start(const char *path);
+
+/**
+ *  \brief
+ *  Stops recording and closes the log.
+ */
+void rkhport_rec_stop(void);
+
+/**
+ *  \brief
+ *  Logs a posted event if it is an external one and the recorder is 
+ *  started. Frequently, it is called from rkh_hook_post().
+ *
+ *  \param[in] me       consumer active object.
+ *  \param[in] e        posted event.
+ */
+void rkhport_rec_post(const RKH_SMA_T *me, const RKH_EVT_T *e);
+
+/**
+ *  \brief
+ *  Ticks the system timers and logs the tick if the recorder is started. 
+ *  It does nothing while replaying, since the replay driver ticks the 
+ *  timers by itself. It is called in place of RKH_TIM_TICK().
+ *
+ *  \param[in] sender  pointer to the object that ticks the timers.
+ */
+void rkhport_rec_tick(const void *const sender);
+
+/**
+ *  \brief
+ *  Opens a log and activates the replay driver active object.
+ *
+ *  \param[in] path     path of the log.
+ *  \param[in] mode     pace of the replay.
+ *  \param[in] qs       base address of the event storage area.
+ *  \param[in] qsize    size of the storage event area [in number of
+ *                      entries].
+ *
+ *  \return
+ *  Zero on success, otherwise an error number, i.e. EPROTO if \a path is 
+ *  not a log.
+ */
+int rkhport_replay_start(const char *path, RKHReplayMode mode, 
+                         const RKH_EVT_T **qs, RKH_QUENE_T qsize);
+
+/**
+ *  \brief
+ *  Retrieves the virtual clock of the replay, i.e. the recorded time of 
+ *  the last injected event or tick [in microseconds since the beginning 
+ *  of the log].
+ */
+uint64_t rkhport_replay_getTime(void);
+
+/**
+ *  \brief
+ *  Retrieves the number of events injected by the replay driver.
+ */
+rui32_t rkhport_replay_getNumEvents(void);
+
+/* -------------------- External C language linkage end -------------------- */
+#ifdef __cplusplus
+}
+#endif
+
+/* ------------------------------ Module end ------------------------------- */
+#endif
+
+/* ------------------------------ End of file ------------------------------ */
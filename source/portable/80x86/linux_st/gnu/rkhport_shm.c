@@ -0,0 +1,644 @@
+/*
+ *  --------------------------------------------------------------------------
+ *
+ *                                Framework RKH
+ *                                -------------
+ *
+ *            State-machine framework for reactive embedded systems
+ *
+ *                      Copyright (C) 2010 Leandro Francucci.
+ *          All rights reserved. Protected by international copyright laws.
+ *
+ *
+ *  RKH is free software: you can redistribute it and/or modify it under the
+ *  terms of the GNU General Public License as published by the Free Software
+ *  Foundation, either version 3 of the License, or (at your option) any
+ *  later version.
+ *
+ *  RKH is distributed in the hope that it will be useful, but WITHOUT ANY
+ *  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with RKH, see copying.txt file.
+ *
+ *  Contact information:
+ *  RKH site: http://vortexmakes.com/que-es/
+ *  RKH GitHub: https://github.com/vortexmakes/RKH
+ *  RKH Sourceforge: https://sourceforge.net/projects/rkh-reactivesys/
+ *  e-mail: lf@vortexmakes.com
+ *  ---------------------------------------------------------------------------
+ */
+
+
+/**
+ *  \file       rkhport_shm.c
+ *  \brief      Cross-process active objects over shared-memory rings of 
+ *              Linux port.
+ *
+ *  \ingroup    port
+ */
+
+/* -------------------------- Development history -------------------------- */
+/*
+ *  2026.10.19  LeFr  v3.4.00  Initial version
+ */
+
+/* -------------------------------- Authors -------------------------------- */
+/*
+ *  LeFr  Leandro Francucci  lf@vortexmakes.com
+ */
+
+/* --------------------------------- Notes --------------------------------- */
+/*
+ *  Every ring is a bounded multi-producer single-consumer queue: each slot 
+ *  carries a sequence number, so that producers of several processes claim 
+ *  slots with a single compare-and-swap and publish them with a release 
+ *  store, without any lock shared between processes.
+ *
+ *  The receiver is woken up through a FIFO next to the segment, 
+ *  /dev/shm/<name>.wake. A producer writes it only if the notified flag of 
+ *  the ring was clear, thus a burst of events costs a single system call. 
+ *  The receiver clears the flag before draining the ring, hence an event 
+ *  published meanwhile is either drained or notified again.
+ *
+ *  A segment is created exclusively. If it already exists, it is removed 
+ *  and created again only if it is completely initialized and the process 
+ *  that exported it is no longer running, otherwise the export fails. 
+ *  Hence, the proxies opened before the receiver restarted must be opened 
+ *  again. A segment whose receiver died while initializing it must be 
+ *  removed by hand.
+ *
+ *  The received events are checked against the size of a slot, since they 
+ *  are written by other processes. An invalid one is dropped.
+ *
+ *  rkhShm should have the lowest priority, so that the exported active 
+ *  objects empty their queues before it receives more events.
+ */
+
+/* ----------------------------- Include files ----------------------------- */
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "rkh.h"
+#include "rkhfwk_dynevt.h"
+#include "rkhport_shm.h"
+
+/* ----------------------------- Local macros ------------------------------ */
+/* ------------------------------- Constants ------------------------------- */
+RKH_MODULE_NAME(rkhport_shm)
+
+#define SHM_MAGIC           0x524b4853u     /* "RKHS" */
+#define SHM_PATH_SIZE       64u
+
+#if (RKH_CFGPORT_SHM_RING_SIZE & (RKH_CFGPORT_SHM_RING_SIZE - 1u)) != 0
+#error "RKH_CFGPORT_SHM_RING_SIZE must be a power of two"
+#endif
+
+/* ---------------------------- Local data types --------------------------- */
+typedef struct ShmSlot ShmSlot;
+struct ShmSlot
+{
+    atomic_uint seq;
+    uint32_t size;
+    unsigned char data[RKH_CFGPORT_SHM_EVT_SIZE];
+};
+
+/* Shared by several processes, thus it only holds fixed-size members */
+struct RKHShmRing
+{
+    uint32_t magic;
+    uint32_t nSlots;
+    uint32_t slotSize;
+    int32_t owner;                      /* process id of the receiver */
+    atomic_uint nDropped;
+    atomic_uint notified;
+    _Alignas(64) atomic_uint head;      /* next slot to be claimed */
+    _Alignas(64) atomic_uint tail;      /* next slot to be received */
+    _Alignas(64) ShmSlot slots[RKH_CFGPORT_SHM_RING_SIZE];
+};
+
+typedef struct ShmExport ShmExport;
+struct ShmExport
+{
+    RKHShmRing *ring;
+    int wakeFd;
+    RKH_SMA_T *ao;
+    char name[SHM_PATH_SIZE];
+};
+
+typedef struct Shm Shm;
+struct Shm
+{
+    RKH_SMA_T base;
+};
+
+/* ---------------------------- Local variables ---------------------------- */
+#if RKH_CFG_FWK_DYN_EVT_EN == RKH_ENABLED
+static void init(Shm *const me, RKH_EVT_T *pe);
+static void receive(Shm *const me, RKH_EVT_T *pe);
+
+RKH_DCLR_BASIC_STATE shmReady;
+
+RKH_CREATE_BASIC_STATE(shmReady, NULL, NULL, RKH_ROOT, NULL);
+RKH_CREATE_TRANS_TABLE(shmReady)
+    RKH_TRINT(RKH_SHM_RX_EVENT, NULL, receive),
+RKH_END_TRANS_TABLE
+
+RKH_SMA_CREATE(Shm, rkhShm, RKH_CFGPORT_SHM_PRIO, HCAL, &shmReady, init, 
+               NULL);
+
+static ShmExport exports[RKH_CFGPORT_SHM_MAX_EXPORTS];
+#endif
+
+#if RKH_CFG_SMA_VFUNCT_EN == RKH_ENABLED
+#if defined(RKH_USE_TRC_SENDER)
+static void proxyPost(RKH_SMA_T *me, const RKH_EVT_T *e, 
+                      const void *const sender);
+#else
+static void proxyPost(RKH_SMA_T *me, const RKH_EVT_T *e);
+#endif
+
+/* A proxy is never activated nor scheduled, and LIFO is served as FIFO */
+static const RKHSmaVtbl shmProxyVtbl =
+{
+    (RKHActivate)0,
+    (RKHTask)0,
+    proxyPost,
+    proxyPost
+};
+#endif
+
+/* ---------------------------- Global variables --------------------------- */
+#if RKH_CFG_FWK_DYN_EVT_EN == RKH_ENABLED
+RKH_SMA_DEF_PTR(rkhShm);
+#endif
+
+/* ----------------------- Local function prototypes ----------------------- */
+/* ---------------------------- Local functions ---------------------------- */
+#if (RKH_CFG_FWK_DYN_EVT_EN == RKH_ENABLED) || \
+    (RKH_CFG_SMA_VFUNCT_EN == RKH_ENABLED)
+static int
+makePaths(const char *name, char *segment, char *fifo)
+{
+    int n, m;
+
+    n = snprintf(segment, SHM_PATH_SIZE, "/%s", name);
+    m = snprintf(fifo, SHM_PATH_SIZE, "/dev/shm/%s.wake", name);
+    return ((n < 0) || (n >= (int)SHM_PATH_SIZE) || 
+            (m < 0) || (m >= (int)SHM_PATH_SIZE)) ? ENAMETOOLONG : 0;
+}
+#endif
+
+#if RKH_CFG_SMA_VFUNCT_EN == RKH_ENABLED
+static rbool_t
+ringPut(RKHShmRing *ring, const RKH_EVT_T *e, rui32_t size)
+{
+    ShmSlot *slot;
+    unsigned int pos, seq;
+    int diff;
+
+    pos = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    for (;;)
+    {
+        slot = &ring->slots[pos & (RKH_CFGPORT_SHM_RING_SIZE - 1u)];
+        seq = atomic_load_explicit(&slot->seq, memory_order_acquire);
+        diff = (int)(seq - pos);
+        if (diff == 0)
+        {
+            if (atomic_compare_exchange_weak_explicit(&ring->head, &pos, 
+                                                      pos + 1, 
+                                                      memory_order_relaxed,
+                                                      memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            return RKH_FALSE;       /* full */
+        }
+        else
+        {
+            pos = atomic_load_explicit(&ring->head, memory_order_relaxed);
+        }
+    }
+
+    memcpy(slot->data, e, size);
+    slot->size = (uint32_t)size;
+    atomic_store_explicit(&slot->seq, pos + 1, memory_order_release);
+    return RKH_TRUE;
+}
+
+static void
+#if defined(RKH_USE_TRC_SENDER)
+proxyPost(RKH_SMA_T *me, const RKH_EVT_T *e, const void *const sender)
+#else
+proxyPost(RKH_SMA_T *me, const RKH_EVT_T *e)
+#endif
+{
+    RKHShmProxy *proxy;
+    RKHShmRing *ring;
+    rui32_t size;
+
+#if defined(RKH_USE_TRC_SENDER)
+    (void)sender;
+#endif
+    proxy = (RKHShmProxy *)me;
+    ring = proxy->ring;
+    RKH_REQUIRE(ring != (RKHShmRing *)0);
+    size = (proxy->sizeOf != (RKHShmSizeOf)0) ? proxy->sizeOf(e) : 
+                                                 sizeof(RKH_EVT_T);
+    RKH_REQUIRE((size >= sizeof(RKH_EVT_T)) && 
+                (size <= RKH_CFGPORT_SHM_EVT_SIZE));
+
+    RKH_HOOK_SIGNAL(e);
+    if (ringPut(ring, e, size))
+    {
+        if (atomic_exchange(&ring->notified, 1u) == 0)
+        {
+            (void)write(proxy->wakeFd, "", 1);
+        }
+    }
+    else
+    {
+        atomic_fetch_add(&ring->nDropped, 1u);
+    }
+
+    /* The event was copied, thus it is released as if it were dispatched */
+    RKH_FWK_RSV((RKH_EVT_T *)e);
+    RKH_FWK_GC((RKH_EVT_T *)e, me);
+}
+#endif
+
+#if RKH_CFG_FWK_DYN_EVT_EN == RKH_ENABLED
+static RKH_EVT_T *
+ringGet(RKHShmRing *ring, const void *sender)
+{
+    ShmSlot *slot;
+    unsigned int pos;
+    uint32_t size;
+    RKH_EVT_T base, *e;
+
+    for (e = (RKH_EVT_T *)0; e == (RKH_EVT_T *)0; )
+    {
+        pos = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+        slot = &ring->slots[pos & (RKH_CFGPORT_SHM_RING_SIZE - 1u)];
+        if (atomic_load_explicit(&slot->seq, memory_order_acquire) != pos + 1)
+        {
+            return (RKH_EVT_T *)0;  /* empty or not published yet */
+        }
+
+        /* The slot is written by another process, so it is not trusted */
+        size = slot->size;
+        if ((size >= sizeof(RKH_EVT_T)) && 
+            (size <= RKH_CFGPORT_SHM_EVT_SIZE))
+        {
+            memcpy(&base, slot->data, sizeof(RKH_EVT_T));
+            e = rkh_fwk_ae((RKH_ES_T)size, base.e, sender);
+            memcpy((rui8_t *)e + sizeof(RKH_EVT_T), 
+                   slot->data + sizeof(RKH_EVT_T), size - sizeof(RKH_EVT_T));
+        }
+        else
+        {
+            atomic_fetch_add(&ring->nDropped, 1u);
+        }
+
+        atomic_store_explicit(&slot->seq, pos + RKH_CFGPORT_SHM_RING_SIZE, 
+                              memory_order_release);
+        atomic_store_explicit(&ring->tail, pos + 1, memory_order_relaxed);
+    }
+    return e;
+}
+
+static ShmExport *
+findExport(const char *name, int fd)
+{
+    ShmExport *exp;
+
+    for (exp = exports; 
+         exp < &exports[RKH_CFGPORT_SHM_MAX_EXPORTS]; 
+         ++exp)
+    {
+        if ((name != (const char *)0) ? 
+                (strncmp(exp->name, name, SHM_PATH_SIZE) == 0) :
+                (exp->wakeFd == fd))
+        {
+            return exp;
+        }
+    }
+    return (ShmExport *)0;
+}
+
+static rbool_t
+isRunning(int32_t pid)
+{
+    return (pid > 0) && ((kill((pid_t)pid, 0) == 0) || (errno == EPERM));
+}
+
+/*
+ *  Removes the segment left behind by a receiver which is no longer 
+ *  running. Returns EBUSY if it is still in use or if its receiver is 
+ *  unknown, i.e. it is still being initialized.
+ */
+static int
+removeStale(const char *segment)
+{
+    RKHShmRing *ring;
+    struct stat st;
+    int fd, result;
+
+    fd = shm_open(segment, O_RDONLY, 0);
+    if (fd < 0)
+    {
+        return (errno == ENOENT) ? 0 : errno;
+    }
+    result = EBUSY;
+    if ((fstat(fd, &st) == 0) && (st.st_size == sizeof(RKHShmRing)))
+    {
+        ring = (RKHShmRing *)mmap(NULL, sizeof(RKHShmRing), PROT_READ, 
+                                  MAP_SHARED, fd, 0);
+        if (ring == MAP_FAILED)
+        {
+            result = errno;
+        }
+        else
+        {
+            if (ring->magic == SHM_MAGIC)
+            {
+                atomic_thread_fence(memory_order_acquire);
+                if (!isRunning(ring->owner))
+                {
+                    result = 0;
+                }
+            }
+            munmap(ring, sizeof(RKHShmRing));
+        }
+    }
+    close(fd);
+    if (result == 0)
+    {
+        shm_unlink(segment);
+    }
+    return result;
+}
+
+static void
+init(Shm *const me, RKH_EVT_T *pe)
+{
+    (void)me;
+    (void)pe;
+
+    RKH_TR_FWK_AO(me);
+    RKH_TR_FWK_STATE(me, &shmReady);
+    RKH_TR_FWK_SIG(RKH_SHM_RX_EVENT);
+}
+
+static void
+receive(Shm *const me, RKH_EVT_T *pe)
+{
+    RKHIoEvt *io;
+    ShmExport *exp;
+    RKH_EVT_T *e;
+    char wakeUps[32];
+
+    io = (RKHIoEvt *)pe;
+    exp = findExport((const char *)0, io->fd);
+    if (exp == (ShmExport *)0)
+    {
+        return;                     /* already withdrawn */
+    }
+
+    while (read(io->fd, wakeUps, sizeof(wakeUps)) > 0)
+    {
+    }
+    atomic_store(&exp->ring->notified, 0u);
+    while (exp->ao->equeue.qty < exp->ao->equeue.nelems)
+    {
+        e = ringGet(exp->ring, me);
+        if (e == (RKH_EVT_T *)0)
+        {
+            break;
+        }
+        RKH_SMA_POST_FIFO(exp->ao, e, me);
+    }
+
+    /* 
+     * If the queue of the exported active object is full, the remaining 
+     * events are left in the ring and received once the scheduler goes 
+     * idle again, so the senders drop events instead of overflowing it.
+     */
+    if (exp->ao->equeue.qty == exp->ao->equeue.nelems)
+    {
+        (void)write(io->fd, "", 1);
+    }
+    rkhport_io_rearm(io->fd);
+}
+#endif
+
+/* ---------------------------- Global functions --------------------------- */
+#if RKH_CFG_FWK_DYN_EVT_EN == RKH_ENABLED
+void
+rkhport_shm_start(const RKH_EVT_T **qs, RKH_QUENE_T qsize)
+{
+    RKH_SMA_ACTIVATE(rkhShm, qs, qsize, 0, 0);
+}
+
+int
+rkhport_shm_export(const char *name, RKH_SMA_T *ao)
+{
+    char segment[SHM_PATH_SIZE], fifo[SHM_PATH_SIZE];
+    ShmExport *exp;
+    RKHShmRing *ring;
+    int fd, result;
+    unsigned int i;
+
+    RKH_REQUIRE((name != (const char *)0) && (*name != '\0') && 
+                (ao != (RKH_SMA_T *)0));
+    result = makePaths(name, segment, fifo);
+    if (result != 0)
+    {
+        return result;
+    }
+    exp = findExport("", -1);
+    RKH_ASSERT(exp != (ShmExport *)0);
+
+    fd = shm_open(segment, O_RDWR | O_CREAT | O_EXCL, 0600);
+    if ((fd < 0) && (errno == EEXIST))
+    {
+        result = removeStale(segment);
+        if (result != 0)
+        {
+            return result;
+        }
+        fd = shm_open(segment, O_RDWR | O_CREAT | O_EXCL, 0600);
+    }
+    if (fd < 0)
+    {
+        return errno;
+    }
+    if (ftruncate(fd, sizeof(RKHShmRing)) != 0)
+    {
+        result = errno;
+        close(fd);
+        return result;
+    }
+    ring = (RKHShmRing *)mmap(NULL, sizeof(RKHShmRing), 
+                              PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (ring == MAP_FAILED)
+    {
+        return errno;
+    }
+
+    ring->magic = 0;
+    for (i = 0; i < RKH_CFGPORT_SHM_RING_SIZE; ++i)
+    {
+        atomic_init(&ring->slots[i].seq, i);
+    }
+    atomic_init(&ring->head, 0u);
+    atomic_init(&ring->tail, 0u);
+    atomic_init(&ring->notified, 0u);
+    atomic_init(&ring->nDropped, 0u);
+    ring->nSlots = RKH_CFGPORT_SHM_RING_SIZE;
+    ring->slotSize = RKH_CFGPORT_SHM_EVT_SIZE;
+    ring->owner = (int32_t)getpid();
+    atomic_thread_fence(memory_order_release);
+    ring->magic = SHM_MAGIC;
+
+    if ((mkfifo(fifo, 0600) != 0) && (errno != EEXIST))
+    {
+        result = errno;
+    }
+    else
+    {
+        exp->wakeFd = open(fifo, O_RDWR | O_NONBLOCK | O_CLOEXEC);
+        result = (exp->wakeFd < 0) ? errno : 0;
+    }
+    if (result != 0)
+    {
+        munmap(ring, sizeof(RKHShmRing));
+        shm_unlink(segment);
+        return result;
+    }
+
+    exp->ring = ring;
+    exp->ao = ao;
+    strncpy(exp->name, name, SHM_PATH_SIZE - 1);
+    rkhport_io_watch(exp->wakeFd, EPOLLIN, rkhShm, RKH_SHM_RX_EVENT);
+    return 0;
+}
+
+void
+rkhport_shm_unexport(const char *name)
+{
+    char segment[SHM_PATH_SIZE], fifo[SHM_PATH_SIZE];
+    ShmExport *exp;
+
+    RKH_REQUIRE((name != (const char *)0) && (*name != '\0'));
+    exp = findExport(name, -1);
+    RKH_REQUIRE(exp != (ShmExport *)0);
+
+    rkhport_io_unwatch(exp->wakeFd);
+    close(exp->wakeFd);
+    munmap(exp->ring, sizeof(RKHShmRing));
+    if (makePaths(name, segment, fifo) == 0)
+    {
+        shm_unlink(segment);
+        unlink(fifo);
+    }
+    memset(exp, 0, sizeof(ShmExport));
+    exp->wakeFd = -1;
+}
+#endif
+
+#if RKH_CFG_SMA_VFUNCT_EN == RKH_ENABLED
+int
+rkhport_shm_proxy_open(RKHShmProxy *me, const char *name, 
+                       RKHShmSizeOf sizeOf)
+{
+    char segment[SHM_PATH_SIZE], fifo[SHM_PATH_SIZE];
+    RKHShmRing *ring;
+    struct stat st;
+    int fd, result;
+
+    RKH_REQUIRE((me != (RKHShmProxy *)0) && (name != (const char *)0));
+    result = makePaths(name, segment, fifo);
+    if (result != 0)
+    {
+        return result;
+    }
+
+    fd = shm_open(segment, O_RDWR, 0);
+    if (fd < 0)
+    {
+        return errno;
+    }
+    if ((fstat(fd, &st) != 0) || (st.st_size != sizeof(RKHShmRing)))
+    {
+        close(fd);
+        return EPROTO;
+    }
+    ring = (RKHShmRing *)mmap(NULL, sizeof(RKHShmRing), 
+                              PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (ring == MAP_FAILED)
+    {
+        return errno;
+    }
+    if ((ring->magic != SHM_MAGIC) || 
+        (ring->nSlots != RKH_CFGPORT_SHM_RING_SIZE) ||
+        (ring->slotSize != RKH_CFGPORT_SHM_EVT_SIZE))
+    {
+        munmap(ring, sizeof(RKHShmRing));
+        return EPROTO;
+    }
+
+    /* 
+     * Opened for reading too, so that it never fails nor raises SIGPIPE 
+     * while the receiver is restarting.
+     */
+    me->wakeFd = open(fifo, O_RDWR | O_NONBLOCK | O_CLOEXEC);
+    if (me->wakeFd < 0)
+    {
+        result = errno;
+        munmap(ring, sizeof(RKHShmRing));
+        return result;
+    }
+
+    memset(&me->sma, 0, sizeof(RKH_SMA_T));
+    me->sma.vptr = &shmProxyVtbl;
+    me->ring = ring;
+    me->sizeOf = sizeOf;
+    return 0;
+}
+
+void
+rkhport_shm_proxy_close(RKHShmProxy *me)
+{
+    RKH_REQUIRE((me != (RKHShmProxy *)0) && (me->ring != (RKHShmRing *)0));
+    close(me->wakeFd);
+    munmap(me->ring, sizeof(RKHShmRing));
+    me->ring = (RKHShmRing *)0;
+    me->wakeFd = -1;
+}
+
+rui32_t
+rkhport_shm_proxy_getDropped(const RKHShmProxy *me)
+{
+    RKH_REQUIRE((me != (RKHShmProxy *)0) && (me->ring != (RKHShmRing *)0));
+    return (rui32_t)atomic_load(&me->ring->nDropped);
+}
+#endif
+
+/* ------------------------------ End of file ------------------------------ */
@@ -0,0 +1,228 @@
+/*
+ *  --------------------------------------------------------------------------
+ *
+ *                                Framework RKH
+ *                                -------------
+ *
+ *            State-machine framework for reactive embedded systems
+ *
+ *                      Copyright (C) 2010 Leandro Francucci.
+ *          All rights reserved. Protected by international copyright laws.
+ *
+ *
+ *  RKH is free software: you can redistribute it and/or modify it under the
+ *  terms of the GNU General Public License as published by the Free Software
+ *  Foundation, either version 3 of the License, or (at your option) any
+ *  later version.
+ *
+ *  RKH is distributed in the hope that it will be useful, but WITHOUT ANY
+ *  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with RKH, see copying.txt file.
+ *
+ *  Contact information:
+ *  RKH site: http://vortexmakes.com/que-es/
+ *  RKH GitHub: https://github.com/vortexmakes/RKH
+ *  RKH Sourceforge: https://sourceforge.net/projects/rkh-reactivesys/
+ *  e-mail: lf@vortexmakes.com
+ *  ---------------------------------------------------------------------------
+ */
+
+
+/**
+ *  \file       rkhport_shm.h
+ *  \brief      Cross-process active objects over shared-memory rings of 
+ *              Linux port.
+ *
+ *  \ingroup    port
+ */
+
+/* -------------------------- Development history -------------------------- */
+/*
+ *  2026.10.19  LeFr  v3.4.00  Initial version
+ */
+
+/* -------------------------------- Authors -------------------------------- */
+/*
+ *  LeFr  Leandro Francucci  lf@vortexmakes.com
+ */
+
+/* --------------------------------- Notes --------------------------------- */
+/*
+ *  A process exports a local active object by means of 
+ *  rkhport_shm_export(), which creates a named shared-memory segment 
+ *  holding a lock-free ring of event slots. Other processes open a 
+ *  RKHShmProxy on the same name, which is an active object whose 
+ *  post_fifo() virtual function copies the event into the ring instead of 
+ *  queuing it. Hence, the proxy is posted as any other active object, 
+ *  i.e. RKH_SMA_POST_FIFO(RKH_UPCAST(RKH_SMA_T, &proxy), e, me).
+ *
+ *  In the exporting process, the rkhShm active object is notified through 
+ *  the epoll reactor of the port. It allocates a dynamic event for each 
+ *  received one and posts it to the exported active object.
+ *
+ *  Events are copied byte by byte, hence they must not hold pointers. 
+ *  The proxy requires RKH_CFG_SMA_VFUNCT_EN and the receiver requires 
+ *  RKH_CFG_FWK_DYN_EVT_EN.
+ */
+
+/* --------------------------------- Module -------------------------------- */
+#ifndef __RKHPORT_SHM_H__
+#define __RKHPORT_SHM_H__
+
+/* ----------------------------- Include files ----------------------------- */
+#include "rkhsma.h"
+
+/* ---------------------- External C language linkage ---------------------- */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* --------------------------------- Macros -------------------------------- */
+/* -------------------------------- Constants ------------------------------ */
+/**
+ *  \brief
+ *  Signal used internally by rkhShm to be notified about received events.
+ */
+#define RKH_SHM_RX_EVENT            (RKH_ANY - 5)
+
+/**
+ *  \brief
+ *  Priority of the shared-memory receiver active object. It must not be 
+ *  used by any other active object, rkhAio included.
+ */
+#ifndef RKH_CFGPORT_SHM_PRIO
+#define RKH_CFGPORT_SHM_PRIO        RKH_LOWEST_PRIO
+#endif
+
+/**
+ *  \brief
+ *  Number of event slots of every ring. It must be a power of two.
+ */
+#ifndef RKH_CFGPORT_SHM_RING_SIZE
+#define RKH_CFGPORT_SHM_RING_SIZE   64u
+#endif
+
+/**
+ *  \brief
+ *  Maximum size of an event transferred through a ring [in bytes].
+ */
+#ifndef RKH_CFGPORT_SHM_EVT_SIZE
+#define RKH_CFGPORT_SHM_EVT_SIZE    64u
+#endif
+
+/**
+ *  \brief
+ *  Maximum number of active objects exported at the same time.
+ */
+#ifndef RKH_CFGPORT_SHM_MAX_EXPORTS
+#define RKH_CFGPORT_SHM_MAX_EXPORTS 4u
+#endif
+
+/* ------------------------------- Data types ------------------------------ */
+/**
+ *  \brief
+ *  Retrieves the size of an event [in bytes], so that the proxy knows how 
+ *  many bytes to copy into the ring.
+ */
+typedef rui32_t (*RKHShmSizeOf)(const RKH_EVT_T *e);
+
+typedef struct RKHShmRing RKHShmRing;
+
+/**
+ *  \brief
+ *  Local proxy of an active object exported by another process.
+ */
+typedef struct RKHShmProxy RKHShmProxy;
+struct RKHShmProxy
+{
+    RKH_SMA_T sma;
+    RKHShmRing *ring;       /**< ring mapped from the shared segment */
+    int wakeFd;             /**< FIFO used to wake up the receiver */
+    RKHShmSizeOf sizeOf;    /**< event size, or null to send the signal */
+};
+
+/* -------------------------- External variables --------------------------- */
+RKH_SMA_DCLR(rkhShm);
+
+/* -------------------------- Function prototypes -------------------------- */
+/**
+ *  \brief
+ *  Activates the shared-memory receiver active object.
+ *
+ *  \param[in] qs       base address of the event storage area.
+ *  \param[in] qsize    size of the storage event area [in number of
+ *                      entries].
+ */
+void rkhport_shm_start(const RKH_EVT_T **qs, RKH_QUENE_T qsize);
+
+/**
+ *  \brief
+ *  Exports a local active object to other processes.
+ *
+ *  It creates the shared segment \a name and its wake-up FIFO, and watches 
+ *  the latter by means of rkhport_io_watch(). A segment left behind by a 
+ *  process which is no longer running is removed first.
+ *
+ *  \param[in] name     name of the segment, without a leading slash.
+ *  \param[in] ao       active object receiving the events.
+ *
+ *  \return
+ *  Zero on success, otherwise an error number, i.e. EBUSY when \a name is 
+ *  exported by a running process or it is still being initialized.
+ */
+int rkhport_shm_export(const char *name, RKH_SMA_T *ao);
+
+/**
+ *  \brief
+ *  Withdraws an exported active object and removes its shared segment.
+ *
+ *  \param[in] name     name given to rkhport_shm_export().
+ */
+void rkhport_shm_unexport(const char *name);
+
+/**
+ *  \brief
+ *  Opens a proxy of an active object exported by another process.
+ *
+ *  \param[in] me       proxy to initialize.
+ *  \param[in] name     name given to rkhport_shm_export().
+ *  \param[in] sizeOf   retrieves the size of posted events. If it is null, 
+ *                      only the RKH_EVT_T base is transferred.
+ *
+ *  \return
+ *  Zero on success, otherwise an error number, i.e. ENOENT when the 
+ *  active object is not exported yet.
+ */
+int rkhport_shm_proxy_open(RKHShmProxy *me, const char *name, 
+                           RKHShmSizeOf sizeOf);
+
+/**
+ *  \brief
+ *  Closes a proxy.
+ *
+ *  \param[in] me       proxy previously opened.
+ */
+void rkhport_shm_proxy_close(RKHShmProxy *me);
+
+/**
+ *  \brief
+ *  Retrieves the number of events dropped because the ring of the proxy 
+ *  was full, by all of the posting processes.
+ *
+ *  \param[in] me       proxy previously opened.
+ */
+rui32_t rkhport_shm_proxy_getDropped(const RKHShmProxy *me);
+
+/* -------------------- External C language linkage end -------------------- */
+#ifdef __cplusplus
+}
+#endif
+
+/* ------------------------------ Module end ------------------------------- */
+#endif
+
+/* ------------------------------ End of file ------------------------------ */
@@ -0,0 +1,262 @@
+/*
+ *  --------------------------------------------------------------------------
+ *
+ *                                Framework RKH
+ *                                -------------
+ *
+ *            State-machine framework for reactive embedded systems
+ *
+ *                      Copyright (C) 2010 Leandro Francucci.
+ *          All rights reserved. Protected by international copyright laws.
+ *
+ *
+ *  RKH is free software: you can redistribute it and/or modify it under the
+ *  terms of the GNU General Public License as published by the Free Software
+ *  Foundation, either version 3 of the License, or (at your option) any
+ *  later version.
+ *
+ *  RKH is distributed in the hope that it will be useful, but WITHOUT ANY
+ *  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with RKH, see copying.txt file.
+ *
+ *  Contact information:
+ *  RKH site: http://vortexmakes.com/que-es/
+ *  RKH GitHub: https://github.com/vortexmakes/RKH
+ *  RKH Sourceforge: https://sourceforge.net/projects/rkh-reactivesys/
+ *  e-mail: lf@vortexmakes.com
+ *  ---------------------------------------------------------------------------
+ */
+
+/**
+ *  \file       rkhport_trc.c
+ *  \brief      Memory-mapped trace sink of Linux port.
+ *
+ *  \ingroup    port
+ */
+
+/* -------------------------- Development history -------------------------- */
+/*
+ *  2026.10.19  LeFr  v3.4.00  Initial version
+ */
+
+/* -------------------------------- Authors -------------------------------- */
+/*
+ *  LeFr  Leandro Francucci  lf@vortexmakes.com
+ */
+
+/* --------------------------------- Notes --------------------------------- */
+/*
+ *  The writer side is rkhtrc_stream.c itself, which publishes the head 
+ *  index with a release store after storing the bytes. Hence, this module 
+ *  only maps the file and implements the reader side.
+ */
+
+/* ----------------------------- Include files ----------------------------- */
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "rkh.h"
+#include "rkhport_trc.h"
+
+#if (RKH_CFG_TRC_EN == RKH_ENABLED) && (RKH_CFG_TRC_SHARED_EN == RKH_ENABLED)
+
+/* ----------------------------- Local macros ------------------------------ */
+#define LOAD_ACQUIRE(p_)        __atomic_load_n((p_), __ATOMIC_ACQUIRE)
+#define STORE_RELEASE(p_, v_)   __atomic_store_n((p_), (v_), __ATOMIC_RELEASE)
+
+/* ------------------------------- Constants ------------------------------- */
+RKH_MODULE_NAME(rkhport_trc)
+
+/* ---------------------------- Local data types --------------------------- */
+/* ---------------------------- Global variables --------------------------- */
+/* ---------------------------- Local variables ---------------------------- */
+static RKHTrcShared *mapped;
+
+/* ----------------------- Local function prototypes ----------------------- */
+/* ---------------------------- Local functions ---------------------------- */
+static rui32_t
+skipLost(RKHTrcReader *me, rui32_t end)
+{
+    rui32_t lost;
+
+    lost = 0;
+    if ((rui32_t)(end - me->pos) > me->size)
+    {
+        lost = end - me->size - me->pos;
+        me->pos = end - me->size;
+        me->nLost += lost;
+    }
+    return lost;
+}
+
+/* ---------------------------- Global functions --------------------------- */
+int
+rkhport_trc_map(const char *path)
+{
+    RKHTrcShared *area;
+    int fd, result;
+
+    RKH_REQUIRE((path != (const char *)0) && (mapped == (RKHTrcShared *)0));
+    fd = open(path, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+    if (fd < 0)
+    {
+        return errno;
+    }
+    if (ftruncate(fd, RKH_TRC_SIZEOF_SHARED) != 0)
+    {
+        result = errno;
+        close(fd);
+        return result;
+    }
+    area = (RKHTrcShared *)mmap(NULL, RKH_TRC_SIZEOF_SHARED, 
+                                PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (area == MAP_FAILED)
+    {
+        return errno;
+    }
+
+    mapped = area;
+    rkh_trcStream_attach(area);
+    return 0;
+}
+
+void
+rkhport_trc_unmap(void)
+{
+    if (mapped != (RKHTrcShared *)0)
+    {
+        rkh_trcStream_attach((RKHTrcShared *)0);
+        munmap(mapped, RKH_TRC_SIZEOF_SHARED);
+        mapped = (RKHTrcShared *)0;
+    }
+}
+
+int
+rkhport_trc_reader_open(RKHTrcReader *me, const char *path)
+{
+    struct stat st;
+    void *area;
+    int fd, result, prot;
+    rui32_t size;
+
+    RKH_REQUIRE((me != (RKHTrcReader *)0) && (path != (const char *)0));
+    me->isWritable = RKH_TRUE;
+    prot = PROT_READ | PROT_WRITE;
+    fd = open(path, O_RDWR | O_CLOEXEC);
+    if ((fd < 0) && ((errno == EACCES) || (errno == EROFS)))
+    {
+        me->isWritable = RKH_FALSE;
+        prot = PROT_READ;
+        fd = open(path, O_RDONLY | O_CLOEXEC);
+    }
+    if (fd < 0)
+    {
+        return errno;
+    }
+    if (fstat(fd, &st) != 0)
+    {
+        result = errno;
+        close(fd);
+        return result;
+    }
+    if (st.st_size < (off_t)sizeof(RKHTrcShared))
+    {
+        close(fd);
+        return EINVAL;
+    }
+    area = mmap(NULL, (size_t)st.st_size, prot, MAP_SHARED, fd, 0);
+    close(fd);
+    if (area == MAP_FAILED)
+    {
+        return errno;
+    }
+
+    me->area = (RKHTrcShared *)area;
+    me->mapSize = (rui32_t)st.st_size;
+    size = me->area->size;
+    if ((LOAD_ACQUIRE(&me->area->magic) != RKH_TRC_SHARED_MAGIC) ||
+        (size == 0) || ((size & (size - 1)) != 0) || 
+        (size > me->mapSize - sizeof(RKHTrcShared)))
+    {
+        munmap(area, (size_t)st.st_size);
+        me->area = (RKHTrcShared *)0;
+        return EINVAL;
+    }
+
+    me->sto = RKH_TRC_SHARED_STO(me->area);
+    me->size = size;
+    me->nLost = 0;
+    me->pos = me->area->tail;
+    skipLost(me, LOAD_ACQUIRE(&me->area->head));
+    me->nLost = 0;          /* older than the reader */
+    return 0;
+}
+
+void
+rkhport_trc_reader_close(RKHTrcReader *me)
+{
+    RKH_REQUIRE(me != (RKHTrcReader *)0);
+    if (me->area != (RKHTrcShared *)0)
+    {
+        munmap(me->area, me->mapSize);
+        me->area = (RKHTrcShared *)0;
+    }
+}
+
+const rui8_t *
+rkhport_trc_reader_peek(RKHTrcReader *me, rui32_t *n)
+{
+    rui32_t head, offset;
+
+    RKH_REQUIRE((me != (RKHTrcReader *)0) && 
+                (me->area != (RKHTrcShared *)0) && (n != (rui32_t *)0));
+    head = LOAD_ACQUIRE(&me->area->head);
+    skipLost(me, head);
+    offset = me->pos & (me->size - 1);
+    *n = head - me->pos;
+    if (*n > me->size - offset)
+    {
+        *n = me->size - offset;     /* up to the end of the stream */
+    }
+    return &me->sto[offset];
+}
+
+rbool_t
+rkhport_trc_reader_release(RKHTrcReader *me, rui32_t n)
+{
+    rbool_t isValid;
+
+    RKH_REQUIRE((me != (RKHTrcReader *)0) && 
+                (me->area != (RKHTrcShared *)0));
+    /* The bytes were read before loading next, see rkhtrc_stream.h */
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    isValid = (rbool_t)(skipLost(me, LOAD_ACQUIRE(&me->area->next)) == 0);
+    if (isValid)
+    {
+        me->pos += n;
+    }
+    if (me->isWritable)
+    {
+        STORE_RELEASE(&me->area->tail, me->pos);
+    }
+    return isValid;
+}
+
+rui32_t
+rkhport_trc_reader_getLost(const RKHTrcReader *me)
+{
+    RKH_REQUIRE(me != (RKHTrcReader *)0);
+    return me->nLost;
+}
+
+#endif
+
+/* ------------------------------ End of file ------------------------------ */
@@ -0,0 +1,198 @@
+/*
+ *  --------------------------------------------------------------------------
+ *
+ *                                Framework RKH
+ *                                -------------
+ *
+ *            State-machine framework for reactive embedded systems
+ *
+ *                      Copyright (C) 2010 Leandro Francucci.
+ *          All rights reserved. Protected by international copyright laws.
+ *
+ *
+ *  RKH is free software: you can redistribute it and/or modify it under the
+ *  terms of the GNU General Public License as published by the Free Software
+ *  Foundation, either version 3 of the License, or (at your option) any
+ *  later version.
+ *
+ *  RKH is distributed in the hope that it will be useful, but WITHOUT ANY
+ *  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with RKH, see copying.txt file.
+ *
+ *  Contact information:
+ *  RKH site: http://vortexmakes.com/que-es/
+ *  RKH GitHub: https://github.com/vortexmakes/RKH
+ *  RKH Sourceforge: https://sourceforge.net/projects/rkh-reactivesys/
+ *  e-mail: lf@vortexmakes.com
+ *  ---------------------------------------------------------------------------
+ */
+
+/**
+ *  \file       rkhport_trc.h
+ *  \brief      Memory-mapped trace sink of Linux port.
+ *
+ *  \ingroup    port
+ */
+
+/* -------------------------- Development history -------------------------- */
+/*
+ *  2026.10.19  LeFr  v3.4.00  Initial version
+ */
+
+/* -------------------------------- Authors -------------------------------- */
+/*
+ *  LeFr  Leandro Francucci  lf@vortexmakes.com
+ */
+
+/* --------------------------------- Notes --------------------------------- */
+/*
+ *  With RKH_CFG_TRC_SHARED_EN enabled, rkhport_trc_map() places the trace 
+ *  stream into a file mapped with MAP_SHARED, usually from rkh_trc_open():
+ *
+ *  \code
+ *  void
+ *  rkh_trc_open(void)
+ *  {
+ *      rkhport_trc_map("/dev/shm/app.trc");
+ *      rkh_trc_init();
+ *      RKH_TRC_SEND_CFG(BSP_TS_RATE_HZ);
+ *  }
+ *  \endcode
+ *
+ *  Thus, rkh_trc_flush() has nothing to do. Another process reads the live 
+ *  trace in place through a RKHTrcReader, and since the pages belong to 
+ *  the file, the last records remain there if the process crashes, so 
+ *  the same reader gets them post mortem.
+ *
+ *  A reader peeks a contiguous block, feeds it to its decoder and then 
+ *  releases it. If the writer lapped the reader meanwhile, the release 
+ *  fails and the block should be taken as garbage; the decoder recovers 
+ *  at the next flag.
+ */
+
+/* --------------------------------- Module -------------------------------- */
+#ifndef __RKHPORT_TRC_H__
+#define __RKHPORT_TRC_H__
+
+/* ----------------------------- Include files ----------------------------- */
+#include "rkhtrc_stream.h"
+
+/* ---------------------- External C language linkage ---------------------- */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* --------------------------------- Macros -------------------------------- */
+/* -------------------------------- Constants ------------------------------ */
+/* ------------------------------- Data types ------------------------------ */
+/**
+ *  \brief
+ *  Reader of a memory-mapped trace stream. Its members must not be 
+ *  accessed directly.
+ */
+typedef struct RKHTrcReader RKHTrcReader;
+struct RKHTrcReader
+{
+    RKHTrcShared *area;     /**< mapped area */
+    rui8_t *sto;            /**< stream bytes */
+    rui32_t size;           /**< size of the stream [in bytes] */
+    rui32_t mapSize;        /**< size of the mapping [in bytes] */
+    rui32_t pos;            /**< next byte to be read */
+    rui32_t nLost;          /**< bytes overwritten before being read */
+    rbool_t isWritable;     /**< the tail index can be published */
+};
+
+/* -------------------------- External variables --------------------------- */
+/* -------------------------- Function prototypes -------------------------- */
+/**
+ *  \brief
+ *  Creates, or truncates, the file \a path and places the trace stream 
+ *  into it. It must be called before rkh_trc_init().
+ *
+ *  \param[in] path     file name, i.e. below /dev/shm to keep it in RAM.
+ *
+ *  \return
+ *  Zero on success, otherwise an error number. On failure, the internal 
+ *  stream is kept.
+ */
+int rkhport_trc_map(const char *path);
+
+/**
+ *  \brief
+ *  Goes back to the internal trace stream and unmaps the file, which 
+ *  keeps the last records.
+ */
+void rkhport_trc_unmap(void);
+
+/**
+ *  \brief
+ *  Opens a reader of a trace stream mapped by another process, live or 
+ *  dead. The reading starts at the oldest byte not read yet.
+ *
+ *  \param[in] me       reader to initialize.
+ *  \param[in] path     file name given to rkhport_trc_map().
+ *
+ *  \return
+ *  Zero on success, otherwise an error number, i.e. EINVAL when the file 
+ *  does not hold a trace stream. If the file is read-only, the reader 
+ *  does not publish its position.
+ */
+int rkhport_trc_reader_open(RKHTrcReader *me, const char *path);
+
+/**
+ *  \brief
+ *  Closes a reader.
+ *
+ *  \param[in] me       reader previously opened.
+ */
+void rkhport_trc_reader_close(RKHTrcReader *me);
+
+/**
+ *  \brief
+ *  Retrieves the largest contiguous block of unread bytes, in place.
+ *
+ *  \param[in] me       reader previously opened.
+ *  \param[out] n       number of bytes of the block, zero if there is no 
+ *                      new data.
+ *
+ *  \return
+ *  Pointer to the first byte of the block.
+ */
+const rui8_t *rkhport_trc_reader_peek(RKHTrcReader *me, rui32_t *n);
+
+/**
+ *  \brief
+ *  Releases the first \a n bytes of the block retrieved by 
+ *  rkhport_trc_reader_peek(), after being used.
+ *
+ *  \param[in] me       reader previously opened.
+ *  \param[in] n        number of bytes used.
+ *
+ *  \return
+ *  RKH_TRUE if they were valid, or RKH_FALSE if the writer overwrote some 
+ *  of them meanwhile, in which case the reader skips to the oldest byte 
+ *  still available and the lost bytes are counted.
+ */
+rbool_t rkhport_trc_reader_release(RKHTrcReader *me, rui32_t n);
+
+/**
+ *  \brief
+ *  Retrieves the number of bytes overwritten before being read.
+ *
+ *  \param[in] me       reader previously opened.
+ */
+rui32_t rkhport_trc_reader_getLost(const RKHTrcReader *me);
+
+/* -------------------- External C language linkage end -------------------- */
+#ifdef __cplusplus
+}
+#endif
+
+/* ------------------------------ Module end ------------------------------- */
+#endif
+
+/* ------------------------------ End of file ------------------------------ */
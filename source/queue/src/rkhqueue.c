@@ -53,6 +53,7 @@
 #include "rkhqueue.h"
 #include "rkhassert.h"
 #include "rkhsma_prio.h"
+#include "rkhsma_edf.h"
 #include "rkhsma_sync.h"
 #include "rkhfwk_module.h"
 #include "rkhtrc_record.h"
@@ -203,13 +204,18 @@ rkh_queue_get(RKH_QUEUE_T *q)
     {
         cbRKHSmaSetUnready((RKH_SMA_T *)(q->sma));
         RKH_TR_QUE_GET_LAST(q);
-        RKH_EXIT_CRITICAL_();
     }
     else
     {
         RKH_TR_QUE_GET(q, q->qty);
-        RKH_EXIT_CRITICAL_();
     }
+#if RKH_CFG_SMA_EDF_EN == RKH_ENABLED
+    if (q->sma != CSMA(0))
+    {
+        rkh_smaPrio_consumed(RKH_GET_PRIO(q->sma));
+    }
+#endif
+    RKH_EXIT_CRITICAL_();
     return e;
 }
 
@@ -163,14 +163,6 @@ RKH_MODULE_NAME(rkhsm)
     #define RKH_GET_STEP()          ((void)0)
 #endif
 
-#if RKH_CFG_SMA_GET_INFO_EN == RKH_ENABLED
-    #define INFO_RCV_EVENTS(p)      ++ (p)->hinfo.rcvevt
-    #define INFO_EXEC_TRS(p)        ++ (p)->hinfo.exectr
-#else
-    #define INFO_RCV_EVENTS(p)      ((void)0)
-    #define INFO_EXEC_TRS(p)        ((void)0)
-#endif
-
 #if defined(RKH_SUBMACHINE_ENABLED)
     #define UPDATE_PARENT(s) \
     (s) = (s)->parent; \
@@ -428,7 +420,6 @@ rkh_sm_dispatch(RKH_SM_T *me, RKH_EVT_T *pe)
 
     if (isCreationEvent == RKH_FALSE)
     {
-        INFO_RCV_EVENTS(me);
         RKH_HOOK_DISPATCH(me, pe);
     }
     else
@@ -755,7 +746,6 @@ rkh_sm_dispatch(RKH_SM_T *me, RKH_EVT_T *pe)
     isCreationEvent = RKH_FALSE;
     } while (isCompletionEvent);
 
-    INFO_EXEC_TRS(me);
     return RKH_EVT_PROC;
 }
 
@@ -62,6 +62,7 @@
 /* ----------------------------- Include files ----------------------------- */
 #include "rkhsm.h"
 #include "rkhqueue.h"
+#include "rkhfwk_sched.h"
 
 /* ---------------------- External C language linkage ---------------------- */
 #ifdef __cplusplus
@@ -727,6 +728,10 @@ typedef struct RKH_SMAI_T
 {
     rui16_t ndevt;          /**< # of dispatched events */
     rui16_t exectr;         /**< # of executed transitions */
+#if RKH_CFG_FWK_SCHED_FAIR_EN == RKH_ENABLED
+    /** # of dispatched events under each scheduling policy */
+    rui16_t ndpolicy[RKH_SCHED_NUM_POLICIES];
+#endif
 } RKH_SMAI_T;
 
 /**
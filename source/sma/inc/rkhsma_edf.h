@@ -0,0 +1,160 @@
+/*
+ *  --------------------------------------------------------------------------
+ *
+ *                                Framework RKH
+ *                                -------------
+ *
+ *            State-machine framework for reactive embedded systems
+ *
+ *                      Copyright (C) 2010 Leandro Francucci.
+ *          All rights reserved. Protected by international copyright laws.
+ *
+ *
+ *  RKH is free software: you can redistribute it and/or modify it under the
+ *  terms of the GNU General Public License as published by the Free Software
+ *  Foundation, either version 3 of the License, or (at your option) any
+ *  later version.
+ *
+ *  RKH is distributed in the hope that it will be useful, but WITHOUT ANY
+ *  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with RKH, see copying.txt file.
+ *
+ *  Contact information:
+ *  RKH site: http://vortexmakes.com/que-es/
+ *  RKH GitHub: https://github.com/vortexmakes/RKH
+ *  RKH Sourceforge: https://sourceforge.net/projects/rkh-reactivesys/
+ *  e-mail: lf@vortexmakes.com
+ *  ---------------------------------------------------------------------------
+ */
+
+
+/**
+ *  \file       rkhsma_edf.h
+ *  \brief      Specifies the earliest-deadline-first ordering for active 
+ *              object scheduling
+ *  \ingroup    sma
+ */
+
+/* -------------------------- Development history -------------------------- */
+/*
+ *  2026.10.19  LeFr  v3.4.00  Initial version
+ */
+
+/* -------------------------------- Authors -------------------------------- */
+/*
+ *  LeFr  Leandro Francucci  lf@vortexmakes.com
+ */
+
+/* --------------------------------- Notes --------------------------------- */
+/*
+ *  When RKH_CFG_SMA_EDF_EN is enabled the ready list is ordered by the 
+ *  absolute deadline of the active objects instead of by their priorities. 
+ *  It implements the same rkh_smaPrio_*() interface, so that the scheduler 
+ *  and the event queues are unaware of the ordering in use. Active objects 
+ *  without a deadline run in background, after all those having one, 
+ *  ordered by their priorities.
+ */
+
+/* --------------------------------- Module -------------------------------- */
+#ifndef __RKHSMA_EDF_H__
+#define __RKHSMA_EDF_H__
+
+/* ----------------------------- Include files ----------------------------- */
+#include "rkhitl.h"
+#include "rkhtmr.h"
+#include "rkhsma_prio.h"
+
+/* ---------------------- External C language linkage ---------------------- */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* --------------------------------- Macros -------------------------------- */
+/* -------------------------------- Constants ------------------------------ */
+/**
+ *  \brief
+ *  Enables the earliest-deadline-first ordering of the ready list.
+ */
+#ifndef RKH_CFG_SMA_EDF_EN
+#define RKH_CFG_SMA_EDF_EN          RKH_DISABLED
+#endif
+
+/**
+ *  \brief
+ *  Relative deadline which instructs the earliest-deadline-first ordering 
+ *  to take the absolute deadline carried by the event at the head of the 
+ *  queue of the active object (see RKHDeadlineEvt).
+ */
+#define RKH_EDF_EVT_DEADLINE        ((RKH_TNT_T)-1)
+
+/* ------------------------------- Data types ------------------------------ */
+/**
+ *  \brief
+ *  Event carrying its own absolute deadline, in timer-ticks as returned by 
+ *  rkh_tmr_getTicks(). Every event posted to an active object whose 
+ *  relative deadline is RKH_EDF_EVT_DEADLINE must derive from it.
+ */
+typedef struct RKHDeadlineEvt RKHDeadlineEvt;
+struct RKHDeadlineEvt
+{
+    RKH_EVT_T evt;
+    RKH_TNT_T deadline;
+};
+
+/* -------------------------- External variables --------------------------- */
+/* -------------------------- Function prototypes -------------------------- */
+#if RKH_CFG_SMA_EDF_EN == RKH_ENABLED
+/**
+ *  \brief
+ *  Sets the relative deadline of an active object.
+ *
+ *  Every time the active object becomes ready to run, or it takes an event 
+ *  and still has others in its queue, its absolute deadline is computed as 
+ *  the current tick count plus \a relative. Note that posting an event in 
+ *  LIFO manner does not update the deadline.
+ *
+ *  \param[in] ao          pointer to active object.
+ *  \param[in] relative    relative deadline in timer-ticks, which must be 
+ *                         less than half of the range of RKH_TNT_T. 
+ *                         Zero means no deadline and RKH_EDF_EVT_DEADLINE 
+ *                         means that the deadline is carried by each event.
+ */
+void rkh_smaPrio_setDeadline(const RKH_SMA_T *ao, RKH_TNT_T relative);
+
+/**
+ *  \brief
+ *  Retrieves the number of events taken by an active object after their 
+ *  deadlines had expired.
+ *
+ *  \param[in] ao          pointer to active object.
+ */
+rui16_t rkh_smaPrio_getDeadlineMisses(const RKH_SMA_T *ao);
+
+/**
+ *  \brief
+ *  Informs that an active object has just taken an event from its queue.
+ *
+ *  It checks whether the event missed its deadline and, if the active 
+ *  object is still ready to run, its position in the ready list is updated 
+ *  with the deadline of the next event. It is called by rkh_queue_get() 
+ *  within the critical section that takes the event from the queue of the 
+ *  active object.
+ *
+ *  \param[in] prio     number of active object's priority.
+ */
+void rkh_smaPrio_consumed(rui8_t prio);
+#endif
+
+/* -------------------- External C language linkage end -------------------- */
+#ifdef __cplusplus
+}
+#endif
+
+/* ------------------------------ Module end ------------------------------- */
+#endif
+
+/* ------------------------------ End of file ------------------------------ */
@@ -84,9 +84,7 @@ rbool_t rkh_smaPrio_isReady(void);
  *  \brief
  *  Making an active object ready-to-run inserting it into the ready list.
  *
- *  The lower 3 bits of the SMA's priority are used to determine the bit
- *  position in rkhrg.tbl[], while the next three most significant bits are
- *  used to determine the index into rkhrg.tbl[].
+ *  Sets the bit of the active object in the ready bitmap (see RKHRdyGrp).
  *
  *  \param[in] prio     number of active object's priority.
  */
@@ -96,9 +94,9 @@ void rkh_smaPrio_setReady(rui8_t prio);
  *  \brief
  *  Removing an active object from the ready list.
  *
- *  Clears the ready bit of the active object in rkhrg.tbl[] and clears the 
- *  bit in rkhrg.grp only if all active objects in a group are not ready to 
- *  run, i.e. all bits in rkhrg.tbl[prio >> 3] are 0.
+ *  Clears the ready bit of the active object in the ready bitmap and the 
+ *  bits of its upper levels only if all active objects in the group are 
+ *  not ready to run (see RKHRdyGrp).
  *
  *  \param[in] prio		number of active object's priority.
  */
@@ -108,15 +106,27 @@ void rkh_smaPrio_setUnready(rui8_t prio);
  *  \brief
  *	Finding the highest priority active object ready to run.
  *
- *	Another table lookup is performed, rather than scanning through the table
- *	starting with rkhrg.tbl[0] to find the highest priority task ready to
- *	run. Eight bits are used to represent when tasks are ready in a group. The 
- *  least significant bit has the highest priority. Using this byte to index 
- *  the table returns the bit position of the highest priority bit set, a 
- *  number between 0 and 7.
+ *	The ready bitmap is descended from its root word, one word per level, 
+ *	taking the least significant bit set, which has the highest priority 
+ *	(see RKHRdyGrp).
  */
 rui8_t rkh_smaPrio_findHighest(void);
 
+/**
+ *  \brief
+ *	Finding the active object ready to run that follows the one of \a prio 
+ *	in the ready list, without changing the ready list.
+ *
+ *	It allows the scheduler to skip an active object, for instance the one 
+ *	that exhausted its burst quota, while it is still ready to run.
+ *
+ *  \param[in] prio     number of a ready active object's priority.
+ *
+ *	\return
+ *  The found priority, or \a prio if there is no other one ready to run.
+ */
+rui8_t rkh_smaPrio_findNext(rui8_t prio);
+
 /* -------------------------------- Constants ------------------------------ */
 /* ------------------------------- Data types ------------------------------ */
 /* -------------------- External C language linkage end -------------------- */
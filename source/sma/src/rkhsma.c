@@ -53,6 +53,7 @@
 #include "rkhassert.h"
 #include "rkhitl.h"
 #include "rkhsma.h"
+#include "rkhsma_edf.h"
 #include "rkhtrc_record.h"
 #include "rkhtrc_filter.h"
 #include "rkhfwk_hook.h"
@@ -66,6 +67,15 @@ RKH_MODULE_NAME(rkhsma)
     #define RKH_SMA_GET_NMIN(ao)    0
 #endif
 
+#if RKH_CFG_SMA_GET_INFO_EN == RKH_ENABLED
+    #define INFO_RCV_EVENTS(ao)     ++(ao)->sinfo.ndevt
+    #define INFO_EXEC_TRS(ao, rc)   \
+        (((rc) == RKH_EVT_PROC) ? (void)++(ao)->sinfo.exectr : (void)0)
+#else
+    #define INFO_RCV_EVENTS(ao)     ((void)0)
+    #define INFO_EXEC_TRS(ao, rc)   ((void)(rc))
+#endif
+
 /* ------------------------------- Constants ------------------------------- */
 #if R_TRC_AO_NAME_EN == RKH_DISABLED
 RKHROM char noname[] = "null";
@@ -111,7 +121,7 @@ rkh_sma_unregister(RKH_SMA_T *sma)
     rui8_t prio = RKH_GET_PRIO(sma);
     RKH_SR_ALLOC();
 
-    RKH_REQUIRE((prio <= (rui8_t)RKH_CFG_FWK_MAX_SMA) &&
+    RKH_REQUIRE((prio <= (rui8_t)RKH_LOWEST_PRIO) &&
                 (rkh_sptbl[prio] == sma));
 
     RKH_ENTER_CRITICAL_();
@@ -173,6 +183,7 @@ rkh_sma_post_fifo(RKH_SMA_T * sma, const RKH_EVT_T * e)
     RKH_SR_ALLOC();
 
     RKH_HOOK_SIGNAL(e);
+    RKH_HOOK_POST(sma, e);
     RKH_ENTER_CRITICAL_();
 
     RKH_INC_REF(e);
@@ -197,6 +208,7 @@ rkh_sma_post_lifo(RKH_SMA_T * sma, const RKH_EVT_T * e)
     RKH_SR_ALLOC();
 
     RKH_HOOK_SIGNAL(e);
+    RKH_HOOK_POST(sma, e);
     RKH_ENTER_CRITICAL_();
 
     RKH_INC_REF(e);
@@ -229,7 +241,11 @@ rkh_sma_get(RKH_SMA_T *sma)
 void
 rkh_sma_dispatch(RKH_SMA_T *me, void *arg)
 {
-    rkh_sm_dispatch((RKH_SM_T *)me, (RKH_EVT_T *)arg);
+    ruint result;
+
+    INFO_RCV_EVENTS(me);
+    result = rkh_sm_dispatch((RKH_SM_T *)me, (RKH_EVT_T *)arg);
+    INFO_EXEC_TRS(me, result);
 }
 
 #if RKH_CFG_FWK_DEFER_EVT_EN == RKH_ENABLED
@@ -290,12 +306,21 @@ void
 rkh_sma_clear_info(RKH_SMA_T *sma)
 {
     RKH_SMAI_T *psi;
+#if RKH_CFG_FWK_SCHED_FAIR_EN == RKH_ENABLED
+    rui8_t policy;
+#endif
     RKH_SR_ALLOC();
 
     psi = &sma->sinfo;
 
     RKH_ENTER_CRITICAL_();
     sma->sinfo.ndevt = sma->sinfo.exectr = 0;
+#if RKH_CFG_FWK_SCHED_FAIR_EN == RKH_ENABLED
+    for (policy = 0; policy < RKH_SCHED_NUM_POLICIES; ++policy)
+    {
+        sma->sinfo.ndpolicy[policy] = 0;
+    }
+#endif
     RKH_EXIT_CRITICAL_();
 }
 
@@ -0,0 +1,287 @@
+/*
+ *  --------------------------------------------------------------------------
+ *
+ *                                Framework RKH
+ *                                -------------
+ *
+ *            State-machine framework for reactive embedded systems
+ *
+ *                      Copyright (C) 2010 Leandro Francucci.
+ *          All rights reserved. Protected by international copyright laws.
+ *
+ *
+ *  RKH is free software: you can redistribute it and/or modify it under the
+ *  terms of the GNU General Public License as published by the Free Software
+ *  Foundation, either version 3 of the License, or (at your option) any
+ *  later version.
+ *
+ *  RKH is distributed in the hope that it will be useful, but WITHOUT ANY
+ *  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with RKH, see copying.txt file.
+ *
+ *  Contact information:
+ *  RKH site: http://vortexmakes.com/que-es/
+ *  RKH GitHub: https://github.com/vortexmakes/RKH
+ *  RKH Sourceforge: https://sourceforge.net/projects/rkh-reactivesys/
+ *  e-mail: lf@vortexmakes.com
+ *  ---------------------------------------------------------------------------
+ */
+
+
+/**
+ *  \file       rkhsma_edf.c
+ *  \brief      Earliest-deadline-first ready list for active object 
+ *              scheduling
+ *  \ingroup    sma
+ */
+
+/* -------------------------- Development history -------------------------- */
+/*
+ *  2026.10.19  LeFr  v3.4.00  Initial version
+ */
+
+/* -------------------------------- Authors -------------------------------- */
+/*
+ *  LeFr  Leandro Francucci  lf@vortexmakes.com
+ */
+
+/* --------------------------------- Notes --------------------------------- */
+/*
+ *  The ready active objects are kept in a singly-linked list sorted by 
+ *  absolute deadline, so that finding the next one to run takes constant 
+ *  time while inserting one is linear in the number of ready active 
+ *  objects. The deadlines are compared by means of a wrap-safe difference, 
+ *  that is why the relative deadlines must be less than half of the range 
+ *  of RKH_TNT_T. As with the ready bitmap, its zero-initialized state is 
+ *  an empty ready list, so that rkh_smaPrio_init() is optional. That is 
+ *  why the links are stored as priority plus one, zero meaning the end of 
+ *  the list.
+ */
+
+/* ----------------------------- Include files ----------------------------- */
+#include "rkhsma_edf.h"
+#include "rkhassert.h"
+#include "rkhfwk_module.h"
+#include "rkhsma.h"
+#include "rkhtrc_record.h"
+#include "rkhtrc_filter.h"
+
+#if RKH_CFG_SMA_EDF_EN == RKH_ENABLED
+
+RKH_MODULE_NAME(rkhsma_edf)
+
+/* ----------------------------- Local macros ------------------------------ */
+#define IS_EARLIER(a_, b_) \
+    ((RKH_TNT_T)((a_) - (b_)) >= (RKH_TNT_T)(((RKH_TNT_T)-1 >> 1) + 1u))
+
+#define TO_LINK(prio_)      (rui8_t)((prio_) + 1u)
+#define TO_PRIO(link_)      (rui8_t)((link_) - 1u)
+
+/* ------------------------------- Constants ------------------------------- */
+#define NONE        0u                          /* end of the ready list */
+
+/* ---------------------------- Local data types --------------------------- */
+/* ---------------------------- Global variables --------------------------- */
+/* ---------------------------- Local variables ---------------------------- */
+static rui8_t head;
+static rui8_t next[RKH_CFG_FWK_MAX_SMA];
+static rbool_t linked[RKH_CFG_FWK_MAX_SMA];
+static RKH_TNT_T deadline[RKH_CFG_FWK_MAX_SMA];     /* absolute */
+static RKH_TNT_T relDeadline[RKH_CFG_FWK_MAX_SMA];
+static rui16_t nMisses[RKH_CFG_FWK_MAX_SMA];
+
+/* ----------------------- Local function prototypes ----------------------- */
+/* ---------------------------- Local functions ---------------------------- */
+static void
+computeDeadline(rui8_t prio)
+{
+    RKH_SMA_T *ao;
+
+    if (relDeadline[prio] == RKH_EDF_EVT_DEADLINE)
+    {
+        ao = rkh_sptbl[prio];
+        RKH_ASSERT((ao != (RKH_SMA_T *)0) && (ao->equeue.qty != 0));
+        deadline[prio] = ((const RKHDeadlineEvt *)*ao->equeue.pout)->deadline;
+    }
+    else if (relDeadline[prio] != 0)
+    {
+        deadline[prio] = (RKH_TNT_T)(rkh_tmr_getTicks() + relDeadline[prio]);
+    }
+}
+
+/*
+ *  Evaluates to true if the active object 'a' must run before 'b'. Those 
+ *  without a deadline run after the others, by priority.
+ */
+static rbool_t
+isBefore(rui8_t a, rui8_t b)
+{
+    if (relDeadline[a] == 0)
+    {
+        return (relDeadline[b] == 0) && (a < b);
+    }
+    if (relDeadline[b] == 0)
+    {
+        return RKH_TRUE;
+    }
+    if (deadline[a] == deadline[b])
+    {
+        return a < b;
+    }
+    return IS_EARLIER(deadline[a], deadline[b]);
+}
+
+static void
+link(rui8_t prio)
+{
+    rui8_t *p;
+
+    computeDeadline(prio);
+    for (p = &head; (*p != NONE) && !isBefore(prio, TO_PRIO(*p)); 
+         p = &next[TO_PRIO(*p)])
+    {
+    }
+    next[prio] = *p;
+    *p = TO_LINK(prio);
+    linked[prio] = RKH_TRUE;
+}
+
+static void
+unlink(rui8_t prio)
+{
+    rui8_t *p;
+
+    for (p = &head; *p != TO_LINK(prio); p = &next[TO_PRIO(*p)])
+    {
+        RKH_ASSERT(*p != NONE);
+    }
+    *p = next[prio];
+    next[prio] = NONE;
+    linked[prio] = RKH_FALSE;
+}
+
+/* ---------------------------- Global functions --------------------------- */
+void 
+rkh_smaPrio_init(void)
+{
+    rui8_t prio;
+
+    head = NONE;
+    for (prio = 0; prio < RKH_CFG_FWK_MAX_SMA; ++prio)
+    {
+        next[prio] = NONE;
+        linked[prio] = RKH_FALSE;
+        deadline[prio] = 0;
+        relDeadline[prio] = 0;
+        nMisses[prio] = 0;
+    }
+}
+
+rbool_t 
+rkh_smaPrio_isNotReady(void)
+{
+    return head == NONE;
+}
+
+rbool_t 
+rkh_smaPrio_isReady(void)
+{
+    return head != NONE;
+}
+
+void 
+rkh_smaPrio_setReady(rui8_t prio)
+{
+    RKH_REQUIRE(prio < RKH_CFG_FWK_MAX_SMA);
+    if (!linked[prio])
+    {
+        link(prio);
+    }
+}
+
+void 
+rkh_smaPrio_setUnready(rui8_t prio)
+{
+    RKH_REQUIRE(prio < RKH_CFG_FWK_MAX_SMA);
+    if (linked[prio])
+    {
+        unlink(prio);
+    }
+}
+
+rui8_t 
+rkh_smaPrio_findHighest(void)
+{
+    return TO_PRIO(head);
+}
+
+rui8_t 
+rkh_smaPrio_findNext(rui8_t prio)
+{
+    RKH_REQUIRE((prio < RKH_CFG_FWK_MAX_SMA) && linked[prio]);
+    return (next[prio] != NONE) ? TO_PRIO(next[prio]) : prio;
+}
+
+void
+rkh_smaPrio_setDeadline(const RKH_SMA_T *ao, RKH_TNT_T relative)
+{
+    rui8_t prio;
+    RKH_SR_ALLOC();
+
+    RKH_REQUIRE(ao != (const RKH_SMA_T *)0);
+    prio = RKH_GET_PRIO(ao);
+    RKH_REQUIRE((prio < RKH_CFG_FWK_MAX_SMA) && 
+                ((relative == RKH_EDF_EVT_DEADLINE) ||
+                 (relative <= ((RKH_TNT_T)-1 >> 1))));
+
+    RKH_ENTER_CRITICAL_();
+    relDeadline[prio] = relative;
+    if (linked[prio])
+    {
+        unlink(prio);
+        link(prio);
+    }
+    RKH_EXIT_CRITICAL_();
+}
+
+rui16_t
+rkh_smaPrio_getDeadlineMisses(const RKH_SMA_T *ao)
+{
+    rui8_t prio;
+
+    RKH_REQUIRE(ao != (const RKH_SMA_T *)0);
+    prio = RKH_GET_PRIO(ao);
+    RKH_REQUIRE(prio < RKH_CFG_FWK_MAX_SMA);
+    return nMisses[prio];
+}
+
+void
+rkh_smaPrio_consumed(rui8_t prio)
+{
+    RKH_TNT_T now;
+
+    RKH_REQUIRE(prio < RKH_CFG_FWK_MAX_SMA);
+    if (relDeadline[prio] != 0)
+    {
+        now = rkh_tmr_getTicks();
+        if (IS_EARLIER(deadline[prio], now))
+        {
+            ++nMisses[prio];
+            RKH_TR_SMA_DLMISS(rkh_sptbl[prio], 
+                              (RKH_TNT_T)(now - deadline[prio]));
+        }
+    }
+    if (linked[prio])
+    {
+        unlink(prio);
+        link(prio);
+    }
+}
+
+#endif
+
+/* ------------------------------ End of file ------------------------------ */
@@ -55,6 +55,9 @@
 #include "rkhassert.h"
 #include "rkhfwk_module.h"
 #include "rkhfwk_rdygrp.h"
+#include "rkhsma_edf.h"
+
+#if RKH_CFG_SMA_EDF_EN == RKH_DISABLED
 
 RKH_MODULE_NAME(rkhsma_prio)
 
@@ -106,4 +109,13 @@ rkh_smaPrio_findHighest(void)
     return rkh_rdygrp_findHighest(&readyGroup);
 }
 
+rui8_t 
+rkh_smaPrio_findNext(rui8_t prio)
+{
+    RKH_REQUIRE(prio < RKH_CFG_FWK_MAX_SMA);
+    return rkh_rdygrp_findNext(&readyGroup, prio);
+}
+
+#endif
+
 /* ------------------------------ End of file ------------------------------ */
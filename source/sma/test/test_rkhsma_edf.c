@@ -0,0 +1,367 @@
+/*
+ *  --------------------------------------------------------------------------
+ *
+ *                                Framework RKH
+ *                                -------------
+ *
+ *            State-machine framework for reactive embedded systems
+ *
+ *                      Copyright (C) 2010 Leandro Francucci.
+ *          All rights reserved. Protected by international copyright laws.
+ *
+ *
+ *  RKH is free software: you can redistribute it and/or modify it under the
+ *  terms of the GNU General Public License as published by the Free Software
+ *  Foundation, either version 3 of the License, or (at your option) any
+ *  later version.
+ *
+ *  RKH is distributed in the hope that it will be useful, but WITHOUT ANY
+ *  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with RKH, see copying.txt file.
+ *
+ *  Contact information:
+ *  RKH site: http://vortexmakes.com/que-es/
+ *  RKH GitHub: https://github.com/vortexmakes/RKH
+ *  RKH Sourceforge: https://sourceforge.net/projects/rkh-reactivesys/
+ *  e-mail: lf@vortexmakes.com
+ *  ---------------------------------------------------------------------------
+ */
+
+/**
+ *  \file       test_rkhsma_edf.c
+ *  \ingroup    test_sma
+ *  \brief      Unit test for the earliest-deadline-first ready list of sma
+ *              module.
+ *
+ *  \addtogroup test
+ *  @{
+ *  \addtogroup test_sma SMA
+ *  @{
+ *  \brief      Unit test for sma module.
+ */
+
+/* -------------------------- Development history -------------------------- */
+/*
+ *  2026.10.19  LeFr  v3.4.00  Initial version
+ */
+
+/* -------------------------------- Authors -------------------------------- */
+/*
+ *  LeFr  Leandro Francucci  lf@vortexmakes.com
+ */
+
+/* --------------------------------- Notes --------------------------------- */
+/*
+ *  This test requires RKH_CFG_SMA_EDF_EN set to RKH_ENABLED, which is
+ *  defined for this test file only in project.yml. The timer-tick counter
+ *  is replaced by a fake one, so that every test fixes the current time.
+ */
+
+/* ----------------------------- Include files ----------------------------- */
+#include "unity.h"
+#include "rkhsma_edf.h"
+#include "Mock_rkhsma.h"
+#include "Mock_rkhtrc_record.h"
+#include "Mock_rkhtrc_filter.h"
+#include "Mock_rkhport.h"
+#include "Mock_rkhassert.h"
+
+/* ----------------------------- Local macros ------------------------------ */
+/* ------------------------------- Constants ------------------------------- */
+/* ---------------------------- Local data types --------------------------- */
+/* ---------------------------- Global variables --------------------------- */
+int GlobalExpectCount;
+int GlobalVerifyOrder;
+char *GlobalOrderError;
+RKH_SMA_T *rkh_sptbl[RKH_CFG_FWK_MAX_SMA];
+
+/* ---------------------------- Local variables ---------------------------- */
+static RKHROM RKH_ROM_T base[] =
+{
+    {0, 0, "ao0"}, {1, 0, "ao1"}, {2, 0, "ao2"}, {3, 0, "ao3"}
+};
+static RKH_SMA_T aos[4];
+static RKH_SMA_T *const ao0 = &aos[0];
+static RKH_SMA_T *const ao1 = &aos[1];
+static RKH_SMA_T *const ao2 = &aos[2];
+static RKH_SMA_T *const ao3 = &aos[3];
+static RKH_TNT_T now;
+static RKHDeadlineEvt evtA, evtB;
+static void *queue[2];
+
+/* ----------------------- Local function prototypes ----------------------- */
+/* ---------------------------- Local functions ---------------------------- */
+static void
+MockAssertCallback(const char* const file, int line, int cmock_num_calls)
+{
+    TEST_PASS();
+}
+
+static void
+setReady(RKH_SMA_T *ao, RKH_TNT_T relative)
+{
+    rkh_smaPrio_setDeadline(ao, relative);
+    rkh_smaPrio_setReady(RKH_GET_PRIO(ao));
+}
+
+static void
+checkReadyList(const rui8_t *order, int nElems)
+{
+    rui8_t prio;
+
+    prio = rkh_smaPrio_findHighest();
+    for (; nElems > 1; --nElems, ++order)
+    {
+        TEST_ASSERT_EQUAL(*order, prio);
+        prio = rkh_smaPrio_findNext(prio);
+    }
+    TEST_ASSERT_EQUAL(*order, prio);
+    TEST_ASSERT_EQUAL(prio, rkh_smaPrio_findNext(prio));
+}
+
+static void
+expectDeadlineMiss(void)
+{
+    rkh_trc_isoff__ExpectAndReturn(RKH_TE_SMA_DLMISS, RKH_FALSE);
+}
+
+/* ---------------------------- Global functions --------------------------- */
+RKH_TNT_T
+rkh_tmr_getTicks(void)
+{
+    return now;
+}
+
+void
+setUp(void)
+{
+    rui8_t prio;
+
+    Mock_rkhtrc_record_Init();
+    Mock_rkhtrc_filter_Init();
+    Mock_rkhport_Init();
+    Mock_rkhassert_Init();
+
+    rkh_enter_critical_Ignore();
+    rkh_exit_critical_Ignore();
+    now = 100;
+    for (prio = 0; prio < 4; ++prio)
+    {
+        aos[prio].sm.romrkh = &base[prio];
+        aos[prio].equeue.qty = 0;
+        rkh_sptbl[prio] = &aos[prio];
+    }
+    rkh_smaPrio_init();
+}
+
+void
+tearDown(void)
+{
+    Mock_rkhtrc_record_Verify();
+    Mock_rkhtrc_filter_Verify();
+    Mock_rkhport_Verify();
+    Mock_rkhassert_Verify();
+    Mock_rkhtrc_record_Destroy();
+    Mock_rkhtrc_filter_Destroy();
+    Mock_rkhport_Destroy();
+    Mock_rkhassert_Destroy();
+}
+
+/**
+ *  \addtogroup test_edf Test cases of earliest-deadline-first group
+ *  @{
+ *  \name Test cases of earliest-deadline-first group
+ *  @{
+ */
+void
+test_ClearAfterInit(void)
+{
+    TEST_ASSERT_EQUAL(0, rkh_smaPrio_isReady());
+    TEST_ASSERT_EQUAL(1, rkh_smaPrio_isNotReady());
+}
+
+void
+test_InsertActiveObjectsByDeadline(void)
+{
+    const rui8_t order[] = {2, 3, 1};
+
+    setReady(ao1, 30);
+    setReady(ao2, 10);
+    setReady(ao3, 20);
+
+    TEST_ASSERT_EQUAL(1, rkh_smaPrio_isReady());
+    checkReadyList(order, 3);
+}
+
+void
+test_InsertActiveObjectsWithoutDeadlineLast(void)
+{
+    const rui8_t order[] = {2, 0, 3};
+
+    setReady(ao3, 0);
+    setReady(ao2, 50);
+    setReady(ao0, 0);
+
+    checkReadyList(order, 3);
+}
+
+void
+test_InsertActiveObjectsWithTheSameDeadlineByPriority(void)
+{
+    const rui8_t order[] = {1, 2};
+
+    setReady(ao2, 10);
+    setReady(ao1, 10);
+
+    checkReadyList(order, 2);
+}
+
+void
+test_SetUnreadyActiveObject(void)
+{
+    const rui8_t order[] = {1, 3};
+
+    setReady(ao1, 10);
+    setReady(ao2, 20);
+    setReady(ao3, 30);
+    rkh_smaPrio_setUnready(2);
+
+    checkReadyList(order, 2);
+    rkh_smaPrio_setUnready(1);
+    rkh_smaPrio_setUnready(3);
+    TEST_ASSERT_EQUAL(1, rkh_smaPrio_isNotReady());
+}
+
+void
+test_TakeDeadlineFromTheEventAtTheHeadOfTheQueue(void)
+{
+    const rui8_t before[] = {1, 2};
+    const rui8_t after[] = {2, 1};
+
+    evtA.deadline = 105;
+    evtB.deadline = 120;
+    queue[0] = &evtA;
+    queue[1] = &evtB;
+    ao1->equeue.pout = queue;
+    ao1->equeue.qty = 2;
+
+    setReady(ao1, RKH_EDF_EVT_DEADLINE);
+    setReady(ao2, 10);
+    checkReadyList(before, 2);
+
+    ao1->equeue.pout = &queue[1];
+    ao1->equeue.qty = 1;
+    rkh_smaPrio_consumed(1);
+    checkReadyList(after, 2);
+    TEST_ASSERT_EQUAL(0, rkh_smaPrio_getDeadlineMisses(ao1));
+}
+
+void
+test_ConsumedRelinksActiveObjectWithNewDeadline(void)
+{
+    const rui8_t before[] = {1, 2, 0};
+    const rui8_t after[] = {2, 1, 0};
+
+    setReady(ao0, 0);
+    setReady(ao1, 10);
+    setReady(ao2, 15);
+    checkReadyList(before, 3);
+
+    now += 8;
+    rkh_smaPrio_consumed(1);
+    checkReadyList(after, 3);
+    TEST_ASSERT_EQUAL(0, rkh_smaPrio_getDeadlineMisses(ao1));
+}
+
+void
+test_ConsumedKeepsUnreadyActiveObjectUnlinked(void)
+{
+    const rui8_t order[] = {2};
+
+    setReady(ao1, 10);
+    setReady(ao2, 15);
+    rkh_smaPrio_setUnready(1);
+
+    rkh_smaPrio_consumed(1);
+    checkReadyList(order, 1);
+}
+
+void
+test_CompareDeadlinesAcrossTickWraparound(void)
+{
+    const rui8_t order[] = {2, 1, 3};
+
+    now = (RKH_TNT_T)(0u - 16u);
+    setReady(ao1, 32);          /* wraps around to 16 */
+    setReady(ao2, 8);           /* does not wrap around */
+    setReady(ao3, 48);          /* wraps around to 32 */
+
+    checkReadyList(order, 3);
+}
+
+void
+test_MissedDeadlineIsCountedAndTraced(void)
+{
+    setReady(ao1, 5);
+
+    now += 9;
+    expectDeadlineMiss();
+    rkh_smaPrio_consumed(1);
+
+    TEST_ASSERT_EQUAL(1, rkh_smaPrio_getDeadlineMisses(ao1));
+    TEST_ASSERT_EQUAL(0, rkh_smaPrio_getDeadlineMisses(ao2));
+}
+
+void
+test_MetDeadlineIsNotCounted(void)
+{
+    setReady(ao1, 5);
+
+    now += 5;
+    rkh_smaPrio_consumed(1);
+
+    TEST_ASSERT_EQUAL(0, rkh_smaPrio_getDeadlineMisses(ao1));
+}
+
+void
+test_ActiveObjectWithoutDeadlineNeverMisses(void)
+{
+    setReady(ao1, 0);
+
+    now += 1000;
+    rkh_smaPrio_consumed(1);
+
+    TEST_ASSERT_EQUAL(0, rkh_smaPrio_getDeadlineMisses(ao1));
+}
+
+void
+test_Fails_InvalidRelativeDeadline(void)
+{
+    rkh_assert_Expect("rkhsma_edf", 0);
+    rkh_assert_IgnoreArg_file();
+    rkh_assert_IgnoreArg_line();
+    rkh_assert_StubWithCallback(MockAssertCallback);
+
+    rkh_smaPrio_setDeadline(ao1, (RKH_TNT_T)(RKH_EDF_EVT_DEADLINE - 1u));
+}
+
+void
+test_Fails_FindNextOfUnreadyActiveObject(void)
+{
+    rkh_assert_Expect("rkhsma_edf", 0);
+    rkh_assert_IgnoreArg_file();
+    rkh_assert_IgnoreArg_line();
+    rkh_assert_StubWithCallback(MockAssertCallback);
+
+    rkh_smaPrio_findNext(1);
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/* ------------------------------ End of file ------------------------------ */
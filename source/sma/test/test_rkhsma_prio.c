@@ -227,6 +227,22 @@ test_SetMultipleActiveObjectsUnready(void)
     TEST_ASSERT_EQUAL(0, result);
 }
 
+void
+test_FindNextActiveObjectReadyToRun(void)
+{
+    rui8_t prio = 1, nextPrio = 15, resultPrio;
+
+    rkh_rdygrp_init_Expect(0);
+    rkh_rdygrp_init_IgnoreArg_me();
+    rkh_rdygrp_findNext_ExpectAndReturn(0, prio, nextPrio);
+    rkh_rdygrp_findNext_IgnoreArg_me();
+
+    rkh_smaPrio_init();
+    resultPrio = rkh_smaPrio_findNext(prio);
+
+    TEST_ASSERT_EQUAL(nextPrio, resultPrio);
+}
+
 void
 test_Fails_InvalidActiveObjectOnSet(void)
 {
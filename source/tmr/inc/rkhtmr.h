@@ -476,6 +476,21 @@ rbool_t rkh_tmr_stop(RKH_TMR_T *t);
  */
 void rkh_tmr_init(void);
 
+/**
+ *  \brief
+ *  Retrieves the number of timer-ticks elapsed since rkh_tmr_init() was 
+ *  invoked, modulo the range of RKH_TNT_T. It is the time base of the 
+ *  earliest-deadline-first scheduling (see RKH_CFG_SMA_EDF_EN).
+ *
+ *  \note
+ *  It does not enter a critical section by itself, so it can be called 
+ *  with interrupts disabled. Otherwise, it must be invoked within a 
+ *  critical section when a RKH_TNT_T value cannot be read atomically.
+ *
+ *  \ingroup apiTmr
+ */
+RKH_TNT_T rkh_tmr_getTicks(void);
+
 /**
  *  \brief
  *  Retrieves performance information for a particular software timer.
@@ -91,6 +91,7 @@ RKH_MODULE_NAME(rkhtmr)
 /* ---------------------------- Global variables --------------------------- */
 /* ---------------------------- Local variables ---------------------------- */
 static RKH_TMR_T * thead;
+static RKH_TNT_T nTicks;
 
 /* ----------------------- Local function prototypes ----------------------- */
 /* ---------------------------- Local functions ---------------------------- */
@@ -136,6 +137,7 @@ rkh_tmr_tick(void)
 
     RKH_HOOK_TIMETICK();    /* call user definable hook */
     RKH_ENTER_CRITICAL_();
+    ++nTicks;
     for (tprev = CPTIM(0), t = thead; t != CPTIM(0); t = t->tnext)
     {
         if (t->used == 0)
@@ -245,6 +247,13 @@ void
 rkh_tmr_init(void)
 {
     thead = 0;
+    nTicks = 0;
+}
+
+RKH_TNT_T
+rkh_tmr_getTicks(void)
+{
+    return nTicks;
 }
 
 #if RKH_CFG_TMR_GET_INFO_EN == RKH_ENABLED
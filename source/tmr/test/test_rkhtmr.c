@@ -524,6 +524,23 @@ test_CallTickWithoutStartedTimers(void)
     rkh_tmr_tick(0);
 }
 
+void
+test_CountElapsedTicks(void)
+{
+    rkh_enter_critical_Ignore();
+    rkh_trc_isoff__IgnoreAndReturn(RKH_FALSE);
+    rkh_hook_timetick_Ignore();
+    rkh_exit_critical_Ignore();
+
+    rkh_tmr_init();
+    TEST_ASSERT_EQUAL(0, rkh_tmr_getTicks());
+    rkh_tmr_tick(0);
+    rkh_tmr_tick(0);
+    TEST_ASSERT_EQUAL(2, rkh_tmr_getTicks());
+    rkh_tmr_init();
+    TEST_ASSERT_EQUAL(0, rkh_tmr_getTicks());
+}
+
 void
 test_ReinitializeTheFirstTimerInTheList(void)
 {
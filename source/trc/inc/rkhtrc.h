@@ -165,7 +165,8 @@
  *				RKH_TRC_USR_BEGIN() takes one argument, 'eid_' is the 
  *				user trace event ID, from the RKH_TE_USER value. This pair 
  *				of macros locks interrupts at the beginning and unlocks at 
- *				the end of each record.
+ *				the end of each record, unless the records are built into 
+ *				per-thread rings (#RKH_CFG_TRC_MAX_RINGS > 0).
  *	\li (2-4)   Sandwiched between these two macros are the
  *				argument-generating macros that actually insert individual
  *				event argument elements into the trace stream.
@@ -0,0 +1,271 @@
+/*
+ *  --------------------------------------------------------------------------
+ *
+ *                                Framework RKH
+ *                                -------------
+ *
+ *            State-machine framework for reactive embedded systems
+ *
+ *                      Copyright (C) 2010 Leandro Francucci.
+ *          All rights reserved. Protected by international copyright laws.
+ *
+ *
+ *  RKH is free software: you can redistribute it and/or modify it under the
+ *  terms of the GNU General Public License as published by the Free Software
+ *  Foundation, either version 3 of the License, or (at your option) any
+ *  later version.
+ *
+ *  RKH is distributed in the hope that it will be useful, but WITHOUT ANY
+ *  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with RKH, see copying.txt file.
+ *
+ *  Contact information:
+ *  RKH site: http://vortexmakes.com/que-es/
+ *  RKH GitHub: https://github.com/vortexmakes/RKH
+ *  RKH Sourceforge: https://sourceforge.net/projects/rkh-reactivesys/
+ *  e-mail: lf@vortexmakes.com
+ *  ---------------------------------------------------------------------------
+ */
+
+
+/**
+ *  \file       rkhtrc_decode.h
+ *  \brief      Specifies the trace stream decoder, which turns the framed 
+ *              bytes of the trace stream back into trace records.
+ *  \ingroup    apiTrc
+ */
+
+/* -------------------------- Development history -------------------------- */
+/*
+ *  2026.10.19  LeFr  v3.4.00  Initial version
+ */
+
+/* -------------------------------- Authors -------------------------------- */
+/*
+ *  LeFr  Leandro Francucci  lf@vortexmakes.com
+ */
+
+/* --------------------------------- Notes --------------------------------- */
+/*
+ *  The decoder is meant to run on the host, i.e. in a tool reading the 
+ *  trace stream from a link or a file. It removes the framing, verifies the 
+ *  checksum and the sequence number, expands the compact trace format (see 
+ *  RKH_CFG_TRC_COMPACT_EN) and splits the arguments of the framework's 
+ *  trace events, according to the target's options. These options are 
+ *  taken from the RKH_TE_FWK_TCFG record as soon as it is received, so 
+ *  that the decoder is built with its own rkhcfg.h.
+ *
+ *  In the compact format, a timestamp is the delta from the previous 
+ *  record, coded as LEB128(delta << 1), except in key records, which code 
+ *  LEB128(1) followed by the whole timestamp. An address is coded as 
+ *  LEB128(0) if it is null, LEB128(index << 1) if it is known, or 
+ *  LEB128((index << 1) | 1) followed by the whole address when it is used 
+ *  for the first time since the last key record. The index 0 is used for 
+ *  addresses out of the symbol table of the target. Lost records are 
+ *  detected by the sequence number, if any, and the decoder marks the 
+ *  next records as not synchronized until a key record arrives.
+ */
+
+/* --------------------------------- Module -------------------------------- */
+#ifndef __RKHTRC_DECODE_H__
+#define __RKHTRC_DECODE_H__
+
+/* ----------------------------- Include files ----------------------------- */
+#include "rkhtrc_define.h"
+
+/* ---------------------- External C language linkage ---------------------- */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* --------------------------------- Macros -------------------------------- */
+/* -------------------------------- Constants ------------------------------ */
+/**
+ *  \brief
+ *  Maximum size of a trace record, without framing, accepted by the 
+ *  decoder [in bytes].
+ */
+#ifndef RKH_TRC_DEC_SIZEOF_FRAME
+#define RKH_TRC_DEC_SIZEOF_FRAME        512u
+#endif
+
+/**
+ *  \brief
+ *  Maximum number of arguments split out of a trace record.
+ */
+#ifndef RKH_TRC_DEC_MAX_ARGS
+#define RKH_TRC_DEC_MAX_ARGS            16u
+#endif
+
+/**
+ *  \brief
+ *  Number of symbol indexes known by the decoder, which must not be less 
+ *  than RKH_CFG_TRC_SIZEOF_SYMTBL of the target.
+ */
+#define RKH_TRC_DEC_SIZEOF_SYMTBL       256u
+
+/** \name Target options, as the bits of the RKH_TE_FWK_TCFG record */
+/** @{ */
+#define RKH_TRC_DEC_SNDR_EN             0x00000001ul
+#define RKH_TRC_DEC_QUE_LWM_EN          0x00000800ul
+#define RKH_TRC_DEC_MP_LWM_EN           0x00001000ul
+#define RKH_TRC_DEC_NSEQ_EN             0x00008000ul
+#define RKH_TRC_DEC_TSTAMP_EN           0x00010000ul
+#define RKH_TRC_DEC_CHK_EN              0x00020000ul
+#define RKH_TRC_DEC_COMPACT_EN          0x00040000ul
+/** @} */
+
+/* ------------------------------- Data types ------------------------------ */
+/**
+ *  \brief
+ *  Kinds of trace record arguments.
+ */
+typedef enum RKHTrcDecKind
+{
+    RKH_TRC_DEC_INT,        /**< integer, in value */
+    RKH_TRC_DEC_SIG,        /**< event signal, in value */
+    RKH_TRC_DEC_SYM,        /**< object address, in value */
+    RKH_TRC_DEC_FUN,        /**< function address, in value */
+    RKH_TRC_DEC_UNKNOWN,    /**< address whose definition was lost */
+    RKH_TRC_DEC_STR,        /**< string, in data, of value bytes */
+    RKH_TRC_DEC_MEM         /**< memory block, in data, of value bytes */
+} RKHTrcDecKind;
+
+/**
+ *  \brief
+ *  Argument of a decoded trace record.
+ */
+typedef struct RKHTrcDecArg RKHTrcDecArg;
+struct RKHTrcDecArg
+{
+    rui8_t kind;            /**< RKHTrcDecKind */
+    rui8_t fmt;             /**< RKH_TRC_FMT of user arguments, or 0xff */
+    rui32_t value;          /**< value, address or length */
+    const rui8_t *data;     /**< string or memory block, or NULL */
+};
+
+/**
+ *  \brief
+ *  Decoded trace record. It is valid until the next byte is put into the 
+ *  decoder.
+ */
+typedef struct RKHTrcDecRecord RKHTrcDecRecord;
+struct RKHTrcDecRecord
+{
+    RKH_TE_ID_T eid;        /**< trace event ID */
+    rui8_t nseq;            /**< sequence number, if any */
+    rui32_t tstamp;         /**< timestamp, if any */
+    rbool_t isSynced;       /**< timestamp and addresses are reliable */
+    rui8_t nArgs;           /**< number of split arguments */
+    RKHTrcDecArg args[RKH_TRC_DEC_MAX_ARGS];    /**< split arguments */
+    const rui8_t *data;     /**< arguments, as received */
+    rui32_t size;           /**< size of data [in bytes] */
+};
+
+/**
+ *  \brief
+ *  Trace options of the target. Sizes are given in bytes.
+ */
+typedef struct RKHTrcDecCfg RKHTrcDecCfg;
+struct RKHTrcDecCfg
+{
+    rui32_t options;        /**< RKH_TRC_DEC_<option>_EN bits */
+    rui8_t sizeofTstamp;    /**< RKH_CFGPORT_TRC_SIZEOF_TSTAMP */
+    rui8_t sizeofPtr;       /**< RKH_CFGPORT_TRC_SIZEOF_PTR */
+    rui8_t sizeofFunPtr;    /**< RKH_CFGPORT_TRC_SIZEOF_FUN_PTR */
+    rui8_t sizeofSig;       /**< RKH_CFG_FWK_SIZEOF_EVT */
+    rui8_t sizeofEvtSize;   /**< RKH_CFG_FWK_SIZEOF_EVT_SIZE */
+    rui8_t sizeofNtick;     /**< RKH_CFG_TMR_SIZEOF_NTIMER */
+    rui8_t sizeofNblock;    /**< RKH_CFG_MP_SIZEOF_NBLOCK */
+    rui8_t sizeofBsize;     /**< RKH_CFG_MP_SIZEOF_BSIZE */
+    rui8_t sizeofNelem;     /**< RKH_CFG_QUE_SIZEOF_NELEM */
+};
+
+/**
+ *  \brief
+ *  Trace stream decoder. Its members must not be accessed directly.
+ */
+typedef struct RKHTrcDec RKHTrcDec;
+struct RKHTrcDec
+{
+    RKHTrcDecCfg cfg;       /**< trace options of the target */
+    rui8_t frame[RKH_TRC_DEC_SIZEOF_FRAME];  /**< record being received */
+    rui32_t nFrame;         /**< number of bytes in frame */
+    rbool_t isHunting;      /**< waiting for the first flag */
+    rbool_t isEsc;          /**< the previous byte was RKH_ESC */
+    rbool_t isOverflow;     /**< the record does not fit in frame */
+    rbool_t isFirst;        /**< no record received yet */
+    rbool_t isSynced;       /**< timestamp and symbols are reliable */
+    rui8_t nseq;            /**< last sequence number */
+    rui32_t tstamp;         /**< last timestamp */
+    rui32_t symTbl[RKH_TRC_DEC_SIZEOF_SYMTBL];  /**< index - 1 -> address */
+    rui32_t nRecords;       /**< number of decoded records */
+    rui32_t nErrors;        /**< number of malformed records */
+    rui32_t nLost;          /**< number of lost records, by nseq */
+    RKHTrcDecRecord rec;    /**< last decoded record */
+};
+
+/* -------------------------- External variables --------------------------- */
+/* -------------------------- Function prototypes -------------------------- */
+/**
+ *  \brief
+ *  Initializes a decoder.
+ *
+ *  \param[in] me       pointer to decoder.
+ *  \param[in] cfg      trace options of the target, or NULL to use the 
+ *                      ones of this build until a RKH_TE_FWK_TCFG record 
+ *                      is received.
+ */
+void rkh_trcDec_init(RKHTrcDec *me, const RKHTrcDecCfg *cfg);
+
+/**
+ *  \brief
+ *  Puts a byte of the trace stream into the decoder.
+ *
+ *  \param[in] me       pointer to decoder.
+ *  \param[in] b        byte of the trace stream.
+ *
+ *  \return
+ *  The decoded record if \a b completes a valid one, otherwise NULL.
+ */
+const RKHTrcDecRecord *rkh_trcDec_put(RKHTrcDec *me, rui8_t b);
+
+/**
+ *  \brief
+ *  Retrieves the trace options of the target known by the decoder.
+ *
+ *  \param[in] me       pointer to decoder.
+ */
+const RKHTrcDecCfg *rkh_trcDec_getCfg(const RKHTrcDec *me);
+
+/**
+ *  \brief
+ *  Retrieves the number of records discarded because they are malformed, 
+ *  e.g. a bad checksum.
+ *
+ *  \param[in] me       pointer to decoder.
+ */
+rui32_t rkh_trcDec_getErrors(const RKHTrcDec *me);
+
+/**
+ *  \brief
+ *  Retrieves the number of records lost, according to the sequence 
+ *  numbers.
+ *
+ *  \param[in] me       pointer to decoder.
+ */
+rui32_t rkh_trcDec_getLost(const RKHTrcDec *me);
+
+/* -------------------- External C language linkage end -------------------- */
+#ifdef __cplusplus
+}
+#endif
+
+/* ------------------------------ Module end ------------------------------- */
+#endif
+
+/* ------------------------------ End of file ------------------------------ */
@@ -383,7 +383,9 @@ extern "C" {
 #define RKH_TE_SMA_DEFER        (RKH_TE_SMA_UNREG + 1)
 /** \copybrief RKH_TR_SMA_RCALL */
 #define RKH_TE_SMA_RCALL        (RKH_TE_SMA_DEFER + 1)
-#define RKH_SMA_END             RKH_TE_SMA_RCALL
+/** \copybrief RKH_TR_SMA_DLMISS */
+#define RKH_TE_SMA_DLMISS       (RKH_TE_SMA_RCALL + 1)
+#define RKH_SMA_END             RKH_TE_SMA_DLMISS
 
 /* --- State machine events (SM group) ------------------------------------- */
 /** \copybrief RKH_TR_SM_INIT */
@@ -480,7 +482,9 @@ extern "C" {
 #define RKH_TE_FWK_QUEUE        (RKH_TE_FWK_EPOOL + 1)
 /** \copybrief RKH_TR_FWK_ACTOR */
 #define RKH_TE_FWK_ACTOR        (RKH_TE_FWK_QUEUE + 1)
-#define RKH_FWK_END             RKH_TE_FWK_ACTOR
+/** Records dropped so far because the trace stream was full */
+#define RKH_TE_FWK_DROP         (RKH_TE_FWK_ACTOR + 1)
+#define RKH_FWK_END             RKH_TE_FWK_DROP
 
 /* --- User events (USR group) --------------------------------------------- */
 #define RKH_TE_USER             RKH_USR_START
@@ -547,6 +551,203 @@ extern "C" {
     #error  "by RKH_TOT_NUM_TRC_EVTS must be <= RKH_TRC_MAX_EVENTS"
 #endif
 
+/**
+ *  Number of per-thread trace rings. When it is greater than zero, each 
+ *  thread builds its records into its own ring without locking, and they 
+ *  are merged by timestamp into the trace stream when it is read. See 
+ *  RKHTrcRing.
+ */
+#ifndef RKH_CFG_TRC_MAX_RINGS
+#define RKH_CFG_TRC_MAX_RINGS           0u
+#endif
+
+/**
+ *  Size of each raw trace ring [in bytes]. It must be a power of two.
+ */
+#ifndef RKH_CFG_TRC_SIZEOF_RING
+#define RKH_CFG_TRC_SIZEOF_RING         1024u
+#endif
+
+/**
+ *  If it is enabled, trace records are stored raw into a ring, within the 
+ *  usual critical section, and they are framed when the trace stream is 
+ *  read, i.e. from rkh_trc_flush(). It is implied by the per-thread 
+ *  trace rings.
+ */
+#ifndef RKH_CFG_TRC_DEFERRED_EN
+#define RKH_CFG_TRC_DEFERRED_EN         RKH_DISABLED
+#endif
+
+/**
+ *  Number of raw trace rings, from which the trace stream is fed.
+ */
+#if RKH_CFG_TRC_MAX_RINGS > 0
+    #define RKH_TRC_NUM_RINGS           RKH_CFG_TRC_MAX_RINGS
+#elif RKH_CFG_TRC_DEFERRED_EN == RKH_ENABLED
+    #define RKH_TRC_NUM_RINGS           1u
+#else
+    #define RKH_TRC_NUM_RINGS           0u
+#endif
+
+/**
+ *  Size of the buffer where a trace record is built before being escaped, 
+ *  checksummed and copied into the trace stream at once [in bytes]. Zero 
+ *  means that every byte is encoded and written as soon as it arrives.
+ */
+#ifndef RKH_CFG_TRC_SIZEOF_RECORD
+#define RKH_CFG_TRC_SIZEOF_RECORD       0u
+#endif
+
+/**
+ *  If it is enabled, timestamps are sent as LEB128 deltas from the 
+ *  previous record and object and function addresses as LEB128 indexes of 
+ *  a symbol table, which are assigned on first use. See rkhtrc_decode.h.
+ */
+#ifndef RKH_CFG_TRC_COMPACT_EN
+#define RKH_CFG_TRC_COMPACT_EN          RKH_DISABLED
+#endif
+
+/**
+ *  Number of entries of the symbol table of the compact trace format. It 
+ *  must be a power of two.
+ */
+#ifndef RKH_CFG_TRC_SIZEOF_SYMTBL
+#define RKH_CFG_TRC_SIZEOF_SYMTBL       64u
+#endif
+
+/**
+ *  Number of records of the compact trace format between two key records, 
+ *  which carry the whole timestamp and restart the symbol table.
+ */
+#ifndef RKH_CFG_TRC_SYNC_PERIOD
+#define RKH_CFG_TRC_SYNC_PERIOD         64u
+#endif
+
+/**
+ *  If it is enabled, the trace stream and its read and write indexes are 
+ *  kept in a RKHTrcShared area, which may be given by 
+ *  rkh_trcStream_attach(), so that an external reader drains it directly. 
+ *  See rkhtrc_stream.h.
+ */
+#ifndef RKH_CFG_TRC_SHARED_EN
+#define RKH_CFG_TRC_SHARED_EN           RKH_DISABLED
+#endif
+
+/**
+ *  If it is enabled, records are kept in the trace stream but they are not 
+ *  read until a trigger freezes it, i.e. rkh_trc_freeze(), an event set by 
+ *  rkh_trc_setTrigger() or an assertion. See rkhtrc_stream.h.
+ */
+#ifndef RKH_CFG_TRC_FLIGHT_EN
+#define RKH_CFG_TRC_FLIGHT_EN           RKH_DISABLED
+#endif
+
+/**
+ *  If it is enabled, trace events and groups may be sampled, i.e. only one 
+ *  out of every N records, or up to N records per second, are emitted. 
+ *  See rkh_trc_sample_().
+ */
+#ifndef RKH_CFG_TRC_SAMPLING_EN
+#define RKH_CFG_TRC_SAMPLING_EN         RKH_DISABLED
+#endif
+
+/**
+ *  Maximum number of trace events and groups sampled at once.
+ */
+#ifndef RKH_CFG_TRC_MAX_SAMPLERS
+#define RKH_CFG_TRC_MAX_SAMPLERS        4u
+#endif
+
+/**
+ *  Frequency of the timestamp returned by rkh_trc_getts() [in Hz], which 
+ *  is used to limit the rate of sampled trace events.
+ */
+#ifndef RKH_CFG_TRC_TSTAMP_HZ
+#define RKH_CFG_TRC_TSTAMP_HZ           RKH_CFG_FWK_TICK_RATE_HZ
+#endif
+
+/**
+ *  If it is enabled, the runtime filters of trace events and groups are 
+ *  also kept as a flat bit table indexed by the trace event ID, so that 
+ *  the RKH_TRC_BEGIN() family tests a disabled event with a single load 
+ *  and branch. See rkh_trcEvtFil[].
+ */
+#ifndef RKH_CFG_TRC_RTFIL_FAST_EN
+#define RKH_CFG_TRC_RTFIL_FAST_EN       RKH_DISABLED
+#endif
+
+/**
+ *  \brief
+ *  Test the group and event filter condition.
+ *
+ *  \param[in] eid		trace event ID.
+ *
+ *	\return
+ *  '1' (RKH_TRUE) if the group and event is not filtered, otherwise '0' 
+ *  (RKH_FALSE).
+ *
+ *	\note
+ *  This macro is internal to RKH and the user application should not call
+ *  it.
+ */
+#if RKH_CFG_TRC_RTFIL_FAST_EN == RKH_ENABLED
+    #define RKH_TRC_EVT_ISOFF(eid) \
+            ((rkh_trcEvtFil[(eid) >> 3] & RKH_BIT((eid) & 7)) != 0)
+#else
+    #define RKH_TRC_EVT_ISOFF(eid) \
+            rkh_trc_isoff_(eid)
+#endif
+
+/**
+ *  \brief
+ *  Test the sampling condition of a trace event, once it passed the 
+ *  runtime filters.
+ *
+ *  \param[in] eid		trace event ID.
+ *
+ *	\return
+ *  '1' (RKH_TRUE) if the event is not sampled or it is the turn of this 
+ *  record, otherwise '0' (RKH_FALSE).
+ *
+ *	\note
+ *  This macro is internal to RKH and the user application should not call
+ *  it.
+ */
+#if RKH_CFG_TRC_SAMPLING_EN == RKH_ENABLED
+    #define RKH_TRC_IS_SAMPLED(eid) \
+            && rkh_trc_isSampled_(eid)
+#else
+    #define RKH_TRC_IS_SAMPLED(eid)
+#endif
+
+/**
+ *  \brief
+ *  Idem RKH_TRC_IS_SAMPLED() macro but within a critical section already 
+ *  entered by the caller.
+ *
+ *  \param[in] eid		trace event ID.
+ */
+#if RKH_CFG_TRC_SAMPLING_EN == RKH_ENABLED
+    #define RKH_TRC_IS_SAMPLED_NOCRIT(eid) \
+            && rkh_trc_isSampledNoCrit_(eid)
+#else
+    #define RKH_TRC_IS_SAMPLED_NOCRIT(eid)
+#endif
+
+/**
+ *  Critical section used by the trace record macros, which is not needed 
+ *  when the records are built into per-thread rings.
+ */
+#if RKH_CFG_TRC_MAX_RINGS > 0
+    #define RKH_TRC_SR_ALLOC_()
+    #define RKH_TRC_ENTER_CRITICAL_()
+    #define RKH_TRC_EXIT_CRITICAL_()
+#else
+    #define RKH_TRC_SR_ALLOC_()         RKH_SR_ALLOC()
+    #define RKH_TRC_ENTER_CRITICAL_()   RKH_ENTER_CRITICAL_()
+    #define RKH_TRC_EXIT_CRITICAL_()    RKH_EXIT_CRITICAL_()
+#endif
+
 #if RKH_CFG_TRC_RTFIL_EN == RKH_ENABLED
         /**
          *	Each trace event always begins with the macro RKH_TRC_BEGIN()
@@ -569,31 +770,35 @@ extern "C" {
          *  This macro always invokes the rkh_trc_begin() function.
          */
         #define RKH_TRC_BEGIN(eid_, prio_, sig_)  \
-            if (rkh_trc_isoff_(eid_) \
+            if (RKH_TRC_EVT_ISOFF(eid_) \
                 RKH_TRC_AO_ISOFF(prio_) \
-                RKH_TRC_SIG_ISOFF(sig_)) \
+                RKH_TRC_SIG_ISOFF(sig_) \
+                RKH_TRC_IS_SAMPLED(eid_)) \
             { \
-                RKH_ENTER_CRITICAL_(); \
+                RKH_TRC_ENTER_CRITICAL_(); \
                 rkh_trc_begin(eid_);
 
         #define RKH_TRC_BEGIN_WOAO(eid_, sig_) \
-            if (rkh_trc_isoff_(eid_) \
-                RKH_TRC_SIG_ISOFF(sig_)) \
+            if (RKH_TRC_EVT_ISOFF(eid_) \
+                RKH_TRC_SIG_ISOFF(sig_) \
+                RKH_TRC_IS_SAMPLED(eid_)) \
             { \
-                RKH_ENTER_CRITICAL_(); \
+                RKH_TRC_ENTER_CRITICAL_(); \
                 rkh_trc_begin(eid_);
 
         #define RKH_TRC_BEGIN_WOSIG(eid_, prio_) \
-            if (rkh_trc_isoff_(eid_) \
-                RKH_TRC_AO_ISOFF(prio_)) \
+            if (RKH_TRC_EVT_ISOFF(eid_) \
+                RKH_TRC_AO_ISOFF(prio_) \
+                RKH_TRC_IS_SAMPLED(eid_)) \
             { \
-                RKH_ENTER_CRITICAL_(); \
+                RKH_TRC_ENTER_CRITICAL_(); \
                 rkh_trc_begin(eid_);
 
         #define RKH_TRC_BEGIN_WOAOSIG(eid_) \
-            if (rkh_trc_isoff_(eid_)) \
+            if (RKH_TRC_EVT_ISOFF(eid_) \
+                RKH_TRC_IS_SAMPLED(eid_)) \
             { \
-                RKH_ENTER_CRITICAL_(); \
+                RKH_TRC_ENTER_CRITICAL_(); \
                 rkh_trc_begin(eid_);
 
         /**
@@ -608,7 +813,7 @@ extern "C" {
          */
         #define RKH_TRC_END() \
             rkh_trc_end(); \
-            RKH_EXIT_CRITICAL_(); \
+            RKH_TRC_EXIT_CRITICAL_(); \
             }
 
         /**
@@ -620,9 +825,10 @@ extern "C" {
          *	\param[in] sig_		signal.
          */
         #define RKH_TRC_BEGIN_NOCRIT(eid_, prio_, sig_) \
-            if (rkh_trc_isoff_(eid_) \
+            if (RKH_TRC_EVT_ISOFF(eid_) \
                 RKH_TRC_AO_ISOFF(prio_) \
-                RKH_TRC_SIG_ISOFF(sig_)) \
+                RKH_TRC_SIG_ISOFF(sig_) \
+                RKH_TRC_IS_SAMPLED_NOCRIT(eid_)) \
             { \
                 rkh_trc_begin(eid_);
 
@@ -635,8 +841,9 @@ extern "C" {
          *	\param[in] sig_		signal.
          */
         #define RKH_TRC_BEGIN_WOAO_NOCRIT(eid_, sig_) \
-            if (rkh_trc_isoff_(eid_) \
-                RKH_TRC_SIG_ISOFF(sig_)) \
+            if (RKH_TRC_EVT_ISOFF(eid_) \
+                RKH_TRC_SIG_ISOFF(sig_) \
+                RKH_TRC_IS_SAMPLED_NOCRIT(eid_)) \
             { \
                 rkh_trc_begin(eid_);
 
@@ -649,8 +856,9 @@ extern "C" {
          *	\param[in] prio_	priority of active object.
          */
         #define RKH_TRC_BEGIN_WOSIG_NOCRIT(eid_, prio_) \
-            if (rkh_trc_isoff_(eid_) \
-                RKH_TRC_AO_ISOFF(prio_)) \
+            if (RKH_TRC_EVT_ISOFF(eid_) \
+                RKH_TRC_AO_ISOFF(prio_) \
+                RKH_TRC_IS_SAMPLED_NOCRIT(eid_)) \
             { \
                 rkh_trc_begin(eid_);
 
@@ -662,7 +870,8 @@ extern "C" {
          *	                    See RKH_TE_<group>_<event> definitions.
          */
         #define RKH_TRC_BEGIN_WOAOSIG_NOCRIT(eid_) \
-            if (rkh_trc_isoff_(eid_)) \
+            if (RKH_TRC_EVT_ISOFF(eid_) \
+                RKH_TRC_IS_SAMPLED_NOCRIT(eid_)) \
             { \
                 rkh_trc_begin(eid_);
 
@@ -674,24 +883,24 @@ extern "C" {
             }
 #else
         #define RKH_TRC_BEGIN(eid_, prio_, sig_) \
-            RKH_ENTER_CRITICAL_(); \
+            RKH_TRC_ENTER_CRITICAL_(); \
             rkh_trc_begin(eid_);
 
         #define RKH_TRC_BEGIN_WOAO(eid_, sig_) \
-            RKH_ENTER_CRITICAL_(); \
+            RKH_TRC_ENTER_CRITICAL_(); \
             rkh_trc_begin(eid_);
 
         #define RKH_TRC_BEGIN_WOSIG(eid_, prio_) \
-            RKH_ENTER_CRITICAL_(); \
+            RKH_TRC_ENTER_CRITICAL_(); \
             rkh_trc_begin(eid_);
 
         #define RKH_TRC_BEGIN_WOAOSIG(eid_) \
-            RKH_ENTER_CRITICAL_(); \
+            RKH_TRC_ENTER_CRITICAL_(); \
             rkh_trc_begin(eid_);
 
         #define RKH_TRC_END() \
             rkh_trc_end();  \
-            RKH_EXIT_CRITICAL_();
+            RKH_TRC_EXIT_CRITICAL_();
 
         #define RKH_TRC_BEGIN_NOCRIT(eid_, prio_, sig_) \
             rkh_trc_begin(eid_);
@@ -715,7 +924,7 @@ extern "C" {
  */
 #define RKH_TRC_BEGIN_WOFIL(eid_) \
         RKH_SR_ALLOC(); \
-        RKH_ENTER_CRITICAL_(); \
+        RKH_TRC_ENTER_CRITICAL_(); \
         rkh_trc_begin(eid_);
 
 /**
@@ -724,7 +933,7 @@ extern "C" {
  */
 #define RKH_TRC_END_WOFIL() \
         rkh_trc_end(); \
-        RKH_EXIT_CRITICAL_();
+        RKH_TRC_EXIT_CRITICAL_();
 
 /**
  *  Idem RKH_TRC_BEGIN_WOFIL() macro but without entering critical section.
@@ -797,10 +1006,11 @@ extern "C" {
          *  Idem RKH_TRC_BEGIN() macro but use it for user trace events.
          */
         #define RKH_TRC_USR_BEGIN(eid_) \
-            RKH_SR_ALLOC(); \
-            if (rkh_trc_isoff_(eid_)) \
+            RKH_TRC_SR_ALLOC_(); \
+            if (RKH_TRC_EVT_ISOFF(eid_) \
+                RKH_TRC_IS_SAMPLED(eid_)) \
             { \
-                RKH_ENTER_CRITICAL_(); \
+                RKH_TRC_ENTER_CRITICAL_(); \
                 rkh_trc_begin(eid_);
 
         /**
@@ -808,7 +1018,7 @@ extern "C" {
          */
         #define RKH_TRC_USR_END() \
             rkh_trc_end(); \
-            RKH_EXIT_CRITICAL_(); \
+            RKH_TRC_EXIT_CRITICAL_(); \
             }
 
         /**
@@ -816,7 +1026,8 @@ extern "C" {
          *  section.
          */
         #define RKH_TRC_USR_BEGIN_NOCRIT(eid_) \
-            if (rkh_trc_isoff_(eid_)) \
+            if (RKH_TRC_EVT_ISOFF(eid_) \
+                RKH_TRC_IS_SAMPLED_NOCRIT(eid_)) \
             { \
                 rkh_trc_begin(eid_);
 
@@ -968,7 +1179,10 @@ extern "C" {
  *  \brief
  *  Insert a object address as trace record argument.
  */
-#if RKH_CFGPORT_TRC_SIZEOF_PTR == 16
+#if RKH_CFG_TRC_COMPACT_EN == RKH_ENABLED
+        #define RKH_TRC_SYM(sym)  \
+            rkh_trc_sym((rui32_t)sym)
+#elif RKH_CFGPORT_TRC_SIZEOF_PTR == 16
         #define RKH_TRC_SYM(sym)  \
             RKH_TRC_UI16((rui16_t)sym)
 #elif RKH_CFGPORT_TRC_SIZEOF_PTR == 32
@@ -994,7 +1208,10 @@ extern "C" {
  *  \brief
  *  Insert a function address as trace record argument.
  */
-#if RKH_CFGPORT_TRC_SIZEOF_FUN_PTR == 16
+#if RKH_CFG_TRC_COMPACT_EN == RKH_ENABLED
+        #define RKH_TRC_FUN(sym)  \
+            rkh_trc_fun((rui32_t)sym)
+#elif RKH_CFGPORT_TRC_SIZEOF_FUN_PTR == 16
         #define RKH_TRC_FUN(sym)  \
             RKH_TRC_UI16((rui16_t)sym)
 #elif RKH_CFGPORT_TRC_SIZEOF_FUN_PTR == 32
@@ -1244,8 +1461,10 @@ enum RKH_TRC_FMT
 
 #if RKH_CFG_TRC_SIZEOF_STREAM < 255u
     typedef rui8_t TRCQTY_T;
-#else
+#elif RKH_CFG_TRC_SIZEOF_STREAM < 65535u
     typedef rui16_t TRCQTY_T;
+#else
+    typedef rui32_t TRCQTY_T;
 #endif
 
 /**
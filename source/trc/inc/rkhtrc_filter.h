@@ -219,6 +219,73 @@ extern "C" {
         #define RKH_FILTER_OFF_SIGNAL(sig)      (void)0
         #define RKH_FILTER_OFF_ALL_SIGNALS()    (void)0
     #endif
+
+    #if RKH_CFG_TRC_SAMPLING_EN == RKH_ENABLED
+    /**
+     *  \brief
+     *  Emit only one out of every n records of a trace event, which must 
+     *  be also enabled by the runtime filters.
+     *
+     *  \ingroup apiTrc 
+     */
+        #define RKH_SAMPLE_EVENT(evt, n) \
+            rkh_trc_sample_((evt), RKH_FALSE, RKH_TRC_SMPL_ONE_IN_N, (n))
+
+    /**
+     *  \brief
+     *  Emit only one out of every n records of the trace events from a 
+     *  specific group, which are counted all together.
+     *
+     *  \ingroup apiTrc 
+     */
+        #define RKH_SAMPLE_GROUP(grp, n) \
+            rkh_trc_sample_((grp), RKH_TRUE, RKH_TRC_SMPL_ONE_IN_N, (n))
+
+    /**
+     *  \brief
+     *  Emit up to n records per second of a trace event.
+     *
+     *  \ingroup apiTrc 
+     */
+        #define RKH_RATE_LIMIT_EVENT(evt, n) \
+            rkh_trc_sample_((evt), RKH_FALSE, RKH_TRC_SMPL_RATE, (n))
+
+    /**
+     *  \brief
+     *  Emit up to n records per second of the trace events from a specific 
+     *  group, which are counted all together.
+     *
+     *  \ingroup apiTrc 
+     */
+        #define RKH_RATE_LIMIT_GROUP(grp, n) \
+            rkh_trc_sample_((grp), RKH_TRUE, RKH_TRC_SMPL_RATE, (n))
+
+    /**
+     *  \brief
+     *  Emit every record of a trace event, removing its sampling.
+     *
+     *  \ingroup apiTrc 
+     */
+        #define RKH_SAMPLE_OFF_EVENT(evt) \
+            rkh_trc_sample_((evt), RKH_FALSE, RKH_TRC_SMPL_NONE, 0)
+
+    /**
+     *  \brief
+     *  Emit every record of the trace events from a specific group, 
+     *  removing the sampling of the group.
+     *
+     *  \ingroup apiTrc 
+     */
+        #define RKH_SAMPLE_OFF_GROUP(grp) \
+            rkh_trc_sample_((grp), RKH_TRUE, RKH_TRC_SMPL_NONE, 0)
+    #else
+        #define RKH_SAMPLE_EVENT(evt, n)        (void)0
+        #define RKH_SAMPLE_GROUP(grp, n)        (void)0
+        #define RKH_RATE_LIMIT_EVENT(evt, n)    (void)0
+        #define RKH_RATE_LIMIT_GROUP(grp, n)    (void)0
+        #define RKH_SAMPLE_OFF_EVENT(evt)       (void)0
+        #define RKH_SAMPLE_OFF_GROUP(grp)       (void)0
+    #endif
 #else
     #define RKH_FILTER_ON_GROUP(grp)                (void)0
     #define RKH_FILTER_OFF_GROUP(grp)               (void)0
@@ -234,6 +301,12 @@ extern "C" {
     #define RKH_FILTER_ON_ALL_SIGNALS()             (void)0
     #define RKH_FILTER_OFF_SIGNAL(sig)              (void)0
     #define RKH_FILTER_OFF_ALL_SIGNALS()            (void)0
+    #define RKH_SAMPLE_EVENT(evt, n)                (void)0
+    #define RKH_SAMPLE_GROUP(grp, n)                (void)0
+    #define RKH_RATE_LIMIT_EVENT(evt, n)            (void)0
+    #define RKH_RATE_LIMIT_GROUP(grp, n)            (void)0
+    #define RKH_SAMPLE_OFF_EVENT(evt)               (void)0
+    #define RKH_SAMPLE_OFF_GROUP(grp)               (void)0
 #endif
 
 /* -------------------------------- Constants ------------------------------ */
@@ -279,6 +352,17 @@ typedef enum
     FILTER_ON, FILTER_OFF
 } RKH_TRC_FOPT;
 
+/**
+ *  \brief
+ *  Sampling modes of trace events, see rkh_trc_sample_().
+ */
+typedef enum
+{
+    RKH_TRC_SMPL_NONE,      /**< every record is emitted */
+    RKH_TRC_SMPL_ONE_IN_N,  /**< one out of every N records is emitted */
+    RKH_TRC_SMPL_RATE       /**< up to N records per second are emitted */
+} RKH_TRC_SOPT;
+
 typedef enum RKHFilter
 {
     RKHFilterTrcEvt, RKHFilterSignal, RKHFilterSma,
@@ -295,6 +379,17 @@ typedef struct RKH_FilterTbl
 } RKH_FilterTbl;
 
 /* -------------------------- External variables --------------------------- */
+#if RKH_CFG_TRC_RTFIL_FAST_EN == RKH_ENABLED
+/**
+ *  \brief
+ *  Combined filter table of trace events and groups, indexed by the trace 
+ *  event ID. The bit of an event is set when both the event and its group 
+ *  are emitted. It is kept in sync by rkh_trc_filter_event_() and 
+ *  rkh_trc_filter_group_(), and read by RKH_TRC_EVT_ISOFF().
+ */
+extern rui8_t rkh_trcEvtFil[RKH_TRC_MAX_EVENTS / 8];
+#endif
+
 /* -------------------------- Function prototypes -------------------------- */
 /**
  *  \brief
@@ -434,6 +529,88 @@ void rkh_trc_symFil(RKHFilter fd, RKH_TRC_FSLOT slot, rui8_t mode);
  */
 rbool_t rkh_trc_symFil_isoff(RKHFilter fd, RKH_TRC_FSLOT slot);
 
+/**
+ *  \brief
+ *  Sample a trace event or all the trace events from a group.
+ *
+ *  High-frequency trace events, such as RKH_TE_SM_DCH, RKH_TE_QUE_FIFO or 
+ *  RKH_TE_MP_GET, may be sampled instead of being fully emitted or 
+ *  suppressed, in order to bound the trace overhead while keeping a 
+ *  representative distribution of them. The sampling is applied once a 
+ *  record passed the runtime filters and before it is built. A sampler of 
+ *  a specific event takes precedence over the one of its group, and the 
+ *  events of a sampled group share a single counter.
+ *
+ *  \param[in] id		trace event or trace group.
+ *  \param[in] isGroup	RKH_TRUE if \a id is a trace group.
+ *  \param[in] mode		sampling mode, the available options are 
+ *                      RKH_TRC_SMPL_NONE, RKH_TRC_SMPL_ONE_IN_N and 
+ *                      RKH_TRC_SMPL_RATE.
+ *  \param[in] value	N, i.e. the sampling ratio or the maximum number of 
+ *                      records per second. The rate is measured by means of 
+ *                      rkh_trc_getts() and RKH_CFG_TRC_TSTAMP_HZ, thus a 
+ *                      second must fit in a RKH_TS_T.
+ *
+ *  \usage
+ *  \code
+ *  void
+ *  some_function(...)
+ *  {
+ *      RKH_SAMPLE_EVENT(RKH_TE_SM_DCH, 100);
+ *      RKH_RATE_LIMIT_GROUP(RKH_TG_MP, 50);
+ *      ...
+ *  }
+ *  \endcode
+ *
+ *	\note
+ *  This function is internal to RKH and the user application should not call
+ *  it. Please use RKH_SAMPLE_EVENT(), RKH_SAMPLE_GROUP(), 
+ *  RKH_RATE_LIMIT_EVENT(), RKH_RATE_LIMIT_GROUP(), RKH_SAMPLE_OFF_EVENT() 
+ *  or RKH_SAMPLE_OFF_GROUP() macros instead. Up to 
+ *  RKH_CFG_TRC_MAX_SAMPLERS events and groups are sampled at once.
+ */
+void rkh_trc_sample_(RKH_TE_ID_T id, rbool_t isGroup, rui8_t mode, 
+                     rui16_t value);
+
+/**
+ *  \brief
+ *  Test the sampling condition of a trace event.
+ *
+ *  \param[in] e	trace event ID. The available events are enumerated in
+ *                  RKH_TE_<group>_<event> definitions.
+ *
+ *	\return
+ *  '1' (RKH_TRUE) if the event is not sampled or its record has to be 
+ *  emitted, otherwise '0' (RKH_FALSE).
+ *
+ *	\note
+ *  This function is internal to RKH and the user application should not call
+ *  it. The sampling counters are updated within a critical section, thus 
+ *  it must not be called from a critical section, use 
+ *  rkh_trc_isSampledNoCrit_() instead. When the records are built into 
+ *  per-thread rings (RKH_CFG_TRC_MAX_RINGS > 0), the counters are updated 
+ *  by atomic operations instead, without any critical section.
+ */
+rbool_t rkh_trc_isSampled_(RKH_TE_ID_T e);
+
+/**
+ *  \brief
+ *  Idem rkh_trc_isSampled_() but within a critical section already entered 
+ *  by the caller.
+ *
+ *  \param[in] e	trace event ID. The available events are enumerated in
+ *                  RKH_TE_<group>_<event> definitions.
+ *
+ *	\return
+ *  '1' (RKH_TRUE) if the event is not sampled or its record has to be 
+ *  emitted, otherwise '0' (RKH_FALSE).
+ *
+ *	\note
+ *  This function is internal to RKH and the user application should not call
+ *  it.
+ */
+rbool_t rkh_trc_isSampledNoCrit_(RKH_TE_ID_T e);
+
 /**
  *  \brief
  *  Get a memory reference to every trace filter table.
@@ -495,6 +495,24 @@ extern "C" {
                 RKH_TRC_SIG((evt_)->e); \
             RKH_TRC_END_NOCRIT()
 
+        /**
+         *  \brief
+         *  An active object took an event after its deadline had expired.
+         *
+         *  \description    Deadline miss
+         *  \trcGroup       RKH_TG_SMA
+         *  \trcEvent       RKH_TE_SMA_DLMISS
+         *
+         *  \param[in] actObj_      Active object
+         *  \param[in] lateness_    Number of ticks elapsed since the deadline
+         */
+        #define RKH_TR_SMA_DLMISS(actObj_, lateness_) \
+            RKH_TRC_BEGIN_WOSIG_NOCRIT(RKH_TE_SMA_DLMISS, \
+                                       RKH_SMA_ACCESS_CONST(actObj_, prio)) \
+                RKH_TRC_SYM(actObj_); \
+                RKH_TRC_NTICK(lateness_); \
+            RKH_TRC_END_NOCRIT()
+
         /** @} doxygen end group definition */
         /** @} doxygen end group definition */
     #else
@@ -519,6 +537,8 @@ extern "C" {
             (void)0
         #define RKH_TR_SMA_RCALL(actObj_, evt_) \
             (void)0
+        #define RKH_TR_SMA_DLMISS(actObj_, lateness_) \
+            (void)0
     #endif
 
     /* --- State machine (SM) ---------------------------------------------- */
@@ -1511,7 +1531,8 @@ extern "C" {
          *  [ 3,15: 1] - RKH_CFG_TRC_NSEQ_EN \n
          *  [ 4,16: 1] - RKH_CFG_TRC_TSTAMP_EN \n
          *  [ 4,17: 1] - RKH_CFG_TRC_CHK_EN \n
-         *  [ 4,18:14] - 0 (Reserved) \n
+         *  [ 4,18: 1] - RKH_CFG_TRC_COMPACT_EN \n
+         *  [ 4,19:13] - 0 (Reserved) \n
          *  [ 6, 0: 4] - RKH_CFG_FWK_SIZEOF_EVT \n
          *  [ 6, 4: 4] - RKH_CFGPORT_TRC_SIZEOF_TSTAMP \n
          *  [ 7, 0: 4] - RKH_CFGPORT_TRC_SIZEOF_PTR \n
@@ -1546,7 +1567,8 @@ extern "C" {
                         ((rui32_t)RKH_CFG_TRC_RTFIL_SIGNAL_EN << 14) | \
                         ((rui32_t)RKH_CFG_TRC_NSEQ_EN << 15) | \
                         ((rui32_t)RKH_CFG_TRC_TSTAMP_EN << 16) | \
-                        ((rui32_t)RKH_CFG_TRC_CHK_EN << 17))); \
+                        ((rui32_t)RKH_CFG_TRC_CHK_EN << 17) | \
+                        ((rui32_t)RKH_CFG_TRC_COMPACT_EN << 18))); \
                 RKH_TRC_UI8( \
                     (rui8_t)((RKH_CFG_FWK_SIZEOF_EVT / 8 << 4) | \
                              RKH_CFGPORT_TRC_SIZEOF_TSTAMP / 8)); \
@@ -1899,6 +1921,7 @@ extern "C" {
     #define RKH_TR_SMA_UNREG(ao, actObjPrio_)         (void)0
     #define RKH_TR_SMA_DEFER(queue_, evt_)            (void)0
     #define RKH_TR_SMA_RCALL(actObj_, evt_)           (void)0
+    #define RKH_TR_SMA_DLMISS(actObj_, lateness_)     (void)0
 
     /* --- State machine (SM) ------------------------------------------ */
     #define RKH_TR_SM_INIT(ao, ist)                   (void)0
@@ -1953,6 +1976,18 @@ extern "C" {
     #define RKH_TR_FWK_ACTOR(actObj_, nm_)            (void)0
 #endif
 
+/**
+ *  \brief
+ *  Evaluates to RKH_ENABLED if whole records are reserved in the trace 
+ *  stream, so that a record that does not fit is dropped and accounted 
+ *  rather than overwriting the oldest ones.
+ */
+#if (RKH_CFG_TRC_SIZEOF_RECORD > 0) && (RKH_TRC_RESERVE_EN == RKH_ENABLED)
+    #define RKH_TRC_DROP_EN         RKH_ENABLED
+#else
+    #define RKH_TRC_DROP_EN         RKH_DISABLED
+#endif
+
 /* -------------------------------- Constants ------------------------------ */
 /* ------------------------------- Data types ------------------------------ */
 /* -------------------------- External variables --------------------------- */
@@ -2049,6 +2084,29 @@ void rkh_trc_u32(rui32_t d);
  */
 void rkh_trc_str(const char *s);
 
+#if RKH_CFG_TRC_COMPACT_EN == RKH_ENABLED
+/**
+ *  \brief
+ *  Store an object address into the current trace event buffer, as an 
+ *  index of the symbol table of the compact trace format.
+ *
+ *  The first time an address is used after a key record, its index is 
+ *  followed by the whole address, i.e. RKH_CFGPORT_TRC_SIZEOF_PTR bits. 
+ *
+ *  \param[in] sym      object address.
+ */
+void rkh_trc_sym(rui32_t sym);
+
+/**
+ *  \brief
+ *  Idem rkh_trc_sym() but for function addresses, whose size is 
+ *  RKH_CFGPORT_TRC_SIZEOF_FUN_PTR bits.
+ *
+ *  \param[in] fun      function address.
+ */
+void rkh_trc_fun(rui32_t fun);
+#endif
+
 /**
  *  \brief
  *  Output object symbol record.
@@ -2102,6 +2160,63 @@ void rkh_trc_ao(void *ao);
  */
 void rkh_trc_state(void *ao, rui8_t *state);
 
+#if RKH_TRC_NUM_RINGS > 0
+/**
+ *  \brief
+ *  Moves the raw records of the trace rings into the trace stream, 
+ *  interleaving them by timestamp and framing them as usual.
+ *
+ *  \param[in] room    available space in the trace stream [in bytes]. 
+ *                      Records are moved while their worst-case framed 
+ *                      size fits into it.
+ *
+ *  \note
+ *  This function is internal to RKH and the user application should
+ *  not call it. It is invoked by the trace stream when it is read, so it 
+ *  runs within the critical section of the reader.
+ */
+void rkh_trc_merge(TRCQTY_T room);
+
+/**
+ *  \brief
+ *  Retrieves the number of trace records discarded because their ring was 
+ *  full, their thread could not get a ring or they would never fit into 
+ *  the trace stream.
+ */
+rui32_t rkh_trc_getRingDropped(void);
+#endif
+
+#if RKH_TRC_DROP_EN == RKH_ENABLED
+/**
+ *  \brief
+ *  Retrieves the number of trace records dropped because the trace stream 
+ *  was full.
+ *
+ *  \note
+ *  The count is also emitted as a RKH_TE_FWK_DROP record, ahead of the 
+ *  first record that fits into the trace stream after a drop.
+ */
+rui32_t rkh_trc_getDropped(void);
+#endif
+
+#if RKH_CFG_TRC_FLIGHT_EN == RKH_ENABLED
+/**
+ *  \brief
+ *  Sets the event that freezes the flight recorder, right after its 
+ *  record, which must not be filtered out. Only one event is watched at a 
+ *  time.
+ *
+ *  \param[in] eid     trace event ID.
+ */
+void rkh_trc_setTrigger(RKH_TE_ID_T eid);
+
+/**
+ *  \brief
+ *  Stops watching the trigger event set by rkh_trc_setTrigger().
+ */
+void rkh_trc_clearTrigger(void);
+#endif
+
 /**
  *  \brief
  *  Store a 8-bit data into the current trace event buffer with format
@@ -0,0 +1,210 @@
+/*
+ *  --------------------------------------------------------------------------
+ *
+ *                                Framework RKH
+ *                                -------------
+ *
+ *            State-machine framework for reactive embedded systems
+ *
+ *                      Copyright (C) 2010 Leandro Francucci.
+ *          All rights reserved. Protected by international copyright laws.
+ *
+ *
+ *  RKH is free software: you can redistribute it and/or modify it under the
+ *  terms of the GNU General Public License as published by the Free Software
+ *  Foundation, either version 3 of the License, or (at your option) any
+ *  later version.
+ *
+ *  RKH is distributed in the hope that it will be useful, but WITHOUT ANY
+ *  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with RKH, see copying.txt file.
+ *
+ *  Contact information:
+ *  RKH site: http://vortexmakes.com/que-es/
+ *  RKH GitHub: https://github.com/vortexmakes/RKH
+ *  RKH Sourceforge: https://sourceforge.net/projects/rkh-reactivesys/
+ *  e-mail: lf@vortexmakes.com
+ *  ---------------------------------------------------------------------------
+ */
+
+
+/**
+ *  \file       rkhtrc_ring.h
+ *  \brief      Specifies the single-writer trace ring, used to build trace 
+ *              records without locking.
+ *  \ingroup    apiTrc
+ */
+
+/* -------------------------- Development history -------------------------- */
+/*
+ *  2026.10.19  LeFr  v3.4.00  Initial version
+ */
+
+/* -------------------------------- Authors -------------------------------- */
+/*
+ *  LeFr  Leandro Francucci  lf@vortexmakes.com
+ */
+
+/* --------------------------------- Notes --------------------------------- */
+/*
+ *  A trace ring holds complete records, each one preceded by its length. 
+ *  Only one thread (the owner) writes into it and only one at a time (the 
+ *  merger) reads from it, so that the indexes are the only shared data and 
+ *  neither side needs a critical section. A record becomes visible to the 
+ *  reader when rkh_trcRing_end() is called. If it does not fit, the whole 
+ *  record is discarded and counted.
+ */
+
+/* --------------------------------- Module -------------------------------- */
+#ifndef __RKHTRC_RING_H__
+#define __RKHTRC_RING_H__
+
+/* ----------------------------- Include files ----------------------------- */
+#include "rkhtype.h"
+
+/* ---------------------- External C language linkage ---------------------- */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* --------------------------------- Macros -------------------------------- */
+/* -------------------------------- Constants ------------------------------ */
+/* ------------------------------- Data types ------------------------------ */
+/**
+ *  \brief
+ *  Trace ring. Its members must not be accessed directly.
+ */
+typedef struct RKHTrcRing RKHTrcRing;
+struct RKHTrcRing
+{
+    rui8_t *sto;            /**< storage area */
+    rui32_t mask;           /**< size of storage area minus one */
+    rui32_t head;           /**< end of published records, by the writer */
+    rui32_t tail;           /**< start of pending records, by the reader */
+    rui32_t wr;             /**< write index of the record in progress */
+    rui32_t limit;          /**< writer's cached bound of free space */
+    rbool_t isFull;         /**< the record in progress does not fit */
+    rui32_t nDropped;       /**< number of discarded records */
+};
+
+/* -------------------------- External variables --------------------------- */
+/* -------------------------- Function prototypes -------------------------- */
+/**
+ *  \brief
+ *  Initializes a trace ring.
+ *
+ *  \param[in] me       pointer to trace ring.
+ *  \param[in] sto      storage area.
+ *  \param[in] size     size of storage area [in bytes]. It must be a power 
+ *                      of two, up to 64KB.
+ */
+void rkh_trcRing_init(RKHTrcRing *me, rui8_t *sto, rui32_t size);
+
+/**
+ *  \brief
+ *  Starts a new record. Only the owner may call it.
+ *
+ *  \param[in] me       pointer to trace ring.
+ */
+void rkh_trcRing_begin(RKHTrcRing *me);
+
+/**
+ *  \brief
+ *  Appends a byte to the record in progress. Only the owner may call it.
+ *
+ *  \param[in] me       pointer to trace ring.
+ *  \param[in] b        data byte.
+ */
+void rkh_trcRing_put(RKHTrcRing *me, rui8_t b);
+
+/**
+ *  \brief
+ *  Appends a block of bytes to the record in progress, checking the free 
+ *  space once. Only the owner may call it.
+ *
+ *  \param[in] me       pointer to trace ring.
+ *  \param[in] blk      data bytes.
+ *  \param[in] size     number of bytes.
+ */
+void rkh_trcRing_putBlock(RKHTrcRing *me, const rui8_t *blk, rui32_t size);
+
+/**
+ *  \brief
+ *  Publishes the record in progress, or discards it if it did not fit. 
+ *  Only the owner may call it.
+ *
+ *  \param[in] me       pointer to trace ring.
+ *
+ *  \return
+ *  True if the record was published, otherwise false.
+ */
+rbool_t rkh_trcRing_end(RKHTrcRing *me);
+
+/**
+ *  \brief
+ *  Publishes a whole record at once, or discards it if it does not fit. 
+ *  Only the owner may call it, out of rkh_trcRing_begin() and 
+ *  rkh_trcRing_end().
+ *
+ *  \param[in] me       pointer to trace ring.
+ *  \param[in] rec      data bytes of record.
+ *  \param[in] size     number of bytes.
+ *
+ *  \return
+ *  True if the record was published, otherwise false.
+ */
+rbool_t rkh_trcRing_write(RKHTrcRing *me, const rui8_t *rec, rui32_t size);
+
+/**
+ *  \brief
+ *  Retrieves the length of the oldest published record. Only the reader 
+ *  may call it.
+ *
+ *  \param[in] me       pointer to trace ring.
+ *  \param[out] len     length of the record [in bytes].
+ *
+ *  \return
+ *  True if there is a published record, otherwise false.
+ */
+rbool_t rkh_trcRing_peek(RKHTrcRing *me, rui32_t *len);
+
+/**
+ *  \brief
+ *  Retrieves a byte of the oldest published record, which must exist.
+ *  Only the reader may call it.
+ *
+ *  \param[in] me       pointer to trace ring.
+ *  \param[in] offset   position within the record.
+ */
+rui8_t rkh_trcRing_getByte(const RKHTrcRing *me, rui32_t offset);
+
+/**
+ *  \brief
+ *  Releases the oldest published record, which must exist. Only the 
+ *  reader may call it.
+ *
+ *  \param[in] me       pointer to trace ring.
+ */
+void rkh_trcRing_pop(RKHTrcRing *me);
+
+/**
+ *  \brief
+ *  Retrieves the number of records discarded because they did not fit.
+ *
+ *  \param[in] me       pointer to trace ring.
+ */
+rui32_t rkh_trcRing_getDropped(const RKHTrcRing *me);
+
+/* -------------------- External C language linkage end -------------------- */
+#ifdef __cplusplus
+}
+#endif
+
+/* ------------------------------ Module end ------------------------------- */
+#endif
+
+/* ------------------------------ End of file ------------------------------ */
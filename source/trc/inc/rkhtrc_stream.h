@@ -48,6 +48,34 @@
  */
 
 /* --------------------------------- Notes --------------------------------- */
+/*
+ *  When RKH_CFG_TRC_SHARED_EN is enabled, the stream is a RKHTrcShared 
+ *  area: a header followed by the stream bytes. Its head and tail are 
+ *  free-running byte counters, the former published by the writer after 
+ *  the bytes are stored and the latter by the reader after they are 
+ *  consumed. The writer never waits for the reader, it overwrites the 
+ *  oldest bytes instead, thus a reader that falls behind skips to 
+ *  head - size. Before storing any byte, the writer advances next, so that 
+ *  a reader that accesses the bytes in place checks afterwards that next 
+ *  did not move over them, as a sequence lock does. Either an external 
+ *  reader or the rkh_trc_get*() functions should drain the stream, not 
+ *  both.
+ *
+ *  When RKH_CFG_TRC_FLIGHT_EN is enabled, the stream is a flight recorder. 
+ *  Records go on overwriting the oldest ones and the rkh_trc_get*() 
+ *  functions retrieve nothing, so that rkh_trc_flush() costs a call. Once 
+ *  rkh_trc_freeze() is called, new bytes are discarded and the stream is 
+ *  read from its oldest flag on, i.e. the oldest whole record.
+ *
+ *  Otherwise, whole records may be written by means of rkh_trc_reserve() 
+ *  and rkh_trc_commit(). A reservation never overwrites unread bytes, it 
+ *  fails instead, so that the record is dropped and accounted by the 
+ *  caller. A record never wraps around the end of the stream: the bytes 
+ *  left until the end are filled with flags, which are read as empty 
+ *  frames. The following chunks of a long record are appended by 
+ *  rkh_trc_append(), which wraps around as usual.
+ */
+
 /* --------------------------------- Module -------------------------------- */
 #ifndef __RKHTRC_STREAM_H__
 #define __RKHTRC_STREAM_H__
@@ -61,10 +89,92 @@ extern "C" {
 #endif
 
 /* --------------------------------- Macros -------------------------------- */
+/**
+ *  \brief
+ *  Retrieves the stream bytes of a RKHTrcShared area.
+ */
+#define RKH_TRC_SHARED_STO(area_)   ((rui8_t *)((RKHTrcShared *)(area_) + 1))
+
+/**
+ *  \brief
+ *  Evaluates to RKH_ENABLED if the trace stream provides rkh_trc_reserve() 
+ *  and rkh_trc_commit().
+ */
+#if (RKH_CFG_TRC_SHARED_EN == RKH_DISABLED) && \
+    (RKH_CFG_TRC_FLIGHT_EN == RKH_DISABLED)
+    #define RKH_TRC_RESERVE_EN      RKH_ENABLED
+#else
+    #define RKH_TRC_RESERVE_EN      RKH_DISABLED
+#endif
+
 /* -------------------------------- Constants ------------------------------ */
+/**
+ *  \brief
+ *  Magic number of an initialized RKHTrcShared area, "RKHT".
+ */
+#define RKH_TRC_SHARED_MAGIC        0x524b4854u
+
+/**
+ *  \brief
+ *  Size of a RKHTrcShared area, stream included [in bytes].
+ */
+#define RKH_TRC_SIZEOF_SHARED \
+    (sizeof(RKHTrcShared) + RKH_CFG_TRC_SIZEOF_STREAM)
+
 /* ------------------------------- Data types ------------------------------ */
+/**
+ *  \brief
+ *  Header of a shared trace stream, which is followed by the stream bytes.
+ */
+typedef struct RKHTrcShared RKHTrcShared;
+struct RKHTrcShared
+{
+    rui32_t magic;          /**< RKH_TRC_SHARED_MAGIC, once initialized */
+    rui32_t size;           /**< size of the stream [in bytes] */
+    rui32_t head;           /**< number of bytes ever written */
+    rui32_t next;           /**< head once the bytes in progress are done */
+    rui32_t tail;           /**< number of bytes ever read */
+};
+
 /* -------------------------- External variables --------------------------- */
 /* -------------------------- Function prototypes -------------------------- */
+#if RKH_CFG_TRC_SHARED_EN == RKH_ENABLED
+/**
+ *  \brief
+ *  Places the trace stream into a shared area, i.e. a memory-mapped file, 
+ *  instead of the internal one. It must be called before rkh_trc_init(), 
+ *  which initializes the area.
+ *
+ *  \param[in] area    area of RKH_TRC_SIZEOF_SHARED bytes, suitably aligned, 
+ *                      or NULL to go back to the internal area.
+ */
+void rkh_trcStream_attach(RKHTrcShared *area);
+#endif
+
+#if RKH_CFG_TRC_FLIGHT_EN == RKH_ENABLED
+/**
+ *  \brief
+ *  Freezes the flight recorder, so that its content can be dumped by 
+ *  rkh_trc_flush(). Bytes put afterwards are discarded.
+ *
+ *  \note
+ *  rkh_trc_freeze() is NOT protected with a critical section.
+ */
+void rkh_trc_freeze(void);
+
+/**
+ *  \brief
+ *  Resumes the recording after a freeze, from an empty stream.
+ */
+void rkh_trc_unfreeze(void);
+
+/**
+ *  \brief
+ *  Evaluates to true if the flight recorder is frozen.
+ */
+rbool_t rkh_trc_isFrozen(void);
+#endif
+
 /**
  *  \brief
  *  Initializes the RKH's trace stream.
@@ -132,6 +242,20 @@ rui8_t *rkh_trc_get_block(TRCQTY_T *nget);
  */
 void rkh_trc_put(rui8_t b);
 
+/**
+ *  \brief
+ *  Put a block of data bytes into the trace stream, as rkh_trc_put() 
+ *  would do byte by byte but with one reservation.
+ *
+ *  \param[in] blk     data to be written in the trace stream.
+ *  \param[in] size    number of bytes to be written.
+ *
+ *  \note
+ *  If the block does not fit, the oldest bytes are overwritten.
+ *  rkh_trc_putBlock() is NOT protected with a critical section.
+ */
+void rkh_trc_putBlock(const rui8_t *blk, TRCQTY_T size);
+
 /**
  *  \brief
  *
@@ -155,6 +279,56 @@ void rkh_trc_put(rui8_t b);
  */
 TRCQTY_T rkh_trc_getWholeBlock(rui8_t *destBlock, TRCQTY_T nElem);
 
+#if RKH_TRC_RESERVE_EN == RKH_ENABLED
+/**
+ *  \brief
+ *  Reserves a contiguous block of the trace stream, where a whole record 
+ *  is written in place before calling rkh_trc_commit().
+ *
+ *  \param[in] size    number of bytes to be reserved, that is, an upper 
+ *                     bound of the record size.
+ *
+ *  \returns
+ *  A pointer to the reserved block, or NULL if it does not fit without 
+ *  overwriting unread bytes.
+ *
+ *  \note
+ *  If the block would wrap around, the bytes until the end of the stream 
+ *  are filled with flags. rkh_trc_reserve() is NOT protected with a 
+ *  critical section.
+ */
+rui8_t *rkh_trc_reserve(TRCQTY_T size);
+
+/**
+ *  \brief
+ *  Publishes the bytes written into the block given by the last 
+ *  rkh_trc_reserve().
+ *
+ *  \param[in] size    number of bytes actually written, which must not 
+ *                     exceed the reserved ones.
+ *
+ *  \note
+ *  rkh_trc_commit() is NOT protected with a critical section.
+ */
+void rkh_trc_commit(TRCQTY_T size);
+
+/**
+ *  \brief
+ *  Copies a block into the trace stream, wrapping around if needed, 
+ *  provided that it fits without overwriting unread bytes.
+ *
+ *  \param[in] blk     pointer to the block.
+ *  \param[in] size    number of bytes of the block.
+ *
+ *  \returns
+ *  RKH_TRUE if the block was copied, otherwise RKH_FALSE.
+ *
+ *  \note
+ *  rkh_trc_append() is NOT protected with a critical section.
+ */
+rbool_t rkh_trc_append(const rui8_t *blk, TRCQTY_T size);
+#endif
+
 /* -------------------- External C language linkage end -------------------- */
 #ifdef __cplusplus
 }
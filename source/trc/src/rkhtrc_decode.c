@@ -0,0 +1,696 @@
+/*
+ *  --------------------------------------------------------------------------
+ *
+ *                                Framework RKH
+ *                                -------------
+ *
+ *            State-machine framework for reactive embedded systems
+ *
+ *                      Copyright (C) 2010 Leandro Francucci.
+ *          All rights reserved. Protected by international copyright laws.
+ *
+ *
+ *  RKH is free software: you can redistribute it and/or modify it under the
+ *  terms of the GNU General Public License as published by the Free Software
+ *  Foundation, either version 3 of the License, or (at your option) any
+ *  later version.
+ *
+ *  RKH is distributed in the hope that it will be useful, but WITHOUT ANY
+ *  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with RKH, see copying.txt file.
+ *
+ *  Contact information:
+ *  RKH site: http://vortexmakes.com/que-es/
+ *  RKH GitHub: https://github.com/vortexmakes/RKH
+ *  RKH Sourceforge: https://sourceforge.net/projects/rkh-reactivesys/
+ *  e-mail: lf@vortexmakes.com
+ *  ---------------------------------------------------------------------------
+ */
+
+
+/**
+ *  \file       rkhtrc_decode.c
+ *  \brief      Trace stream decoder implementation
+ *  \ingroup    apiTrc
+ */
+
+/* -------------------------- Development history -------------------------- */
+/*
+ *  2026.10.19  LeFr  v3.4.00  Initial version
+ */
+
+/* -------------------------------- Authors -------------------------------- */
+/*
+ *  LeFr  Leandro Francucci  lf@vortexmakes.com
+ */
+
+/* --------------------------------- Notes --------------------------------- */
+/*
+ *  The arguments of each framework's trace event are described by a 
+ *  string, one character per argument, in the order given by 
+ *  rkhtrc_record.h:
+ *
+ *  'y' object address          'g' event signal
+ *  'f' function address        'E' event size
+ *  'r' sender address, if any  'n' number of blocks of a pool
+ *  '1' 8-bit integer           'm' idem 'n', if its low watermark is on
+ *  '2' 16-bit integer          'z' block size of a pool
+ *  '4' 32-bit integer          'e' number of elements of a queue
+ *  'i' trace event ID          'k' idem 'e', if its low watermark is on
+ *  's' string                  't' number of ticks
+ */
+
+/* ----------------------------- Include files ----------------------------- */
+#include <string.h>
+#include "rkhtrc_decode.h"
+
+/* ----------------------------- Local macros ------------------------------ */
+/* ------------------------------- Constants ------------------------------- */
+#define NO_FMT              0xff
+#define TCFG_OPTIONS        (RKH_TRC_DEC_SNDR_EN | RKH_TRC_DEC_QUE_LWM_EN | \
+                             RKH_TRC_DEC_MP_LWM_EN | RKH_TRC_DEC_NSEQ_EN | \
+                             RKH_TRC_DEC_TSTAMP_EN | RKH_TRC_DEC_CHK_EN | \
+                             RKH_TRC_DEC_COMPACT_EN)
+
+/* ---------------------------- Local data types --------------------------- */
+typedef struct Layout Layout;
+struct Layout
+{
+    RKH_TE_ID_T eid;
+    const char *args;
+};
+
+typedef struct Cursor Cursor;
+struct Cursor
+{
+    const rui8_t *p;
+    const rui8_t *end;
+    rbool_t isBad;
+};
+
+/* ---------------------------- Global variables --------------------------- */
+/* ---------------------------- Local variables ---------------------------- */
+static const Layout layouts[] =
+{
+    {RKH_TE_MP_INIT, "ynz"},
+    {RKH_TE_MP_GET, "ynm"},
+    {RKH_TE_MP_PUT, "yn"},
+    {RKH_TE_QUE_INIT, "yye"},
+    {RKH_TE_QUE_GET, "ye"},
+    {RKH_TE_QUE_FIFO, "yek"},
+    {RKH_TE_QUE_LIFO, "yek"},
+    {RKH_TE_QUE_FULL, "y"},
+    {RKH_TE_QUE_DPT, "y"},
+    {RKH_TE_QUE_GET_LAST, "y"},
+    {RKH_TE_SMA_ACT, "y11"},
+    {RKH_TE_SMA_TERM, "y1"},
+    {RKH_TE_SMA_GET, "yg11ek"},
+    {RKH_TE_SMA_FIFO, "ygr11ek"},
+    {RKH_TE_SMA_LIFO, "ygr11ek"},
+    {RKH_TE_SMA_REG, "y1"},
+    {RKH_TE_SMA_UNREG, "y1"},
+    {RKH_TE_SMA_DEFER, "yg"},
+    {RKH_TE_SMA_RCALL, "yg"},
+    {RKH_TE_SMA_DLMISS, "yt"},
+    {RKH_TE_SM_INIT, "yy"},
+    {RKH_TE_SM_CLRH, "yy"},
+    {RKH_TE_SM_TRN, "yyy"},
+    {RKH_TE_SM_STATE, "yy"},
+    {RKH_TE_SM_ENSTATE, "yy"},
+    {RKH_TE_SM_EXSTATE, "yy"},
+    {RKH_TE_SM_NENEX, "y11"},
+    {RKH_TE_SM_NTRNACT, "y11"},
+    {RKH_TE_SM_TS_STATE, "yy"},
+    {RKH_TE_SM_EVT_PROC, "y"},
+    {RKH_TE_SM_EVT_NFOUND, "yg"},
+    {RKH_TE_SM_GRD_FALSE, "y"},
+    {RKH_TE_SM_CND_NFOUND, "y"},
+    {RKH_TE_SM_UNKN_STATE, "y"},
+    {RKH_TE_SM_EX_HLEVEL, "y"},
+    {RKH_TE_SM_EX_TSEG, "y"},
+    {RKH_TE_SM_EXE_ACT, "1yyf"},
+    {RKH_TE_SM_DCH, "ygy"},
+    {RKH_TE_TMR_INIT, "yg"},
+    {RKH_TE_TMR_START, "yytt"},
+    {RKH_TE_TMR_STOP, "ytt"},
+    {RKH_TE_TMR_TOUT, "ygy"},
+    {RKH_TE_TMR_REM, "y"},
+    {RKH_TE_FWK_EN, ""},
+    {RKH_TE_FWK_EX, ""},
+    {RKH_TE_FWK_EPREG, "14En"},
+    {RKH_TE_FWK_AE, "Eg11nmy"},
+    {RKH_TE_FWK_GC, "g11"},
+    {RKH_TE_FWK_GCR, "g11nmy"},
+    {RKH_TE_FWK_OBJ, "ys"},
+    {RKH_TE_FWK_SIG, "gs"},
+    {RKH_TE_FWK_FUN, "ys"},
+    {RKH_TE_FWK_EXE_FUN, "f"},
+    {RKH_TE_FWK_SYNC_EVT, "frr"},
+    {RKH_TE_FWK_TUSR, "is"},
+    {RKH_TE_FWK_TCFG, "24111112"},
+    {RKH_TE_FWK_ASSERT, "s2"},
+    {RKH_TE_FWK_AO, "ys"},
+    {RKH_TE_FWK_STATE, "yys"},
+    {RKH_TE_FWK_PSTATE, "yys"},
+    {RKH_TE_FWK_TIMER, "ys"},
+    {RKH_TE_FWK_EPOOL, "1s"},
+    {RKH_TE_FWK_QUEUE, "ys"},
+    {RKH_TE_FWK_ACTOR, "ys"},
+    {RKH_TE_FWK_DROP, "4"}
+};
+
+/* ----------------------- Local function prototypes ----------------------- */
+/* ---------------------------- Local functions ---------------------------- */
+/* Size [in bytes] of a trace field of nBits, as the RKH_TRC_<field>() */
+/* macros do it */
+static rui8_t
+sizeOfField(rui32_t nBits, rui8_t dft)
+{
+    switch (nBits)
+    {
+        case 8:
+            return 1;
+        case 16:
+            return 2;
+        case 32:
+            return 4;
+        default:
+            return dft;
+    }
+}
+
+/* Addresses are sent in 16 or 32 bits, see RKH_TRC_SYM() */
+static rui8_t
+sizeOfAddress(rui32_t nBits)
+{
+    return (rui8_t)((nBits == 16) ? 2 : 4);
+}
+
+static rui32_t
+getInt(Cursor *c, rui8_t size)
+{
+    rui32_t value;
+    rui8_t i;
+
+    if ((rui32_t)(c->end - c->p) < size)
+    {
+        c->isBad = RKH_TRUE;
+        return 0;
+    }
+    for (value = 0, i = 0; i < size; ++i)
+    {
+        value |= (rui32_t)(*c->p++) << (i * 8);
+    }
+    return value;
+}
+
+static rui32_t
+getVarint(Cursor *c)
+{
+    rui32_t value;
+    rui8_t b, shift;
+
+    for (value = 0, shift = 0; shift < 35; shift += 7)
+    {
+        if (c->p == c->end)
+        {
+            break;
+        }
+        b = *c->p++;
+        value |= (rui32_t)(b & 0x7f) << shift;
+        if ((b & 0x80) == 0)
+        {
+            return value & 0xfffffffful;
+        }
+    }
+    c->isBad = RKH_TRUE;
+    return 0;
+}
+
+static void
+getStr(Cursor *c, RKHTrcDecArg *arg)
+{
+    const rui8_t *nul;
+
+    nul = (const rui8_t *)memchr(c->p, '\0', (size_t)(c->end - c->p));
+    if (nul == (const rui8_t *)0)
+    {
+        c->isBad = RKH_TRUE;
+        return;
+    }
+    arg->kind = RKH_TRC_DEC_STR;
+    arg->data = c->p;
+    arg->value = (rui32_t)(nul - c->p);
+    c->p = nul + 1;
+}
+
+static void
+getAddress(RKHTrcDec *me, Cursor *c, RKHTrcDecArg *arg, rui8_t size, 
+           rui8_t kind)
+{
+    rui32_t code, index;
+
+    arg->kind = kind;
+    if ((me->cfg.options & RKH_TRC_DEC_COMPACT_EN) == 0)
+    {
+        arg->value = getInt(c, size);
+        return;
+    }
+
+    code = getVarint(c);
+    index = code >> 1;
+    if ((code & 1) != 0)                    /* whole address follows */
+    {
+        arg->value = getInt(c, size);
+        if ((index != 0) && (index <= RKH_TRC_DEC_SIZEOF_SYMTBL))
+        {
+            me->symTbl[index - 1] = arg->value;
+        }
+    }
+    else if (index == 0)                    /* null address */
+    {
+        arg->value = 0;
+    }
+    else if (me->isSynced && (index <= RKH_TRC_DEC_SIZEOF_SYMTBL) && 
+             (me->symTbl[index - 1] != 0))
+    {
+        arg->value = me->symTbl[index - 1];
+    }
+    else
+    {
+        arg->kind = RKH_TRC_DEC_UNKNOWN;
+        arg->value = index;
+    }
+}
+
+static void
+getTstamp(RKHTrcDec *me, Cursor *c)
+{
+    rui32_t code, mask;
+
+    mask = (me->cfg.sizeofTstamp >= 4) ? 0xfffffffful : 
+                    ((rui32_t)1 << (me->cfg.sizeofTstamp * 8)) - 1;
+    if ((me->cfg.options & RKH_TRC_DEC_COMPACT_EN) == 0)
+    {
+        me->tstamp = getInt(c, me->cfg.sizeofTstamp);
+        return;
+    }
+
+    code = getVarint(c);
+    if (code == 1)                          /* key record */
+    {
+        me->tstamp = getInt(c, me->cfg.sizeofTstamp);
+        memset(me->symTbl, 0, sizeof(me->symTbl));
+        me->isSynced = RKH_TRUE;
+    }
+    else if ((code & 1) == 0)
+    {
+        me->tstamp = (me->tstamp + (code >> 1)) & mask;
+    }
+    else
+    {
+        c->isBad = RKH_TRUE;
+    }
+}
+
+static const char *
+findLayout(RKH_TE_ID_T eid)
+{
+    rui32_t i;
+
+    for (i = 0; i < sizeof(layouts) / sizeof(layouts[0]); ++i)
+    {
+        if (layouts[i].eid == eid)
+        {
+            return layouts[i].args;
+        }
+    }
+    return (const char *)0;
+}
+
+static void
+getArgs(RKHTrcDec *me, Cursor *c, const char *kinds)
+{
+    RKHTrcDecRecord *rec;
+    RKHTrcDecArg *arg;
+    const RKHTrcDecCfg *cfg;
+    rui8_t size;
+
+    rec = &me->rec;
+    cfg = &me->cfg;
+    for (; (*kinds != '\0') && !c->isBad; ++kinds)
+    {
+        if (((*kinds == 'r') && ((cfg->options & RKH_TRC_DEC_SNDR_EN) == 0)) ||
+            ((*kinds == 'm') && ((cfg->options & RKH_TRC_DEC_MP_LWM_EN) == 0)) ||
+            ((*kinds == 'k') && ((cfg->options & RKH_TRC_DEC_QUE_LWM_EN) == 0)))
+        {
+            continue;                       /* not sent by the target */
+        }
+        if (rec->nArgs == RKH_TRC_DEC_MAX_ARGS)
+        {
+            break;
+        }
+        arg = &rec->args[rec->nArgs++];
+        arg->kind = RKH_TRC_DEC_INT;
+        arg->fmt = NO_FMT;
+        arg->data = (const rui8_t *)0;
+        size = 0;
+        switch (*kinds)
+        {
+            case 'y':
+            case 'r':
+                getAddress(me, c, arg, cfg->sizeofPtr, RKH_TRC_DEC_SYM);
+                break;
+            case 'f':
+                getAddress(me, c, arg, cfg->sizeofFunPtr, RKH_TRC_DEC_FUN);
+                break;
+            case 's':
+                getStr(c, arg);
+                break;
+            case 'g':
+                arg->kind = RKH_TRC_DEC_SIG;
+                size = cfg->sizeofSig;
+                break;
+            case '1':
+            case '2':
+            case '4':
+                size = (rui8_t)(*kinds - '0');
+                break;
+            case 'i':
+                size = (rui8_t)sizeof(RKH_TE_ID_T);
+                break;
+            case 'E':
+                size = cfg->sizeofEvtSize;
+                break;
+            case 'n':
+            case 'm':
+                size = cfg->sizeofNblock;
+                break;
+            case 'z':
+                size = cfg->sizeofBsize;
+                break;
+            case 'e':
+            case 'k':
+                size = cfg->sizeofNelem;
+                break;
+            case 't':
+                size = cfg->sizeofNtick;
+                break;
+            default:
+                c->isBad = RKH_TRUE;
+                break;
+        }
+        if (size != 0)
+        {
+            arg->value = getInt(c, size);
+        }
+    }
+}
+
+/* User trace events carry their own format, see RKH_TUSR_I8() and so on */
+static void
+getUserArgs(RKHTrcDec *me, Cursor *c)
+{
+    RKHTrcDecRecord *rec;
+    RKHTrcDecArg *arg;
+    rui8_t size;
+
+    rec = &me->rec;
+    while ((c->p != c->end) && !c->isBad && 
+           (rec->nArgs < RKH_TRC_DEC_MAX_ARGS))
+    {
+        arg = &rec->args[rec->nArgs++];
+        arg->kind = RKH_TRC_DEC_INT;
+        arg->fmt = *c->p++;
+        arg->data = (const rui8_t *)0;
+        size = 0;
+        switch (arg->fmt & 0x0f)
+        {
+            case RKH_I8_T:
+            case RKH_UI8_T:
+                size = 1;
+                break;
+            case RKH_I16_T:
+            case RKH_UI16_T:
+                size = 2;
+                break;
+            case RKH_I32_T:
+            case RKH_UI32_T:
+            case RKH_X32_T:
+                size = 4;
+                break;
+            case RKH_STR_T:
+                getStr(c, arg);
+                break;
+            case RKH_MEM_T:
+                arg->kind = RKH_TRC_DEC_MEM;
+                arg->value = getInt(c, 1);
+                arg->data = c->p;
+                if ((rui32_t)(c->end - c->p) < arg->value)
+                {
+                    c->isBad = RKH_TRUE;
+                }
+                else
+                {
+                    c->p += arg->value;
+                }
+                break;
+            case RKH_OBJ_T:
+                arg->kind = RKH_TRC_DEC_SYM;
+                size = me->cfg.sizeofPtr;
+                break;
+            case RKH_FUN_T:
+                arg->kind = RKH_TRC_DEC_FUN;
+                size = me->cfg.sizeofFunPtr;
+                break;
+            case RKH_ESIG_T:
+                arg->kind = RKH_TRC_DEC_SIG;
+                size = me->cfg.sizeofSig;
+                break;
+            default:
+                c->isBad = RKH_TRUE;
+                break;
+        }
+        if (size != 0)
+        {
+            arg->value = getInt(c, size);
+        }
+    }
+}
+
+/* Takes the trace options of the target from its RKH_TE_FWK_TCFG record */
+static void
+setCfg(RKHTrcDec *me)
+{
+    RKHTrcDecCfg *cfg;
+    const RKHTrcDecArg *args;
+
+    cfg = &me->cfg;
+    args = me->rec.args;
+    cfg->options = args[1].value & TCFG_OPTIONS;
+    cfg->sizeofSig = sizeOfField((args[2].value >> 4) * 8, 1);
+    cfg->sizeofTstamp = sizeOfField((args[2].value & 0x0f) * 8, 2);
+    cfg->sizeofPtr = sizeOfAddress((args[3].value >> 4) * 8);
+    cfg->sizeofNtick = sizeOfField((args[3].value & 0x0f) * 8, 1);
+    cfg->sizeofNblock = sizeOfField((args[4].value >> 4) * 8, 1);
+    cfg->sizeofNelem = sizeOfField((args[4].value & 0x0f) * 8, 1);
+    cfg->sizeofEvtSize = sizeOfField(args[5].value * 8, 1);
+    cfg->sizeofBsize = sizeOfField((args[6].value >> 4) * 8, 1);
+}
+
+static rbool_t
+decode(RKHTrcDec *me)
+{
+    RKHTrcDecRecord *rec;
+    Cursor c;
+    rui32_t i, nLost;
+    rui8_t sum;
+    const char *kinds;
+
+    c.p = me->frame;
+    c.end = &me->frame[me->nFrame];
+    c.isBad = RKH_FALSE;
+    if ((me->cfg.options & RKH_TRC_DEC_CHK_EN) != 0)
+    {
+        for (sum = 0, i = 0; i < me->nFrame; ++i)
+        {
+            sum = (rui8_t)(sum + me->frame[i]);
+        }
+        if ((sum != 0) || (me->nFrame == 0))
+        {
+            return RKH_FALSE;
+        }
+        --c.end;
+    }
+
+    rec = &me->rec;
+    rec->nArgs = 0;
+    rec->eid = (RKH_TE_ID_T)getInt(&c, (rui8_t)sizeof(RKH_TE_ID_T));
+    if (rec->eid != RKH_TE_FWK_TCFG)        /* it has no header */
+    {
+        if ((me->cfg.options & RKH_TRC_DEC_NSEQ_EN) != 0)
+        {
+            rec->nseq = (rui8_t)getInt(&c, 1);
+            nLost = (rui8_t)(rec->nseq - me->nseq - 1);
+            if (!me->isFirst && (nLost != 0) && !c.isBad)
+            {
+                me->nLost += nLost;
+                me->isSynced = RKH_FALSE;
+            }
+            me->nseq = rec->nseq;
+            me->isFirst = RKH_FALSE;
+        }
+        if ((me->cfg.options & RKH_TRC_DEC_TSTAMP_EN) != 0)
+        {
+            getTstamp(me, &c);
+        }
+    }
+    rec->tstamp = me->tstamp;
+    rec->data = c.p;
+    rec->size = (rui32_t)(c.end - c.p);
+
+    if (GETGRP(rec->eid) == RKH_TG_USR)
+    {
+        getUserArgs(me, &c);
+    }
+    else if ((kinds = findLayout(rec->eid)) != (const char *)0)
+    {
+        getArgs(me, &c, kinds);
+    }
+    rec->isSynced = ((me->cfg.options & RKH_TRC_DEC_COMPACT_EN) == 0) || 
+                    me->isSynced;
+    if (c.isBad)
+    {
+        return RKH_FALSE;
+    }
+    if (rec->eid == RKH_TE_FWK_TCFG)
+    {
+        setCfg(me);
+    }
+    return RKH_TRUE;
+}
+
+/* ---------------------------- Global functions --------------------------- */
+void
+rkh_trcDec_init(RKHTrcDec *me, const RKHTrcDecCfg *cfg)
+{
+    memset(me, 0, sizeof(RKHTrcDec));
+    if (cfg != (const RKHTrcDecCfg *)0)
+    {
+        me->cfg = *cfg;
+    }
+    else
+    {
+        me->cfg.options = 
+#if defined(RKH_USE_TRC_SENDER)
+                          RKH_TRC_DEC_SNDR_EN |
+#endif
+#if RKH_CFG_QUE_GET_LWMARK_EN == RKH_ENABLED
+                          RKH_TRC_DEC_QUE_LWM_EN |
+#endif
+#if RKH_CFG_MP_GET_LWM_EN == RKH_ENABLED
+                          RKH_TRC_DEC_MP_LWM_EN |
+#endif
+#if RKH_CFG_TRC_NSEQ_EN == RKH_ENABLED
+                          RKH_TRC_DEC_NSEQ_EN |
+#endif
+#if RKH_CFG_TRC_TSTAMP_EN == RKH_ENABLED
+                          RKH_TRC_DEC_TSTAMP_EN |
+#endif
+#if RKH_CFG_TRC_CHK_EN == RKH_ENABLED
+                          RKH_TRC_DEC_CHK_EN |
+#endif
+#if RKH_CFG_TRC_COMPACT_EN == RKH_ENABLED
+                          RKH_TRC_DEC_COMPACT_EN |
+#endif
+                          0;
+        me->cfg.sizeofTstamp = sizeOfField(RKH_CFGPORT_TRC_SIZEOF_TSTAMP, 2);
+        me->cfg.sizeofPtr = sizeOfAddress(RKH_CFGPORT_TRC_SIZEOF_PTR);
+        me->cfg.sizeofFunPtr = sizeOfAddress(RKH_CFGPORT_TRC_SIZEOF_FUN_PTR);
+        me->cfg.sizeofSig = sizeOfField(RKH_CFG_FWK_SIZEOF_EVT, 1);
+        me->cfg.sizeofEvtSize = sizeOfField(RKH_CFG_FWK_SIZEOF_EVT_SIZE, 1);
+        me->cfg.sizeofNtick = sizeOfField(RKH_CFG_TMR_SIZEOF_NTIMER, 1);
+        me->cfg.sizeofNblock = sizeOfField(RKH_CFG_MP_SIZEOF_NBLOCK, 1);
+        me->cfg.sizeofBsize = sizeOfField(RKH_CFG_MP_SIZEOF_BSIZE, 1);
+        me->cfg.sizeofNelem = sizeOfField(RKH_CFG_QUE_SIZEOF_NELEM, 1);
+    }
+    me->isHunting = RKH_TRUE;
+    me->isFirst = RKH_TRUE;
+}
+
+const RKHTrcDecRecord *
+rkh_trcDec_put(RKHTrcDec *me, rui8_t b)
+{
+    rbool_t isValid;
+
+    if (b == RKH_FLG)
+    {
+        isValid = RKH_FALSE;
+        if (!me->isHunting && (me->nFrame != 0))
+        {
+            isValid = !me->isOverflow && !me->isEsc && decode(me);
+            if (isValid)
+            {
+                ++me->nRecords;
+            }
+            else
+            {
+                ++me->nErrors;
+                me->isSynced = RKH_FALSE;   /* it could be a key record */
+            }
+        }
+        me->isHunting = RKH_FALSE;
+        me->isOverflow = RKH_FALSE;
+        me->isEsc = RKH_FALSE;
+        me->nFrame = 0;
+        return isValid ? &me->rec : (const RKHTrcDecRecord *)0;
+    }
+
+    if (me->isHunting || me->isOverflow)
+    {
+        return (const RKHTrcDecRecord *)0;
+    }
+    if (b == RKH_ESC)
+    {
+        me->isEsc = RKH_TRUE;
+        return (const RKHTrcDecRecord *)0;
+    }
+    if (me->isEsc)
+    {
+        b ^= RKH_XOR;
+        me->isEsc = RKH_FALSE;
+    }
+    if (me->nFrame == RKH_TRC_DEC_SIZEOF_FRAME)
+    {
+        me->isOverflow = RKH_TRUE;
+    }
+    else
+    {
+        me->frame[me->nFrame++] = b;
+    }
+    return (const RKHTrcDecRecord *)0;
+}
+
+const RKHTrcDecCfg *
+rkh_trcDec_getCfg(const RKHTrcDec *me)
+{
+    return &me->cfg;
+}
+
+rui32_t
+rkh_trcDec_getErrors(const RKHTrcDec *me)
+{
+    return me->nErrors;
+}
+
+rui32_t
+rkh_trcDec_getLost(const RKHTrcDec *me)
+{
+    return me->nLost;
+}
+
+/* ------------------------------ End of file ------------------------------ */
@@ -52,6 +52,9 @@
 #include "rkhtrc_filter.h"
 #include "rkhfwk_bittbl.h"
 #include "rkhassert.h"
+#if RKH_CFG_TRC_SAMPLING_EN == RKH_ENABLED
+#include "rkhtrc_out.h"
+#endif
 
 #if RKH_CFG_TRC_RTFIL_EN == RKH_ENABLED
 /* ----------------------------- Local macros ------------------------------ */
@@ -61,9 +64,54 @@
  */
 RKH_MODULE_NAME(rkhtrc_filter)
 
+/*
+ *  Per-thread rings build the records without a critical section, thus 
+ *  the sampler counters are updated by means of atomic operations. 
+ *  Otherwise, they are plain accesses within the caller's critical section.
+ */
+#if (RKH_CFG_TRC_MAX_RINGS > 0) && defined(__GNUC__)
+    #define SMPL_LOCK_FREE_EN   RKH_ENABLED
+    #define SMPL_LOAD(p_) \
+        __atomic_load_n((p_), __ATOMIC_RELAXED)
+    #define SMPL_STORE(p_, v_) \
+        __atomic_store_n((p_), (v_), __ATOMIC_RELAXED)
+    #define SMPL_CAS(p_, pOld_, new_) \
+        __atomic_compare_exchange_n((p_), (pOld_), (new_), 0, \
+                                    __ATOMIC_RELAXED, __ATOMIC_RELAXED)
+#else
+    #define SMPL_LOCK_FREE_EN   RKH_DISABLED
+    #define SMPL_LOAD(p_) \
+        (*(p_))
+    #define SMPL_STORE(p_, v_) \
+        (*(p_) = (v_))
+    #define SMPL_CAS(p_, pOld_, new_) \
+        ((*(p_) = (new_)), RKH_TRUE)
+#endif
+
 /* ------------------------------- Constants ------------------------------- */
 /* ---------------------------- Local data types --------------------------- */
+#if RKH_CFG_TRC_SAMPLING_EN == RKH_ENABLED
+/**
+ *  \brief
+ *  Sampler of a trace event or group.
+ */
+typedef struct RKHTrcSampler RKHTrcSampler;
+struct RKHTrcSampler
+{
+    RKH_TE_ID_T id;         /**< Trace event or trace group */
+    rbool_t isGroup;        /**< RKH_TRUE if id is a trace group */
+    rui8_t mode;            /**< Sampling mode, see RKH_TRC_SOPT */
+    rui16_t value;          /**< Sampling ratio or records per second */
+    rui16_t count;          /**< Records to skip or emitted in this second */
+    RKH_TS_T start;         /**< Timestamp of the current second */
+};
+#endif
+
 /* ---------------------------- Global variables --------------------------- */
+#if RKH_CFG_TRC_RTFIL_FAST_EN == RKH_ENABLED
+rui8_t rkh_trcEvtFil[RKH_TRC_MAX_EVENTS / 8];
+#endif
+
 /* ---------------------------- Local variables ---------------------------- */
 /**
  *  \brief
@@ -164,6 +212,23 @@ static RKHROM RKH_GMTBL_T trcgmtbl[] =
 static const RKH_TRC_FIL_T fsig = {RKH_TRC_MAX_SIGNALS,   trcsigftbl};
 static const RKH_TRC_FIL_T fsma = {RKH_TRC_MAX_SMA,       trcsmaftbl};
 
+#if RKH_CFG_TRC_SAMPLING_EN == RKH_ENABLED
+/**
+ *  \brief
+ *  Table of sampled trace events, arranged as trceftbl[]. The bit of an 
+ *  event is set if either the event or its group has a sampler, so that 
+ *  the samplers are only looked up for those events.
+ */
+static rui8_t trcsmpltbl[RKH_TRC_MAX_EVENTS_IN_BYTES];
+
+/**
+ *  \brief
+ *  Samplers of trace events and groups. An unused sampler has the 
+ *  RKH_TRC_SMPL_NONE mode.
+ */
+static RKHTrcSampler samplers[RKH_CFG_TRC_MAX_SAMPLERS];
+#endif
+
 /* ----------------------- Local function prototypes ----------------------- */
 /* ---------------------------- Local functions ---------------------------- */
 static void
@@ -203,6 +268,36 @@ isOffFilter(rui8_t *filterTbl, RKH_TE_ID_T filter)
     return (*(filterTbl + y) & rkh_bittbl_getBitMask(x)) != 0;
 }
 
+#if RKH_CFG_TRC_RTFIL_FAST_EN == RKH_ENABLED
+static void
+updateEvtFil(RKH_TG_T grp)
+{
+    rui8_t *to, *from, ix, isGrpOn;
+
+    isGrpOn = (rui8_t)((trcgfilter & rkh_bittbl_getBitMask(grp)) != 0);
+    to = &rkh_trcEvtFil[GRPLSH(grp) >> 3];
+    from = &trceftbl[trcgmtbl[grp].offset];
+    for (ix = 0; ix < trcgmtbl[grp].range; ++ix, ++to, ++from)
+    {
+        *to = (rui8_t)(isGrpOn ? *from : 0);
+    }
+}
+
+static void
+updateAllEvtFil(void)
+{
+    RKH_TG_T grp;
+
+    for (grp = 0; grp < RKH_TRC_ALL_GROUPS; ++grp)
+    {
+        updateEvtFil(grp);
+    }
+}
+#else
+    #define updateEvtFil(grp)   (void)0
+    #define updateAllEvtFil()   (void)0
+#endif
+
 static const RKH_TRC_FIL_T *
 getFilterTable(RKHFilter fd)
 {
@@ -210,6 +305,130 @@ getFilterTable(RKHFilter fd)
     return (fd == RKHFilterSignal) ? &fsig : &fsma;
 }
 
+#if RKH_CFG_TRC_SAMPLING_EN == RKH_ENABLED
+static RKHTrcSampler *
+findSampler(RKH_TE_ID_T id, rbool_t isGroup)
+{
+    RKHTrcSampler *s;
+
+    for (s = samplers; s < &samplers[RKH_CFG_TRC_MAX_SAMPLERS]; ++s)
+    {
+        if ((s->mode != RKH_TRC_SMPL_NONE) && (s->id == id) && 
+            (s->isGroup == isGroup))
+        {
+            return s;
+        }
+    }
+    return (RKHTrcSampler *)0;
+}
+
+static RKHTrcSampler *
+getFreeSampler(void)
+{
+    RKHTrcSampler *s;
+
+    for (s = samplers; s < &samplers[RKH_CFG_TRC_MAX_SAMPLERS]; ++s)
+    {
+        if (s->mode == RKH_TRC_SMPL_NONE)
+        {
+            return s;
+        }
+    }
+    return (RKHTrcSampler *)0;
+}
+
+static void
+updateSampledEvents(void)
+{
+    RKHTrcSampler *s;
+    RKH_TE_ID_T e;
+    RKH_TG_T grp;
+
+    setAllFilters(trcsmpltbl, FILTER_ON, RKH_TRC_MAX_EVENTS_IN_BYTES);
+    for (s = samplers; s < &samplers[RKH_CFG_TRC_MAX_SAMPLERS]; ++s)
+    {
+        if (s->mode == RKH_TRC_SMPL_NONE)
+        {
+            continue;
+        }
+        if (s->isGroup == RKH_TRUE)
+        {
+            grp = (RKH_TG_T)s->id;
+            setAllFilters(&trcsmpltbl[trcgmtbl[grp].offset], FILTER_OFF,
+                          trcgmtbl[grp].range);
+        }
+        else
+        {
+            e = GETEVT(s->id);
+            grp = GETGRP(s->id);
+            setOneFilter(&trcsmpltbl[trcgmtbl[grp].offset + (e >> 3)],
+                         FILTER_OFF, e & 7);
+        }
+    }
+}
+
+static rbool_t
+sample(RKHTrcSampler *s)
+{
+    rui16_t count, next;
+#if RKH_CFG_TRC_TSTAMP_EN == RKH_ENABLED
+    RKH_TS_T now, start;
+
+    if (s->mode == RKH_TRC_SMPL_RATE)
+    {
+        now = rkh_trc_getts();
+        start = SMPL_LOAD(&s->start);
+        if (((RKH_TS_T)(now - start) >= (RKH_TS_T)RKH_CFG_TRC_TSTAMP_HZ) &&
+            SMPL_CAS(&s->start, &start, now))   /* only one starts it */
+        {
+            SMPL_STORE(&s->count, 0);
+        }
+        count = SMPL_LOAD(&s->count);
+        do
+        {
+            if (count >= s->value)
+            {
+                return RKH_FALSE;
+            }
+        }
+        while (!SMPL_CAS(&s->count, &count, (rui16_t)(count + 1)));
+        return RKH_TRUE;
+    }
+#endif
+    count = SMPL_LOAD(&s->count);
+    do
+    {
+        next = (count == 0) ? (rui16_t)(s->value - 1) : (rui16_t)(count - 1);
+    }
+    while (!SMPL_CAS(&s->count, &count, next));
+    return (rbool_t)(count == 0);
+}
+
+static rbool_t
+isSampledEvent(RKH_TE_ID_T e)
+{
+    return isOffFilter(&trcsmpltbl[trcgmtbl[GETGRP(e)].offset], GETEVT(e));
+}
+
+/* 
+ *  Sampler counters are shared by every context that records the event, 
+ *  thus they must be updated within a critical section, unless they are 
+ *  updated lock-free.
+ */
+static rbool_t
+sampleEvent(RKH_TE_ID_T e)
+{
+    RKHTrcSampler *s;
+
+    s = findSampler(e, RKH_FALSE);
+    if (s == (RKHTrcSampler *)0)
+    {
+        s = findSampler(GETGRP(e), RKH_TRUE);
+    }
+    return (s != (RKHTrcSampler *)0) ? sample(s) : RKH_TRUE;
+}
+#endif
+
 /* ---------------------------- Global functions --------------------------- */
 void 
 rkh_trc_filter_group_(rui8_t ctrl, RKH_TG_T grp, rui8_t mode)
@@ -220,6 +439,7 @@ rkh_trc_filter_group_(rui8_t ctrl, RKH_TG_T grp, rui8_t mode)
     if (grp == RKH_TRC_ALL_GROUPS)
     {
         trcgfilter = (rui8_t)((ctrl == FILTER_OFF) ? 0xFF : 0);
+        updateAllEvtFil();
         return;
     }
 
@@ -231,6 +451,7 @@ rkh_trc_filter_group_(rui8_t ctrl, RKH_TG_T grp, rui8_t mode)
         range = trcgmtbl[grp].range;
         setAllFilters(&trceftbl[offset], ctrl, range);
     }
+    updateEvtFil(grp);
 }
 
 void 
@@ -246,6 +467,7 @@ rkh_trc_filter_event_(rui8_t ctrl, RKH_TE_ID_T evt)
     {
         setAllFilters(trceftbl, ctrl, RKH_TRC_MAX_EVENTS_IN_BYTES);
         trcgfilter = (rui8_t)((ctrl == FILTER_OFF) ? 0xFF : 0);
+        updateAllEvtFil();
     }
     else
     {
@@ -258,6 +480,7 @@ rkh_trc_filter_event_(rui8_t ctrl, RKH_TE_ID_T evt)
         {
             trcgfilter |= rkh_bittbl_getBitMask(grp);
         }
+        updateEvtFil(grp);
     }
 }
 
@@ -309,6 +532,83 @@ rkh_trc_symFil_isoff(RKHFilter fd, RKH_TRC_FSLOT slot)
     return isOffFilter(filter->tbl, (RKH_TE_ID_T)slot);
 }
 
+#if RKH_CFG_TRC_SAMPLING_EN == RKH_ENABLED
+void
+rkh_trc_sample_(RKH_TE_ID_T id, rbool_t isGroup, rui8_t mode, rui16_t value)
+{
+    RKHTrcSampler *s;
+    RKH_SR_ALLOC();
+
+    RKH_REQUIRE((isGroup == RKH_TRUE) ? (id < RKH_TRC_ALL_GROUPS) :
+                                        (id < RKH_TRC_ALL_EVENTS));
+    RKH_REQUIRE((mode == RKH_TRC_SMPL_NONE) || 
+                (((mode == RKH_TRC_SMPL_ONE_IN_N) || 
+                  (mode == RKH_TRC_SMPL_RATE)) && (value != 0)));
+#if RKH_CFG_TRC_TSTAMP_EN == RKH_DISABLED
+    RKH_REQUIRE(mode != RKH_TRC_SMPL_RATE);
+#endif
+
+    RKH_ENTER_CRITICAL_();
+    s = findSampler(id, isGroup);
+    if (mode == RKH_TRC_SMPL_NONE)
+    {
+        if (s != (RKHTrcSampler *)0)
+        {
+            s->mode = RKH_TRC_SMPL_NONE;
+        }
+    }
+    else
+    {
+        if (s == (RKHTrcSampler *)0)
+        {
+            s = getFreeSampler();
+            if (s == (RKHTrcSampler *)0)
+            {
+                RKH_EXIT_CRITICAL_();
+                RKH_ERROR();
+                return;
+            }
+        }
+        s->id = id;
+        s->isGroup = isGroup;
+        s->value = value;
+        s->count = 0;
+#if RKH_CFG_TRC_TSTAMP_EN == RKH_ENABLED
+        s->start = rkh_trc_getts();
+#endif
+        s->mode = mode;
+    }
+    updateSampledEvents();
+    RKH_EXIT_CRITICAL_();
+}
+
+rbool_t
+rkh_trc_isSampled_(RKH_TE_ID_T e)
+{
+#if SMPL_LOCK_FREE_EN == RKH_ENABLED
+    return rkh_trc_isSampledNoCrit_(e);
+#else
+    rbool_t res;
+    RKH_SR_ALLOC();
+
+    if (!isSampledEvent(e))
+    {
+        return RKH_TRUE;
+    }
+    RKH_ENTER_CRITICAL_();
+    res = sampleEvent(e);
+    RKH_EXIT_CRITICAL_();
+    return res;
+#endif
+}
+
+rbool_t
+rkh_trc_isSampledNoCrit_(RKH_TE_ID_T e)
+{
+    return (!isSampledEvent(e)) ? RKH_TRUE : sampleEvent(e);
+}
+#endif
+
 void 
 rkh_trc_filter_get(RKH_FilterTbl *outFilterTbl)
 {
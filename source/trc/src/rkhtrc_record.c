@@ -49,12 +49,16 @@
 
 /* --------------------------------- Notes --------------------------------- */
 /* ----------------------------- Include files ----------------------------- */
+#include <string.h>
 #include "rkhtrc_record.h"
 #include "rkhtrc_stream.h"
 #include "rkhtrc_filter.h"
 #include "rkhassert.h"
 #include "rkhsma.h"
 #include "rkhfwk_hook.h"
+#if RKH_TRC_NUM_RINGS > 0
+#include "rkhtrc_ring.h"
+#endif
 
 #if RKH_CFG_TRC_EN == RKH_ENABLED
 
@@ -67,31 +71,452 @@ RKH_MODULE_NAME(rkhtrc_record)
 
 #if RKH_CFG_TRC_TSTAMP_EN == RKH_ENABLED
     #if RKH_CFGPORT_TRC_SIZEOF_TSTAMP == 8
-        #define RKH_TRC_TSTAMP() \
-            RKH_TRC_UI8(rkh_trc_getts())
+        #define RKH_TRC_TSTAMP_VALUE(ts_) \
+            RKH_TRC_UI8(ts_)
     #elif RKH_CFGPORT_TRC_SIZEOF_TSTAMP == 16
-        #define RKH_TRC_TSTAMP() \
-            RKH_TRC_UI16(rkh_trc_getts())
+        #define RKH_TRC_TSTAMP_VALUE(ts_) \
+            RKH_TRC_UI16(ts_)
     #elif RKH_CFGPORT_TRC_SIZEOF_TSTAMP == 32
+        #define RKH_TRC_TSTAMP_VALUE(ts_) \
+            RKH_TRC_UI32(ts_)
+    #else
+        #define RKH_TRC_TSTAMP_VALUE(ts_) \
+            RKH_TRC_UI16(ts_)
+    #endif
+    #if RKH_CFG_TRC_COMPACT_EN == RKH_ENABLED
         #define RKH_TRC_TSTAMP() \
-            RKH_TRC_UI32(rkh_trc_getts())
+            putTstamp(rkh_trc_getts())
     #else
         #define RKH_TRC_TSTAMP() \
-            RKH_TRC_UI16(rkh_trc_getts())
+            RKH_TRC_TSTAMP_VALUE(rkh_trc_getts())
     #endif
 #else
+    #define RKH_TRC_TSTAMP_VALUE(ts_)
     #define RKH_TRC_TSTAMP()
 #endif
 
+#if RKH_CFG_TRC_COMPACT_EN == RKH_ENABLED
+    /* Hashes an address into a slot of the symbol table */
+    #define SYM_SLOT(sym_) \
+        (rui32_t)((((sym_) >> 2) ^ ((sym_) >> 11)) & \
+                  (RKH_CFG_TRC_SIZEOF_SYMTBL - 1))
+#endif
+
+#if RKH_CFG_TRC_SIZEOF_RECORD > 0
+    /* Non-zero if any byte of the 32-bit word w_ is equal to b_ */
+    #define HAS_BYTE(w_, b_) \
+        ((((w_) ^ (0x01010101ul * (b_))) - 0x01010101ul) & \
+         ~((w_) ^ (0x01010101ul * (b_))) & 0x80808080ul)
+#endif
+
+#if RKH_CFG_TRC_MAX_RINGS > 0
+    #if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
+        #define RKH_THREAD_LOCAL    _Thread_local
+    #elif defined(__GNUC__)
+        #define RKH_THREAD_LOCAL    __thread
+    #else
+        #error "rkhtrc_record.c, per-thread trace rings need thread-local \
+storage"
+    #endif
+#else
+    #define RKH_THREAD_LOCAL        /* a single ring, within the */
+                                    /* critical section */
+#endif
+
+#if RKH_CFG_TRC_TSTAMP_EN == RKH_ENABLED
+    #define SIZEOF_RAW_TS           sizeof(RKH_TS_T)
+#else
+    #define SIZEOF_RAW_TS           0
+#endif
+
 /* ------------------------------- Constants ------------------------------- */
+#define SIZEOF_CHUNK                32u
+#define NO_TRIGGER                  0xffffu     /* out of RKH_TE_ID_T */
+
 /* ---------------------------- Local data types --------------------------- */
+#if RKH_TRC_NUM_RINGS > 0
+typedef enum RecState
+{
+    REC_IDLE, REC_IN_CHUNK, REC_IN_RING, REC_DROPPED
+} RecState;
+#endif
+
 /* ---------------------------- Global variables --------------------------- */
 /* ---------------------------- Local variables ---------------------------- */
 static rui8_t chk;
 static rui8_t nseq;
+#if RKH_CFG_TRC_COMPACT_EN == RKH_ENABLED
+static RKH_TS_T lastTstamp;
+static rui8_t nSync;        /* records until the next key record */
+static rui32_t symTbl[RKH_CFG_TRC_SIZEOF_SYMTBL];
+#endif
+#if RKH_CFG_TRC_FLIGHT_EN == RKH_ENABLED
+static rui16_t trigger = NO_TRIGGER;
+static rbool_t isTriggered;
+#endif
+#if RKH_CFG_TRC_SIZEOF_RECORD > 0
+static rui8_t raw[RKH_CFG_TRC_SIZEOF_RECORD];
+static rui8_t nRaw;
+static rui8_t frame[(RKH_CFG_TRC_SIZEOF_RECORD * 2) + 3];
+#if RKH_TRC_DROP_EN == RKH_ENABLED
+static rui32_t nDrop;        /* records dropped out of the stream */
+static rui32_t nDropReported; /* last count emitted as RKH_TE_FWK_DROP */
+static rbool_t isDropped;    /* the current record is being dropped */
+static rbool_t isPartial;    /* a long record is partially written */
+static rbool_t isResync;     /* a leading flag ends a truncated frame */
+#endif
+#endif
+#if RKH_TRC_NUM_RINGS > 0
+static RKHTrcRing rings[RKH_TRC_NUM_RINGS];
+static rui8_t ringSto[RKH_TRC_NUM_RINGS][RKH_CFG_TRC_SIZEOF_RING];
+static rui8_t nRings;
+static rui32_t nLost;       /* records dropped out of the rings */
+static RKH_TS_T lastTs;
+static RKH_THREAD_LOCAL RKHTrcRing *ring;
+static RKH_THREAD_LOCAL rui8_t recState;
+static RKH_THREAD_LOCAL rui8_t chunk[SIZEOF_CHUNK];
+static RKH_THREAD_LOCAL rui8_t nChunk;
+#endif
 
 /* ----------------------- Local function prototypes ----------------------- */
 /* ---------------------------- Local functions ---------------------------- */
+#if RKH_CFG_TRC_COMPACT_EN == RKH_ENABLED
+static void
+putVarint(rui32_t value)
+{
+    while (value >= 0x80)
+    {
+        rkh_trc_u8((rui8_t)(value | 0x80));
+        value >>= 7;
+    }
+    rkh_trc_u8((rui8_t)value);
+}
+
+/*
+ *  The timestamp code is the delta from the previous record shifted one 
+ *  bit to the left, or 1 in a key record, which is followed by the whole 
+ *  timestamp. A key record also restarts the symbol table.
+ */
+static void
+putTstamp(RKH_TS_T ts)
+{
+    rui32_t delta;
+
+    delta = (rui32_t)(RKH_TS_T)(ts - lastTstamp);
+    lastTstamp = ts;
+    if ((nSync == 0) || (delta > 0x7fffffffu))
+    {
+        nSync = RKH_CFG_TRC_SYNC_PERIOD;
+        memset(symTbl, 0, sizeof(symTbl));
+        putVarint(1);
+        RKH_TRC_TSTAMP_VALUE(ts);
+    }
+    else
+    {
+        putVarint(delta << 1);
+    }
+    --nSync;
+}
+
+/*
+ *  The symbol code is zero for a null address, twice the index of the 
+ *  symbol for a known address, or twice the index plus one for a new one, 
+ *  which is followed by the whole address. The index 0 is left for 
+ *  addresses that do not fit into the table.
+ */
+static void
+putSymbol(rui32_t sym, rui8_t size)
+{
+    rui32_t slot, n;
+
+    if (sym == 0)
+    {
+        rkh_trc_u8(0);
+        return;
+    }
+    for (slot = SYM_SLOT(sym), n = RKH_CFG_TRC_SIZEOF_SYMTBL; n != 0; --n)
+    {
+        if (symTbl[slot] == sym)
+        {
+            putVarint((slot + 1) << 1);
+            return;
+        }
+        if (symTbl[slot] == 0)
+        {
+            symTbl[slot] = sym;
+            break;
+        }
+        slot = (slot + 1) & (RKH_CFG_TRC_SIZEOF_SYMTBL - 1);
+    }
+    putVarint((n != 0) ? (((slot + 1) << 1) | 1) : 1);
+    if (size == 16)
+    {
+        rkh_trc_u16((rui16_t)sym);
+    }
+    else
+    {
+        rkh_trc_u32(sym);
+    }
+}
+#endif
+
+#if RKH_TRC_DROP_EN == RKH_ENABLED
+/*
+ *  Discards the rest of the current record. A key record follows, since 
+ *  the decoder would miss the symbols and the timestamp of this one.
+ */
+static void
+drop(void)
+{
+    isDropped = RKH_TRUE;
+    isResync = isPartial;
+    isPartial = RKH_FALSE;
+    ++nDrop;
+#if RKH_CFG_TRC_COMPACT_EN == RKH_ENABLED
+    nSync = 0;
+#endif
+    nRaw = 0;
+}
+#endif
+
+#if RKH_CFG_TRC_SIZEOF_RECORD > 0
+/*
+ *  Checksums and escapes the buffered bytes in one pass, taking a word at 
+ *  a time when it holds neither a flag nor an escape byte, and then copies 
+ *  the result into the trace stream at once. The last call of a record 
+ *  also appends the checksum and the flag.
+ *
+ *  If the trace stream is reserved record-wise, the first chunk of a 
+ *  record is encoded in place, and a record that does not fit is dropped 
+ *  as a whole, unless a long one was partially written. In such a case, 
+ *  its frame is closed by a leading flag of the next record, so it is 
+ *  discarded by the decoder.
+ */
+static void
+encode(rbool_t isLast)
+{
+    const rui8_t *s, *end;
+    rui8_t *p, *start, d, sum;
+    rui32_t w;
+
+#if RKH_TRC_DROP_EN == RKH_ENABLED
+    if (isDropped)
+    {
+        nRaw = 0;
+        return;
+    }
+    if (isPartial)
+    {
+        start = frame;          /* never padded, since it is within a frame */
+    }
+    else
+    {
+        /* Worst case: every byte and the checksum escaped, plus two flags */
+        start = rkh_trc_reserve((TRCQTY_T)((nRaw * 2) + 4));
+        if (start == (rui8_t *)0)
+        {
+            drop();
+            return;
+        }
+    }
+    p = start;
+    if (isResync)
+    {
+        isResync = RKH_FALSE;
+        *p++ = RKH_FLG;
+    }
+#else
+    p = start = frame;
+#endif
+
+    sum = chk;
+    for (s = raw, end = &raw[nRaw]; s < end; )
+    {
+        if ((end - s) >= 4)
+        {
+            w = (rui32_t)s[0] | ((rui32_t)s[1] << 8) | 
+                ((rui32_t)s[2] << 16) | ((rui32_t)s[3] << 24);
+            if (!HAS_BYTE(w, RKH_FLG) && !HAS_BYTE(w, RKH_ESC))
+            {
+                sum = (rui8_t)(sum + s[0] + s[1] + s[2] + s[3]);
+                p[0] = s[0];
+                p[1] = s[1];
+                p[2] = s[2];
+                p[3] = s[3];
+                p += 4;
+                s += 4;
+                continue;
+            }
+        }
+        d = *s++;
+        sum = (rui8_t)(sum + d);
+        if ((d == RKH_FLG) || (d == RKH_ESC))
+        {
+            *p++ = RKH_ESC;
+            *p++ = (rui8_t)(d ^ RKH_XOR);
+        }
+        else
+        {
+            *p++ = d;
+        }
+    }
+    chk = sum;
+
+    if (isLast)
+    {
+#if RKH_CFG_TRC_CHK_EN == RKH_ENABLED
+        d = (rui8_t)(~chk + 1);
+        if ((d == RKH_FLG) || (d == RKH_ESC))
+        {
+            *p++ = RKH_ESC;
+            *p++ = (rui8_t)(d ^ RKH_XOR);
+        }
+        else
+        {
+            *p++ = d;
+        }
+#endif
+        *p++ = RKH_FLG;
+    }
+#if RKH_TRC_DROP_EN == RKH_ENABLED
+    if (start != frame)
+    {
+        rkh_trc_commit((TRCQTY_T)(p - start));
+    }
+    else if (!rkh_trc_append(frame, (TRCQTY_T)(p - frame)))
+    {
+        drop();
+        return;
+    }
+    isPartial = !isLast;
+#else
+    rkh_trc_putBlock(start, (TRCQTY_T)(p - start));
+#endif
+    nRaw = 0;
+}
+#endif
+
+#if RKH_TRC_DROP_EN == RKH_ENABLED
+/*
+ *  Emits the number of dropped records, if it changed since the last 
+ *  report. A report that does not fit is not accounted as a dropped 
+ *  record, it is just retried by the next one.
+ */
+static void
+putDropped(void)
+{
+    rui32_t n;
+
+    n = nDrop;
+    if (n == nDropReported)
+    {
+        return;
+    }
+    rkh_trc_clear_chk();
+    RKH_TRC_TE_ID(RKH_TE_FWK_DROP);
+#if RKH_CFG_TRC_NSEQ_EN == RKH_ENABLED
+    rkh_trc_u8((rui8_t)(nseq));
+#endif
+    RKH_TRC_TSTAMP();
+    rkh_trc_u32(n);
+    encode(RKH_TRUE);
+    if (isDropped)
+    {
+        nDrop = n;
+    }
+    else
+    {
+#if RKH_CFG_TRC_NSEQ_EN == RKH_ENABLED
+        ++nseq;
+#endif
+        nDropReported = n;
+    }
+}
+#endif
+
+#if RKH_TRC_NUM_RINGS > 0
+static RKHTrcRing *
+getRing(void)
+{
+#if RKH_CFG_TRC_MAX_RINGS > 0
+    RKH_SR_ALLOC();
+
+    if (ring == (RKHTrcRing *)0)
+    {
+        RKH_ENTER_CRITICAL_();
+        if (nRings < RKH_CFG_TRC_MAX_RINGS)
+        {
+            ring = &rings[nRings];
+            rkh_trcRing_init(ring, ringSto[nRings], RKH_CFG_TRC_SIZEOF_RING);
+            ++nRings;
+        }
+        RKH_EXIT_CRITICAL_();
+    }
+#endif
+    return ring;
+}
+
+/* 
+ *  Bytes are gathered into a chunk, which is written into the ring at 
+ *  once, to check its free space just a few times per record. Most records 
+ *  fit in a single chunk, so that they are published by only one call.
+ */
+static void
+putRaw(const void *data, rui8_t size)
+{
+    const rui8_t *p;
+
+    for (p = (const rui8_t *)data; size != 0; --size, ++p)
+    {
+        chunk[nChunk++] = *p;
+    }
+}
+
+static void
+getRaw(RKHTrcRing *me, void *data, rui8_t size, rui32_t offset)
+{
+    rui8_t *p;
+
+    for (p = (rui8_t *)data; size != 0; --size, ++p, ++offset)
+    {
+        *p = rkh_trcRing_getByte(me, offset);
+    }
+}
+
+/*
+ *  Each record in a ring starts with its timestamp and event ID in native 
+ *  format, followed by its arguments without escaping. Then, it is framed 
+ *  as usual when it is moved into the trace stream.
+ */
+static void
+mergeRecord(RKHTrcRing *me)
+{
+    RKH_TE_ID_T eid;
+    rui32_t i, len;
+
+    (void)rkh_trcRing_peek(me, &len);
+    getRaw(me, &lastTs, SIZEOF_RAW_TS, 0);
+    getRaw(me, &eid, sizeof(RKH_TE_ID_T), SIZEOF_RAW_TS);
+
+#if RKH_TRC_DROP_EN == RKH_ENABLED
+    putDropped();
+#endif
+    rkh_trc_clear_chk();
+    RKH_TRC_TE_ID(eid);
+#if RKH_CFG_TRC_NSEQ_EN == RKH_ENABLED
+    rkh_trc_u8((rui8_t)(nseq));
+    ++nseq;
+#endif
+    RKH_TRC_TSTAMP_VALUE(lastTs);
+    for (i = SIZEOF_RAW_TS + sizeof(RKH_TE_ID_T); i < len; ++i)
+    {
+        rkh_trc_u8(rkh_trcRing_getByte(me, i));
+    }
+    rkh_trc_end();
+    rkh_trcRing_pop(me);
+}
+#endif
+
 /* ---------------------------- Global functions --------------------------- */
 void
 rkh_trc_init(void)
@@ -99,23 +524,89 @@ rkh_trc_init(void)
     rkh_trcStream_init();
     nseq = 0;
     chk = 0;
+#if RKH_TRC_DROP_EN == RKH_ENABLED
+    nDrop = 0;
+    nDropReported = 0;
+    isPartial = RKH_FALSE;
+    isResync = RKH_FALSE;
+#endif
+#if RKH_CFG_TRC_COMPACT_EN == RKH_ENABLED
+    lastTstamp = 0;
+    nSync = 0;
+#endif
+#if RKH_CFG_TRC_FLIGHT_EN == RKH_ENABLED
+    isTriggered = RKH_FALSE;
+#endif
+#if (RKH_TRC_NUM_RINGS > 0) && (RKH_CFG_TRC_MAX_RINGS == 0)
+    ring = &rings[0];
+    rkh_trcRing_init(ring, ringSto[0], RKH_CFG_TRC_SIZEOF_RING);
+    nRings = 1;
+#endif
 }
 
 void
 rkh_trc_begin(RKH_TE_ID_T eid)
 {
-    chk = 0;            /* Initialize the trace record checksum */
+#if RKH_TRC_NUM_RINGS > 0
+    RKH_TS_T ts;
+
+    if (getRing() == (RKHTrcRing *)0)
+    {
+        recState = REC_DROPPED;
+        ++nLost;
+        return;
+    }
+    recState = REC_IN_CHUNK;
+#if RKH_CFG_TRC_TSTAMP_EN == RKH_ENABLED
+    ts = rkh_trc_getts();
+#else
+    ts = 0;
+#endif
+    nChunk = 0;
+    putRaw(&ts, SIZEOF_RAW_TS);
+    putRaw(&eid, sizeof(RKH_TE_ID_T));
+#else
+#if RKH_CFG_TRC_FLIGHT_EN == RKH_ENABLED
+    if ((rui16_t)eid == trigger)
+    {
+        isTriggered = RKH_TRUE;
+    }
+#endif
+#if RKH_TRC_DROP_EN == RKH_ENABLED
+    putDropped();
+#endif
+    rkh_trc_clear_chk();    /* Initialize the trace record checksum */
     RKH_TRC_TE_ID(eid); /* Insert the event ID */
 #if RKH_CFG_TRC_NSEQ_EN == RKH_ENABLED
     rkh_trc_u8((rui8_t)(nseq)); /* Insert the sequence number */
     ++nseq;
 #endif
     RKH_TRC_TSTAMP();   /* Insert the timestamp */
+#endif
 }
 
 void
 rkh_trc_end(void)
 {
+#if RKH_TRC_NUM_RINGS > 0
+    if (recState != REC_IDLE)
+    {
+        if (recState == REC_IN_CHUNK)
+        {
+            (void)rkh_trcRing_write(ring, chunk, nChunk);
+        }
+        else if (recState == REC_IN_RING)
+        {
+            rkh_trcRing_putBlock(ring, chunk, nChunk);
+            (void)rkh_trcRing_end(ring);
+        }
+        recState = REC_IDLE;
+        return;
+    }
+#endif
+#if RKH_CFG_TRC_SIZEOF_RECORD > 0
+    encode(RKH_TRUE);
+#else
 #if RKH_CFG_TRC_CHK_EN == RKH_ENABLED
     chk = (rui8_t)(~chk + 1);   /* Inserts the previously calculated */
     rkh_trc_u8(chk);            /* checksum as: */
@@ -125,18 +616,89 @@ rkh_trc_end(void)
     rkh_trc_put(RKH_FLG);   /* Inserts directly into the trace stream the */
                             /* flag byte in a raw (without escaped sequence) */
                             /* manner */
+#endif
+#if RKH_CFG_TRC_FLIGHT_EN == RKH_ENABLED
+    if (isTriggered)
+    {
+        isTriggered = RKH_FALSE;
+        rkh_trc_freeze();   /* after the trigger record */
+    }
+#endif
     RKH_HOOK_PUT_TRCEVT();
 }
 
+#if RKH_CFG_TRC_FLIGHT_EN == RKH_ENABLED
+void
+rkh_trc_setTrigger(RKH_TE_ID_T eid)
+{
+    trigger = (rui16_t)eid;
+}
+
+void
+rkh_trc_clearTrigger(void)
+{
+    trigger = NO_TRIGGER;
+}
+
+void
+rkh_trc_freezeOnAssert(const char *const file, int line)
+{
+    if (!rkh_trc_isFrozen())
+    {
+        /* Neither filtered nor within a critical section, since it may */
+        /* already be taken */
+        rkh_trc_begin(RKH_TE_FWK_ASSERT);
+        RKH_TRC_STR(file);
+        RKH_TRC_UI16((rui16_t)line);
+        rkh_trc_end();
+        rkh_trc_freeze();
+        RKH_TRC_FLUSH();
+    }
+}
+#endif
+
 void
 rkh_trc_clear_chk(void)
 {
     chk = 0;
+#if RKH_CFG_TRC_SIZEOF_RECORD > 0
+    nRaw = 0;
+#endif
+#if RKH_TRC_DROP_EN == RKH_ENABLED
+    isDropped = RKH_FALSE;
+#endif
 }
 
 void
 rkh_trc_u8(rui8_t d)
 {
+#if RKH_TRC_NUM_RINGS > 0
+    if (recState != REC_IDLE)
+    {
+        if (recState != REC_DROPPED)
+        {
+            chunk[nChunk++] = d;
+            if (nChunk == SIZEOF_CHUNK)     /* long record, i.e. a string */
+            {
+                if (recState == REC_IN_CHUNK)
+                {
+                    rkh_trcRing_begin(ring);
+                    recState = REC_IN_RING;
+                }
+                rkh_trcRing_putBlock(ring, chunk, nChunk);
+                nChunk = 0;
+            }
+        }
+        return;
+    }
+#endif
+#if RKH_CFG_TRC_SIZEOF_RECORD > 0
+    raw[nRaw++] = d;
+    if (nRaw == RKH_CFG_TRC_SIZEOF_RECORD)  /* long record, i.e. a string */
+    {
+        encode(RKH_FALSE);
+    }
+#else
     chk = (rui8_t)(chk + d);
     if ((d == RKH_FLG) || (d == RKH_ESC))
     {
@@ -147,6 +709,7 @@ rkh_trc_u8(rui8_t d)
     {
         rkh_trc_put(d);
     }
+#endif
 }
 
 void
@@ -177,6 +740,20 @@ rkh_trc_str(const char *s)
     rkh_trc_u8('\0');
 }
 
+#if RKH_CFG_TRC_COMPACT_EN == RKH_ENABLED
+void
+rkh_trc_sym(rui32_t sym)
+{
+    putSymbol(sym, RKH_CFGPORT_TRC_SIZEOF_PTR);
+}
+
+void
+rkh_trc_fun(rui32_t fun)
+{
+    putSymbol(fun, RKH_CFGPORT_TRC_SIZEOF_FUN_PTR);
+}
+#endif
+
 void
 rkh_trc_obj(RKH_TE_ID_T tre, rui8_t *obj, const char *obj_name)
 {
@@ -221,6 +798,80 @@ rkh_trc_state(void *ao, rui8_t *state)
     RKH_TRC_FLUSH();
 }
 
+#if RKH_TRC_NUM_RINGS > 0
+void
+rkh_trc_merge(TRCQTY_T room)
+{
+    RKHTrcRing *next;
+    rui32_t len, nextLen;
+    RKH_TS_T ts, nextTs;
+    rui8_t i;
+
+    nextLen = 0;
+    nextTs = 0;
+    do
+    {
+        for (i = 0, next = (RKHTrcRing *)0; i < nRings; ++i)
+        {
+            if (rkh_trcRing_peek(&rings[i], &len))
+            {
+                getRaw(&rings[i], &ts, SIZEOF_RAW_TS, 0);
+                if ((next == (RKHTrcRing *)0) || 
+                    ((RKH_TS_T)(ts - lastTs) < (RKH_TS_T)(nextTs - lastTs)))
+                {
+                    next = &rings[i];
+                    nextTs = ts;
+                    nextLen = len;
+                }
+            }
+        }
+        if (next == (RKHTrcRing *)0)
+        {
+            break;
+        }
+
+        /* Worst case of a framed record: every byte escaped */
+        nextLen = (nextLen + 4) * 2;
+        if (nextLen > RKH_CFG_TRC_SIZEOF_STREAM)
+        {
+            rkh_trcRing_pop(next);      /* it would never fit */
+            ++nLost;
+        }
+        else if (nextLen <= room)
+        {
+            room -= (TRCQTY_T)nextLen;
+            mergeRecord(next);
+        }
+        else
+        {
+            break;
+        }
+    }
+    while (room != 0);
+}
+
+rui32_t
+rkh_trc_getRingDropped(void)
+{
+    rui32_t nDropped;
+    rui8_t i;
+
+    for (i = 0, nDropped = nLost; i < nRings; ++i)
+    {
+        nDropped += rkh_trcRing_getDropped(&rings[i]);
+    }
+    return nDropped;
+}
+#endif
+
+#if RKH_TRC_DROP_EN == RKH_ENABLED
+rui32_t
+rkh_trc_getDropped(void)
+{
+    return nDrop;
+}
+#endif
+
 #if RKH_CFG_TRC_USER_TRACE_EN == RKH_ENABLED
 void
 rkh_trc_fmt_u8(rui8_t fmt, rui8_t d)
@@ -0,0 +1,230 @@
+/*
+ *  --------------------------------------------------------------------------
+ *
+ *                                Framework RKH
+ *                                -------------
+ *
+ *            State-machine framework for reactive embedded systems
+ *
+ *                      Copyright (C) 2010 Leandro Francucci.
+ *          All rights reserved. Protected by international copyright laws.
+ *
+ *
+ *  RKH is free software: you can redistribute it and/or modify it under the
+ *  terms of the GNU General Public License as published by the Free Software
+ *  Foundation, either version 3 of the License, or (at your option) any
+ *  later version.
+ *
+ *  RKH is distributed in the hope that it will be useful, but WITHOUT ANY
+ *  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with RKH, see copying.txt file.
+ *
+ *  Contact information:
+ *  RKH site: http://vortexmakes.com/que-es/
+ *  RKH GitHub: https://github.com/vortexmakes/RKH
+ *  RKH Sourceforge: https://sourceforge.net/projects/rkh-reactivesys/
+ *  e-mail: lf@vortexmakes.com
+ *  ---------------------------------------------------------------------------
+ */
+
+
+/**
+ *  \file       rkhtrc_ring.c
+ *  \brief      Single-writer trace ring implementation
+ *  \ingroup    apiTrc
+ */
+
+/* -------------------------- Development history -------------------------- */
+/*
+ *  2026.10.19  LeFr  v3.4.00  Initial version
+ */
+
+/* -------------------------------- Authors -------------------------------- */
+/*
+ *  LeFr  Leandro Francucci  lf@vortexmakes.com
+ */
+
+/* --------------------------------- Notes --------------------------------- */
+/*
+ *  Indexes run freely and are masked on access. Without the GCC atomic 
+ *  built-ins, plain volatile accesses are used instead, which are only 
+ *  enough on single-core targets.
+ */
+
+/* ----------------------------- Include files ----------------------------- */
+#include "rkhtrc_ring.h"
+#include "rkhitl.h"
+#include "rkhassert.h"
+
+/* ----------------------------- Local macros ------------------------------ */
+/*
+ * This macro is needed only if the module requires to check expressions 
+ * that ought to be true as long as the program  is running.
+ */
+RKH_MODULE_NAME(rkhtrc_ring)
+
+#if defined(__GNUC__)
+    #define LOAD_ACQUIRE(p_) \
+        __atomic_load_n((p_), __ATOMIC_ACQUIRE)
+    #define STORE_RELEASE(p_, v_) \
+        __atomic_store_n((p_), (v_), __ATOMIC_RELEASE)
+#else
+    #define LOAD_ACQUIRE(p_) \
+        (*(volatile rui32_t *)(p_))
+    #define STORE_RELEASE(p_, v_) \
+        (*(volatile rui32_t *)(p_) = (v_))
+#endif
+
+/* ------------------------------- Constants ------------------------------- */
+#define SIZEOF_LEN      2u
+#define MAX_SIZE        0x10000ul
+
+/* ---------------------------- Local data types --------------------------- */
+/* ---------------------------- Global variables --------------------------- */
+/* ---------------------------- Local variables ---------------------------- */
+/* ----------------------- Local function prototypes ----------------------- */
+/* ---------------------------- Local functions ---------------------------- */
+static rbool_t
+hasRoom(RKHTrcRing *me)
+{
+    if (me->wr == me->limit)
+    {
+        me->limit = LOAD_ACQUIRE(&me->tail) + me->mask + 1;
+    }
+    return (rbool_t)(me->wr != me->limit);
+}
+
+static rui32_t
+getLen(const RKHTrcRing *me)
+{
+    return (rui32_t)me->sto[me->tail & me->mask] | 
+           ((rui32_t)me->sto[(me->tail + 1) & me->mask] << 8);
+}
+
+/* ---------------------------- Global functions --------------------------- */
+void
+rkh_trcRing_init(RKHTrcRing *me, rui8_t *sto, rui32_t size)
+{
+    RKH_REQUIRE((me != (RKHTrcRing *)0) && (sto != (rui8_t *)0) &&
+                (size > SIZEOF_LEN) && (size <= MAX_SIZE) &&
+                ((size & (size - 1)) == 0));
+
+    me->sto = sto;
+    me->mask = size - 1;
+    me->head = me->tail = me->wr = 0;
+    me->limit = size;
+    me->isFull = RKH_FALSE;
+    me->nDropped = 0;
+}
+
+void
+rkh_trcRing_begin(RKHTrcRing *me)
+{
+    me->wr = me->head;
+    me->isFull = RKH_FALSE;
+    rkh_trcRing_put(me, 0);     /* room for the record length */
+    rkh_trcRing_put(me, 0);
+}
+
+void
+rkh_trcRing_put(RKHTrcRing *me, rui8_t b)
+{
+    if (!me->isFull && hasRoom(me))
+    {
+        me->sto[me->wr & me->mask] = b;
+        ++me->wr;
+    }
+    else
+    {
+        me->isFull = RKH_TRUE;
+    }
+}
+
+void
+rkh_trcRing_putBlock(RKHTrcRing *me, const rui8_t *blk, rui32_t size)
+{
+    rui32_t wr;
+
+    if (!me->isFull && ((me->limit - me->wr) < size))
+    {
+        me->limit = LOAD_ACQUIRE(&me->tail) + me->mask + 1;
+    }
+    if (me->isFull || ((me->limit - me->wr) < size))
+    {
+        me->isFull = RKH_TRUE;
+        return;
+    }
+
+    for (wr = me->wr; size != 0; --size, ++wr, ++blk)
+    {
+        me->sto[wr & me->mask] = *blk;
+    }
+    me->wr = wr;
+}
+
+rbool_t
+rkh_trcRing_end(RKHTrcRing *me)
+{
+    rui32_t len;
+
+    if (me->isFull)
+    {
+        ++me->nDropped;
+        return RKH_FALSE;
+    }
+
+    len = me->wr - me->head - SIZEOF_LEN;
+    me->sto[me->head & me->mask] = (rui8_t)len;
+    me->sto[(me->head + 1) & me->mask] = (rui8_t)(len >> 8);
+    STORE_RELEASE(&me->head, me->wr);
+    return RKH_TRUE;
+}
+
+rbool_t
+rkh_trcRing_write(RKHTrcRing *me, const rui8_t *rec, rui32_t size)
+{
+    rui8_t len[SIZEOF_LEN];
+
+    me->wr = me->head;
+    me->isFull = RKH_FALSE;
+    len[0] = 0;
+    len[1] = 0;
+    rkh_trcRing_putBlock(me, len, SIZEOF_LEN);
+    rkh_trcRing_putBlock(me, rec, size);
+    return rkh_trcRing_end(me);
+}
+
+rbool_t
+rkh_trcRing_peek(RKHTrcRing *me, rui32_t *len)
+{
+    if (me->tail == LOAD_ACQUIRE(&me->head))
+    {
+        return RKH_FALSE;
+    }
+    *len = getLen(me);
+    return RKH_TRUE;
+}
+
+rui8_t
+rkh_trcRing_getByte(const RKHTrcRing *me, rui32_t offset)
+{
+    return me->sto[(me->tail + SIZEOF_LEN + offset) & me->mask];
+}
+
+void
+rkh_trcRing_pop(RKHTrcRing *me)
+{
+    STORE_RELEASE(&me->tail, me->tail + SIZEOF_LEN + getLen(me));
+}
+
+rui32_t
+rkh_trcRing_getDropped(const RKHTrcRing *me)
+{
+    return me->nDropped;
+}
+
+/* ------------------------------ End of file ------------------------------ */
@@ -53,6 +53,9 @@
 #include "rkhtrc_stream.h"
 #include "rkhfwk_bittbl.h"
 #include "rkhassert.h"
+#if RKH_TRC_NUM_RINGS > 0
+#include "rkhtrc_record.h"
+#endif
 
 /* ----------------------------- Local macros ------------------------------ */
 /*
@@ -61,23 +64,270 @@
  */
 RKH_MODULE_NAME(rkhtrc_stream)
 
+#if RKH_TRC_NUM_RINGS > 0
+    #define RKH_TRC_MERGE() \
+        rkh_trc_merge((TRCQTY_T)(RKH_CFG_TRC_SIZEOF_STREAM - trcqty))
+#else
+    #define RKH_TRC_MERGE()
+#endif
+
+#if defined(__GNUC__)
+    #define LOAD_ACQUIRE(p_) \
+        __atomic_load_n((p_), __ATOMIC_ACQUIRE)
+    #define STORE_RELEASE(p_, v_) \
+        __atomic_store_n((p_), (v_), __ATOMIC_RELEASE)
+    #define RESERVE(p_, v_) \
+        do \
+        { \
+            __atomic_store_n((p_), (v_), __ATOMIC_RELAXED); \
+            __atomic_thread_fence(__ATOMIC_RELEASE); \
+        } while (0)
+#else
+    #define LOAD_ACQUIRE(p_) \
+        (*(volatile rui32_t *)(p_))
+    #define STORE_RELEASE(p_, v_) \
+        (*(volatile rui32_t *)(p_) = (v_))
+    #define RESERVE(p_, v_) \
+        (*(volatile rui32_t *)(p_) = (v_))
+#endif
+
+#if RKH_CFG_TRC_FLIGHT_EN == RKH_ENABLED
+    #define RKH_TRC_IS_FROZEN()     (trcFrozen != RKH_FALSE)
+#else
+    #define RKH_TRC_IS_FROZEN()     RKH_FALSE
+#endif
+
+#if RKH_CFG_TRC_FLIGHT_EN == RKH_ENABLED
+    #define RKH_TRC_IS_HIDDEN()     (trcFrozen == RKH_FALSE)
+#else
+    #define RKH_TRC_IS_HIDDEN()     RKH_FALSE
+#endif
+
 /* ------------------------------- Constants ------------------------------- */
+#define STM_MASK        ((rui32_t)RKH_CFG_TRC_SIZEOF_STREAM - 1u)
+
 /* ---------------------------- Local data types --------------------------- */
+#if RKH_CFG_TRC_SHARED_EN == RKH_ENABLED
+typedef struct TrcLocal TrcLocal;
+struct TrcLocal
+{
+    RKHTrcShared hdr;
+    rui8_t sto[RKH_CFG_TRC_SIZEOF_STREAM];
+};
+#endif
+
 /* ---------------------------- Global variables --------------------------- */
 /* ---------------------------- Local variables ---------------------------- */
+#if RKH_CFG_TRC_SHARED_EN == RKH_ENABLED
+static TrcLocal trcLocal;
+static RKHTrcShared *trcsh = &trcLocal.hdr;
+static rui8_t *trcsto = trcLocal.sto;
+#else
 static rui8_t trcstm[RKH_CFG_TRC_SIZEOF_STREAM];
 static rui8_t *trcin, *trcout, *trcend;
 static TRCQTY_T trcqty;
+#endif
+#if RKH_CFG_TRC_FLIGHT_EN == RKH_ENABLED
+static rbool_t trcFrozen;
+#endif
 
 /* ----------------------- Local function prototypes ----------------------- */
 /* ---------------------------- Local functions ---------------------------- */
+#if RKH_CFG_TRC_SHARED_EN == RKH_ENABLED
+static rui32_t
+getPending(rui32_t *tail)
+{
+    rui32_t head;
+
+    *tail = trcsh->tail;
+    if (RKH_TRC_IS_HIDDEN())
+    {
+        return 0;
+    }
+    head = LOAD_ACQUIRE(&trcsh->head);
+    if ((rui32_t)(head - *tail) > RKH_CFG_TRC_SIZEOF_STREAM)
+    {
+        *tail = head - RKH_CFG_TRC_SIZEOF_STREAM;   /* overwritten bytes */
+    }
+    return head - *tail;
+}
+
+#if RKH_CFG_TRC_FLIGHT_EN == RKH_ENABLED
+static void
+skipToFlag(void)
+{
+    rui32_t tail, n;
+
+    for (n = getPending(&tail); 
+         (n != 0) && (trcsto[tail & STM_MASK] != RKH_FLG); --n)
+    {
+        ++tail;
+    }
+    STORE_RELEASE(&trcsh->tail, tail);
+}
+#endif
+#else
+#if RKH_CFG_TRC_FLIGHT_EN == RKH_ENABLED
+static void
+skipToFlag(void)
+{
+    while ((trcqty != 0) && (*trcout != RKH_FLG))
+    {
+        --trcqty;
+        if (++trcout >= trcend)
+        {
+            trcout = trcstm;
+        }
+    }
+}
+#endif
+#endif
+
 /* ---------------------------- Global functions --------------------------- */
+#if RKH_CFG_TRC_SHARED_EN == RKH_ENABLED
+void
+rkh_trcStream_attach(RKHTrcShared *area)
+{
+    trcsh = (area != (RKHTrcShared *)0) ? area : &trcLocal.hdr;
+    trcsto = RKH_TRC_SHARED_STO(trcsh);
+}
+
+void 
+rkh_trcStream_init(void)
+{
+    trcsh->magic = 0;
+    trcsh->size = RKH_CFG_TRC_SIZEOF_STREAM;
+    trcsh->head = trcsh->next = trcsh->tail = 0;
+#if RKH_CFG_TRC_FLIGHT_EN == RKH_ENABLED
+    trcFrozen = RKH_FALSE;
+#endif
+    STORE_RELEASE(&trcsh->magic, RKH_TRC_SHARED_MAGIC);
+    RKH_TRC_U8_RAW(RKH_FLG);
+}
+
+rui8_t *
+rkh_trc_get(void)
+{
+    rui32_t tail;
+    rui8_t *trByte = (rui8_t *)0;
+
+    if (getPending(&tail) != 0)
+    {
+        trByte = &trcsto[tail & STM_MASK];
+        STORE_RELEASE(&trcsh->tail, tail + 1);
+    }
+    return trByte;
+}
+
+rui8_t *
+rkh_trc_get_block(TRCQTY_T *nget)
+{
+    rui32_t tail, n, end;
+
+    n = getPending(&tail);
+    end = RKH_CFG_TRC_SIZEOF_STREAM - (tail & STM_MASK);
+    if (n > end)
+    {
+        n = end;
+    }
+    if (n > *nget)
+    {
+        n = *nget;
+    }
+
+    *nget = (TRCQTY_T)n;
+    if (n == 0)
+    {
+        return (rui8_t *)0;
+    }
+    STORE_RELEASE(&trcsh->tail, tail + n);
+    return &trcsto[tail & STM_MASK];
+}
+
+void 
+rkh_trc_put(rui8_t b)
+{
+    rui32_t head;
+
+    if (RKH_TRC_IS_FROZEN())
+    {
+        return;
+    }
+    head = trcsh->head;
+    RESERVE(&trcsh->next, head + 1);
+    trcsto[head & STM_MASK] = b;
+    STORE_RELEASE(&trcsh->head, head + 1);
+}
+
+void
+rkh_trc_putBlock(const rui8_t *blk, TRCQTY_T size)
+{
+    rui32_t head, n, qty;
+    rui8_t *in;
+
+    if (RKH_TRC_IS_FROZEN())
+    {
+        return;
+    }
+    head = trcsh->head;
+    if (size > RKH_CFG_TRC_SIZEOF_STREAM)   /* only the newest bytes fit */
+    {
+        blk += size - RKH_CFG_TRC_SIZEOF_STREAM;
+        head += size - RKH_CFG_TRC_SIZEOF_STREAM;
+        size = RKH_CFG_TRC_SIZEOF_STREAM;
+    }
+    RESERVE(&trcsh->next, head + size);
+
+    n = RKH_CFG_TRC_SIZEOF_STREAM - (head & STM_MASK);  /* until the end */
+    if (n > size)
+    {
+        n = size;
+    }
+    in = &trcsto[head & STM_MASK];
+    for (qty = n; qty != 0; --qty)
+    {
+        *in++ = *blk++;
+    }
+    for (in = trcsto, qty = size - n; qty != 0; --qty)  /* wrapped part */
+    {
+        *in++ = *blk++;
+    }
+    STORE_RELEASE(&trcsh->head, head + size);
+}
+
+TRCQTY_T 
+rkh_trc_getWholeBlock(rui8_t *destBlock, TRCQTY_T nElem)
+{
+    rui32_t tail, n, end;
+
+    n = getPending(&tail);
+    if (n > nElem)
+    {
+        n = nElem;
+    }
+    end = RKH_CFG_TRC_SIZEOF_STREAM - (tail & STM_MASK);
+    if (n > end)
+    {
+        memcpy(destBlock, &trcsto[tail & STM_MASK], end);
+        memcpy(destBlock + end, trcsto, n - end);
+    }
+    else
+    {
+        memcpy(destBlock, &trcsto[tail & STM_MASK], n);
+    }
+    STORE_RELEASE(&trcsh->tail, tail + n);
+    return (TRCQTY_T)n;
+}
+#else
 void 
 rkh_trcStream_init(void)
 {
     trcin = trcout = trcstm;
     trcqty = 0;
     trcend = &trcstm[RKH_CFG_TRC_SIZEOF_STREAM];
+#if RKH_CFG_TRC_FLIGHT_EN == RKH_ENABLED
+    trcFrozen = RKH_FALSE;
+#endif
     RKH_TRC_U8_RAW(RKH_FLG);
 }
 
@@ -86,10 +336,18 @@ rkh_trc_get(void)
 {
     rui8_t *trByte = (rui8_t *)0;
 
-    if (trcqty == 0)
+    if (RKH_TRC_IS_HIDDEN())
     {
         return trByte;
     }
+    if (trcqty == 0)
+    {
+        RKH_TRC_MERGE();
+        if (trcqty == 0)
+        {
+            return trByte;
+        }
+    }
 
     trByte = trcout++;
     --trcqty;
@@ -108,7 +366,8 @@ rkh_trc_get_block(TRCQTY_T *nget)
     rui8_t *trByte = (rui8_t *)0;
     TRCQTY_T n;
 
-    if (trcqty == (TRCQTY_T)0)
+    RKH_TRC_MERGE();
+    if ((trcqty == (TRCQTY_T)0) || RKH_TRC_IS_HIDDEN())
     {
         *nget = (TRCQTY_T)0;
         return trByte;
@@ -142,6 +401,10 @@ rkh_trc_get_block(TRCQTY_T *nget)
 void 
 rkh_trc_put(rui8_t b)
 {
+    if (RKH_TRC_IS_FROZEN())
+    {
+        return;
+    }
     *trcin++ = b;
     ++trcqty;
 
@@ -157,12 +420,61 @@ rkh_trc_put(rui8_t b)
     }
 }
 
+void
+rkh_trc_putBlock(const rui8_t *blk, TRCQTY_T size)
+{
+    TRCQTY_T n;
+    rui32_t qty;
+
+    if (RKH_TRC_IS_FROZEN())
+    {
+        return;
+    }
+    if (size > RKH_CFG_TRC_SIZEOF_STREAM)   /* only the newest bytes fit */
+    {
+        blk += size - RKH_CFG_TRC_SIZEOF_STREAM;
+        size = RKH_CFG_TRC_SIZEOF_STREAM;
+    }
+
+    /* Blocks are records, i.e. a few bytes, so that a plain loop is */
+    /* cheaper than calling memcpy() */
+    n = (TRCQTY_T)(trcend - trcin);         /* bytes until the end */
+    if (n > size)
+    {
+        n = size;
+    }
+    for (qty = n; qty != 0; --qty)
+    {
+        *trcin++ = *blk++;
+    }
+    if (trcin == trcend)
+    {
+        trcin = trcstm;
+    }
+    for (qty = size - n; qty != 0; --qty)   /* wrapped part */
+    {
+        *trcin++ = *blk++;
+    }
+
+    qty = (rui32_t)trcqty + size;
+    if (qty >= RKH_CFG_TRC_SIZEOF_STREAM)
+    {
+        trcqty = RKH_CFG_TRC_SIZEOF_STREAM;
+        trcout = trcin;
+    }
+    else
+    {
+        trcqty = (TRCQTY_T)qty;
+    }
+}
+
 TRCQTY_T 
 rkh_trc_getWholeBlock(rui8_t *destBlock, TRCQTY_T nElem)
 {
     TRCQTY_T result = 0, nConsumed, n, offset = 0;
 
-    if (trcqty != (TRCQTY_T)0)
+    RKH_TRC_MERGE();
+    if ((trcqty != (TRCQTY_T)0) && !RKH_TRC_IS_HIDDEN())
     {
         nConsumed = (nElem >= trcqty) ? trcqty : nElem;
         n = (TRCQTY_T)(trcend - trcout); /* Calculates the number of bytes */
@@ -195,4 +507,79 @@ rkh_trc_getWholeBlock(rui8_t *destBlock, TRCQTY_T nElem)
     return result;
 }
 
+#if RKH_TRC_RESERVE_EN == RKH_ENABLED
+rui8_t *
+rkh_trc_reserve(TRCQTY_T size)
+{
+    TRCQTY_T n;
+
+    n = (TRCQTY_T)(trcend - trcin);         /* bytes until the end */
+    if (size > n)
+    {
+        if (((rui32_t)trcqty + n + size) > RKH_CFG_TRC_SIZEOF_STREAM)
+        {
+            return (rui8_t *)0;
+        }
+        trcqty = (TRCQTY_T)(trcqty + n);
+        for (; n != 0; --n)                 /* read as empty frames */
+        {
+            *trcin++ = RKH_FLG;
+        }
+        trcin = trcstm;
+    }
+    else if (((rui32_t)trcqty + size) > RKH_CFG_TRC_SIZEOF_STREAM)
+    {
+        return (rui8_t *)0;
+    }
+    return trcin;
+}
+
+void
+rkh_trc_commit(TRCQTY_T size)
+{
+    trcin += size;
+    trcqty = (TRCQTY_T)(trcqty + size);
+    if (trcin == trcend)
+    {
+        trcin = trcstm;
+    }
+}
+
+rbool_t
+rkh_trc_append(const rui8_t *blk, TRCQTY_T size)
+{
+    if (((rui32_t)trcqty + size) > RKH_CFG_TRC_SIZEOF_STREAM)
+    {
+        return RKH_FALSE;
+    }
+    rkh_trc_putBlock(blk, size);
+    return RKH_TRUE;
+}
+#endif
+#endif
+
+#if RKH_CFG_TRC_FLIGHT_EN == RKH_ENABLED
+void
+rkh_trc_freeze(void)
+{
+    if (!trcFrozen)
+    {
+        trcFrozen = RKH_TRUE;
+        skipToFlag();       /* the oldest record may be partly overwritten */
+    }
+}
+
+void
+rkh_trc_unfreeze(void)
+{
+    rkh_trcStream_init();
+}
+
+rbool_t
+rkh_trc_isFrozen(void)
+{
+    return trcFrozen;
+}
+#endif
+
 /* ------------------------------ End of file ------------------------------ */
@@ -0,0 +1,312 @@
+/*
+ *  --------------------------------------------------------------------------
+ *
+ *                                Framework RKH
+ *                                -------------
+ *
+ *            State-machine framework for reactive embedded systems
+ *
+ *                      Copyright (C) 2010 Leandro Francucci.
+ *          All rights reserved. Protected by international copyright laws.
+ *
+ *
+ *  RKH is free software: you can redistribute it and/or modify it under the
+ *  terms of the GNU General Public License as published by the Free Software
+ *  Foundation, either version 3 of the License, or (at your option) any
+ *  later version.
+ *
+ *  RKH is distributed in the hope that it will be useful, but WITHOUT ANY
+ *  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with RKH, see copying.txt file.
+ *
+ *  Contact information:
+ *  RKH site: http://vortexmakes.com/que-es/
+ *  RKH GitHub: https://github.com/vortexmakes/RKH
+ *  RKH Sourceforge: https://sourceforge.net/projects/rkh-reactivesys/
+ *  e-mail: lf@vortexmakes.com
+ *  ---------------------------------------------------------------------------
+ */
+
+
+/**
+ *  \file       test_rkhtrc_decode.c
+ *  \ingroup    test_trace
+ *  \brief      Unit test for trace stream decoder module.
+ *
+ *  \addtogroup test
+ *  @{
+ *  \addtogroup test_trace Trace
+ *  @{
+ *  \brief      Unit test for trace module.
+ */
+
+/* -------------------------- Development history -------------------------- */
+/*
+ *  2026.10.19  LeFr  v3.4.00  Initial version
+ */
+
+/* -------------------------------- Authors -------------------------------- */
+/*
+ *  LeFr  Leandro Francucci  lf@vortexmakes.com
+ */
+
+/* --------------------------------- Notes --------------------------------- */
+/* ----------------------------- Include files ----------------------------- */
+#include "unity.h"
+#include "rkhtrc_decode.h"
+
+/* ----------------------------- Local macros ------------------------------ */
+/* ------------------------------- Constants ------------------------------- */
+/* ---------------------------- Local data types --------------------------- */
+/* ---------------------------- Global variables --------------------------- */
+/* ---------------------------- Local variables ---------------------------- */
+static RKHTrcDec dec;
+
+/* ----------------------- Local function prototypes ----------------------- */
+/* ---------------------------- Local functions ---------------------------- */
+static void
+putByte(rui8_t b)
+{
+    if ((b == RKH_FLG) || (b == RKH_ESC))
+    {
+        (void)rkh_trcDec_put(&dec, RKH_ESC);
+        b ^= RKH_XOR;
+    }
+    (void)rkh_trcDec_put(&dec, b);
+}
+
+/* Frames a record as rkh_trc_end() does it */
+static const RKHTrcDecRecord *
+putRecord(const rui8_t *rec, rui32_t size)
+{
+    rui8_t chk;
+
+    for (chk = 0; size != 0; --size, ++rec)
+    {
+        chk = (rui8_t)(chk + *rec);
+        putByte(*rec);
+    }
+    putByte((rui8_t)(~chk + 1));
+    return rkh_trcDec_put(&dec, RKH_FLG);
+}
+
+static void
+setCompact(void)
+{
+    RKHTrcDecCfg cfg;
+
+    cfg = *rkh_trcDec_getCfg(&dec);
+    cfg.options |= RKH_TRC_DEC_COMPACT_EN;
+    rkh_trcDec_init(&dec, &cfg);
+    (void)rkh_trcDec_put(&dec, RKH_FLG);
+}
+
+/* ---------------------------- Global functions --------------------------- */
+void
+setUp(void)
+{
+    rkh_trcDec_init(&dec, (const RKHTrcDecCfg *)0);
+    (void)rkh_trcDec_put(&dec, RKH_FLG);
+}
+
+void
+tearDown(void)
+{
+}
+
+/**
+ *  \addtogroup test_decode Trace stream decoder test group
+ *  @{
+ *  \name Test cases of trace stream decoder group
+ *  @{ 
+ */
+void
+test_DecodesARecord(void)
+{
+    const RKHTrcDecRecord *rec;
+    rui8_t trn[] = 
+    {
+        RKH_TE_SM_TRN, 0, 0x01, 0x02, 0x03, 0x04, 
+        0x10, 0x20, 0x30, 0x40, 0x11, 0x21, 0x31, 0x41, 0, 0, 0, 0
+    };
+
+    rec = putRecord(trn, sizeof(trn));
+
+    TEST_ASSERT_NOT_NULL(rec);
+    TEST_ASSERT_EQUAL(RKH_TE_SM_TRN, rec->eid);
+    TEST_ASSERT_EQUAL(0, rec->nseq);
+    TEST_ASSERT_EQUAL_HEX32(0x04030201, rec->tstamp);
+    TEST_ASSERT_TRUE(rec->isSynced);
+    TEST_ASSERT_EQUAL(3, rec->nArgs);
+    TEST_ASSERT_EQUAL(RKH_TRC_DEC_SYM, rec->args[0].kind);
+    TEST_ASSERT_EQUAL_HEX32(0x40302010, rec->args[0].value);
+    TEST_ASSERT_EQUAL_HEX32(0x41312111, rec->args[1].value);
+    TEST_ASSERT_EQUAL_HEX32(0, rec->args[2].value);
+    TEST_ASSERT_EQUAL(12, rec->size);
+}
+
+void
+test_SkipsBytesBeforeTheFirstFlag(void)
+{
+    rui8_t exe[] = {RKH_TE_FWK_EXE_FUN, 1, 0, 0, 0, 0, 0x78, 0x56, 0x34, 0x12};
+
+    rkh_trcDec_init(&dec, (const RKHTrcDecCfg *)0);
+    TEST_ASSERT_NULL(putRecord(exe, 6));
+    TEST_ASSERT_NOT_NULL(putRecord(exe, sizeof(exe)));
+    TEST_ASSERT_EQUAL(0, rkh_trcDec_getErrors(&dec));
+}
+
+void
+test_UnescapesFlagAndEscapeBytes(void)
+{
+    const RKHTrcDecRecord *rec;
+    rui8_t exe[] = 
+    {
+        RKH_TE_FWK_EXE_FUN, 0, RKH_FLG, RKH_ESC, RKH_FLG, RKH_ESC, 
+        RKH_ESC, 0, 0, RKH_FLG
+    };
+
+    rec = putRecord(exe, sizeof(exe));
+
+    TEST_ASSERT_NOT_NULL(rec);
+    TEST_ASSERT_EQUAL_HEX32(0x7d7e7d7e, rec->tstamp);
+    TEST_ASSERT_EQUAL(RKH_TRC_DEC_FUN, rec->args[0].kind);
+    TEST_ASSERT_EQUAL_HEX32(0x7e00007d, rec->args[0].value);
+}
+
+void
+test_DiscardsMalformedRecords(void)
+{
+    rui8_t exe[] = {RKH_TE_FWK_EXE_FUN, 0, 0, 0, 0, 0, 1, 2, 3, 4};
+
+    putByte(RKH_TE_FWK_EXE_FUN);                /* bad checksum */
+    TEST_ASSERT_NULL(rkh_trcDec_put(&dec, RKH_FLG));
+    TEST_ASSERT_EQUAL(1, rkh_trcDec_getErrors(&dec));
+
+    TEST_ASSERT_NULL(putRecord(exe, sizeof(exe) - 2));  /* truncated */
+    TEST_ASSERT_EQUAL(2, rkh_trcDec_getErrors(&dec));
+}
+
+void
+test_CountsLostRecordsBySequenceNumber(void)
+{
+    rui8_t en[] = {RKH_TE_FWK_EN, 7, 0, 0, 0, 0};
+
+    putRecord(en, sizeof(en));
+    en[1] = 10;
+    putRecord(en, sizeof(en));
+    en[1] = 11;
+    putRecord(en, sizeof(en));
+
+    TEST_ASSERT_EQUAL(2, rkh_trcDec_getLost(&dec));
+}
+
+void
+test_ExpandsCompactTimestampsAndSymbols(void)
+{
+    const RKHTrcDecRecord *rec;
+    rui8_t key[] = 
+    {
+        RKH_TE_SM_TRN, 0, 1, 0xf0, 0xff, 0x00, 0x00,
+        7, 0x10, 0x20, 0x30, 0x40, 6, 0
+    };
+    rui8_t next[] = {RKH_TE_SM_STATE, 1, 0x80, 0x01, 6, 9, 1, 2, 3, 4};
+
+    setCompact();
+    rec = putRecord(key, sizeof(key));
+    TEST_ASSERT_NOT_NULL(rec);
+    TEST_ASSERT_TRUE(rec->isSynced);
+    TEST_ASSERT_EQUAL_HEX32(0xfff0, rec->tstamp);
+    TEST_ASSERT_EQUAL_HEX32(0x40302010, rec->args[0].value);
+    TEST_ASSERT_EQUAL_HEX32(0x40302010, rec->args[1].value);
+    TEST_ASSERT_EQUAL_HEX32(0, rec->args[2].value);
+
+    rec = putRecord(next, sizeof(next));
+    TEST_ASSERT_NOT_NULL(rec);
+    TEST_ASSERT_EQUAL_HEX32(0xfff0 + 0x40, rec->tstamp);
+    TEST_ASSERT_EQUAL_HEX32(0x40302010, rec->args[0].value);
+    TEST_ASSERT_EQUAL(RKH_TRC_DEC_SYM, rec->args[1].kind);
+    TEST_ASSERT_EQUAL_HEX32(0x04030201, rec->args[1].value);
+}
+
+void
+test_RecordsAreNotSyncedFromALossUntilAKeyRecord(void)
+{
+    const RKHTrcDecRecord *rec;
+    rui8_t key[] = {RKH_TE_SM_EVT_PROC, 0, 1, 0, 0, 0, 0, 7, 1, 2, 3, 4};
+    rui8_t ref[] = {RKH_TE_SM_EVT_PROC, 2, 4, 6};
+
+    setCompact();
+    putRecord(key, sizeof(key));
+    rec = putRecord(ref, sizeof(ref));
+    TEST_ASSERT_NOT_NULL(rec);
+    TEST_ASSERT_FALSE(rec->isSynced);
+    TEST_ASSERT_EQUAL(RKH_TRC_DEC_UNKNOWN, rec->args[0].kind);
+    TEST_ASSERT_EQUAL(3, rec->args[0].value);
+
+    key[1] = 3;
+    rec = putRecord(key, sizeof(key));
+    TEST_ASSERT_TRUE(rec->isSynced);
+    TEST_ASSERT_EQUAL_HEX32(0x04030201, rec->args[0].value);
+}
+
+void
+test_TakesTheTargetOptionsFromTcfg(void)
+{
+    const RKHTrcDecRecord *rec;
+    rui8_t tcfg[] = 
+    {
+        RKH_TE_FWK_TCFG, 0x00, 0x34, 
+        0x00, 0x00, 0x03, 0x00,     /* timestamp and checksum */
+        0x12, 0x22, 0x11, 0x01, 0x11, 100, 0
+    };
+    rui8_t epreg[] = {RKH_TE_FWK_EPREG, 0x34, 0x12, 1, 4, 3, 2, 1, 8, 16};
+
+    rec = putRecord(tcfg, sizeof(tcfg));
+    TEST_ASSERT_NOT_NULL(rec);
+    TEST_ASSERT_EQUAL(2, rkh_trcDec_getCfg(&dec)->sizeofTstamp);
+    TEST_ASSERT_EQUAL(2, rkh_trcDec_getCfg(&dec)->sizeofPtr);
+
+    rec = putRecord(epreg, sizeof(epreg));
+    TEST_ASSERT_NOT_NULL(rec);
+    TEST_ASSERT_EQUAL_HEX32(0x1234, rec->tstamp);
+    TEST_ASSERT_EQUAL(4, rec->nArgs);
+    TEST_ASSERT_EQUAL_HEX32(0x01020304, rec->args[1].value);
+    TEST_ASSERT_EQUAL(8, rec->args[2].value);
+    TEST_ASSERT_EQUAL(16, rec->args[3].value);
+}
+
+void
+test_SplitsFormattedUserArgs(void)
+{
+    const RKHTrcDecRecord *rec;
+    rui8_t usr[] = 
+    {
+        RKH_TE_USER, 0, 0, 0, 0, 0, 
+        (4 << 4) | RKH_UI8_T, 200, RKH_STR_T, 'o', 'k', '\0', 
+        RKH_MEM_T, 2, 0xaa, 0xbb
+    };
+
+    rec = putRecord(usr, sizeof(usr));
+
+    TEST_ASSERT_NOT_NULL(rec);
+    TEST_ASSERT_EQUAL(3, rec->nArgs);
+    TEST_ASSERT_EQUAL((4 << 4) | RKH_UI8_T, rec->args[0].fmt);
+    TEST_ASSERT_EQUAL(200, rec->args[0].value);
+    TEST_ASSERT_EQUAL(RKH_TRC_DEC_STR, rec->args[1].kind);
+    TEST_ASSERT_EQUAL_STRING("ok", (const char *)rec->args[1].data);
+    TEST_ASSERT_EQUAL(RKH_TRC_DEC_MEM, rec->args[2].kind);
+    TEST_ASSERT_EQUAL(2, rec->args[2].value);
+    TEST_ASSERT_EQUAL_HEX8(0xbb, rec->args[2].data[1]);
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+
+/* ------------------------------ End of file ------------------------------ */
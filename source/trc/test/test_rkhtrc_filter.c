@@ -59,6 +59,8 @@
 #include "rkhtrc_filter.h"
 #include "Mock_rkhassert.h"
 #include "Mock_rkhfwk_bittbl.h"
+#include "Mock_rkhport.h"
+#include "Mock_rkhtrc_out.h"
 #include <string.h>
 
 /* ----------------------------- Local macros ------------------------------ */
@@ -67,6 +69,7 @@
 #define MAX_NUM_BITS        (SIZEOF_BIT_TBL * 8)
 #define FILTER_ON_BYTE      0
 #define FILTER_OFF_BYTE     0xff
+#define TSTAMP_START        1000
 
 /* ---------------------------- Local data types --------------------------- */
 /* ---------------------------- Global variables --------------------------- */
@@ -83,6 +86,8 @@ static void setUp_toolForTest(void);
 static void tearDown_toolForTest(void);
 static void setUp_filter(void);
 static void tearDown_filter(void);
+static void setUp_sampler(void);
+static void tearDown_sampler(void);
 
 /* ---------------------------- Local functions ---------------------------- */
 static void 
@@ -167,6 +172,51 @@ setBlockBit(rui8_t *bt, ruint value, ruint to)
     }
 }
 
+static void
+expectSampledBit(RKH_TE_ID_T e)
+{
+    rui8_t bitPos;
+
+    bitPos = (rui8_t)(GETEVT(e) & 7);
+    rkh_bittbl_getBitMask_ExpectAndReturn(bitPos, maptbl[bitPos]);
+}
+
+static void
+expectOneInN(RKH_TE_ID_T e)
+{
+    expectSampledBit(e);
+    rkh_enter_critical_Expect();
+    rkh_exit_critical_Expect();
+}
+
+static void
+expectRate(RKH_TE_ID_T e, RKH_TS_T now)
+{
+    expectSampledBit(e);
+    rkh_enter_critical_Expect();
+    rkh_trc_getts_ExpectAndReturn(now);
+    rkh_exit_critical_Expect();
+}
+
+static void
+sampleEvent(RKH_TE_ID_T e, rui8_t mode, rui16_t value)
+{
+    rkh_enter_critical_Expect();
+    rkh_trc_getts_ExpectAndReturn(TSTAMP_START);
+    expectSampledBit(e);
+    rkh_exit_critical_Expect();
+    rkh_trc_sample_(e, RKH_FALSE, mode, value);
+}
+
+static void
+sampleGroup(RKH_TG_T grp, rui8_t mode, rui16_t value)
+{
+    rkh_enter_critical_Expect();
+    rkh_trc_getts_ExpectAndReturn(TSTAMP_START);
+    rkh_exit_critical_Expect();
+    rkh_trc_sample_(grp, RKH_TRUE, mode, value);
+}
+
 /* It could be added to rkhtrc module */
 static void
 rkh_trc_filterAllOn(rui8_t *ft, RKH_TE_ID_T ftSize)
@@ -200,12 +250,14 @@ setUp(void)
 {
     setUp_toolForTest();
     setUp_filter();
+    setUp_sampler();
 }
 
 void
 tearDown(void)
 {
     tearDown_toolForTest();
+    tearDown_sampler();
     tearDown_filter();
 }
 
@@ -689,6 +741,220 @@ test_outOfBoundsProducesRuntimeErrorSymFil(void)
     rkh_trc_symFil(RKHFilterSma, (filStatus.ao->size * 8) + 1, FILTER_OFF);
 }
 
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+
+/* =========================== Sampler test group ========================== */
+static void
+setUp_sampler(void)
+{
+    Mock_rkhport_Init();
+    Mock_rkhtrc_out_Init();
+}
+
+static void
+tearDown_sampler(void)
+{
+    RKH_TG_T grp;
+
+    Mock_rkhfwk_bittbl_Verify();
+    Mock_rkhport_Verify();
+    Mock_rkhtrc_out_Verify();
+
+    rkh_bittbl_getBitMask_IgnoreAndReturn(0);
+    rkh_enter_critical_Ignore();
+    rkh_exit_critical_Ignore();
+    rkh_trc_sample_(RKH_TE_MP_GET, RKH_FALSE, RKH_TRC_SMPL_NONE, 0);
+    for (grp = 0; grp < RKH_TRC_ALL_GROUPS; ++grp)
+    {
+        rkh_trc_sample_(grp, RKH_TRUE, RKH_TRC_SMPL_NONE, 0);
+    }
+
+    Mock_rkhport_Destroy();
+    Mock_rkhtrc_out_Destroy();
+}
+
+/**
+ *  \addtogroup test_sampler Sampler test group
+ *  @{
+ *  \name Test cases of sampler group
+ *  @{ 
+ */
+void
+test_notSampledEventIsAlwaysEmitted(void)
+{
+    sampleEvent(RKH_TE_MP_GET, RKH_TRC_SMPL_ONE_IN_N, 2);
+
+    expectSampledBit(RKH_TE_MP_PUT);
+    TEST_ASSERT_TRUE(rkh_trc_isSampled_(RKH_TE_MP_PUT) == RKH_TRUE);
+    expectSampledBit(RKH_TE_MP_PUT);
+    TEST_ASSERT_TRUE(rkh_trc_isSampled_(RKH_TE_MP_PUT) == RKH_TRUE);
+}
+
+void
+test_sampleOneInN(void)
+{
+    int i;
+
+    sampleEvent(RKH_TE_MP_GET, RKH_TRC_SMPL_ONE_IN_N, 3);
+
+    for (i = 0; i < 7; ++i)
+    {
+        expectOneInN(RKH_TE_MP_GET);
+        TEST_ASSERT_EQUAL((i % 3) == 0, rkh_trc_isSampled_(RKH_TE_MP_GET));
+    }
+}
+
+void
+test_sampleOneInNWithinCriticalSection(void)
+{
+    sampleEvent(RKH_TE_MP_GET, RKH_TRC_SMPL_ONE_IN_N, 2);
+
+    expectSampledBit(RKH_TE_MP_GET);
+    TEST_ASSERT_TRUE(rkh_trc_isSampledNoCrit_(RKH_TE_MP_GET) == RKH_TRUE);
+    expectSampledBit(RKH_TE_MP_GET);
+    TEST_ASSERT_TRUE(rkh_trc_isSampledNoCrit_(RKH_TE_MP_GET) == RKH_FALSE);
+}
+
+void
+test_rateLimitRefillsEverySecond(void)
+{
+    RKH_TS_T second;
+
+    second = TSTAMP_START + RKH_CFG_TRC_TSTAMP_HZ;
+    sampleEvent(RKH_TE_MP_GET, RKH_TRC_SMPL_RATE, 2);
+
+    expectRate(RKH_TE_MP_GET, TSTAMP_START);
+    TEST_ASSERT_TRUE(rkh_trc_isSampled_(RKH_TE_MP_GET) == RKH_TRUE);
+    expectRate(RKH_TE_MP_GET, TSTAMP_START + 1);
+    TEST_ASSERT_TRUE(rkh_trc_isSampled_(RKH_TE_MP_GET) == RKH_TRUE);
+    expectRate(RKH_TE_MP_GET, TSTAMP_START + 2);
+    TEST_ASSERT_TRUE(rkh_trc_isSampled_(RKH_TE_MP_GET) == RKH_FALSE);
+    expectRate(RKH_TE_MP_GET, second - 1);
+    TEST_ASSERT_TRUE(rkh_trc_isSampled_(RKH_TE_MP_GET) == RKH_FALSE);
+
+    expectRate(RKH_TE_MP_GET, second);
+    TEST_ASSERT_TRUE(rkh_trc_isSampled_(RKH_TE_MP_GET) == RKH_TRUE);
+    expectRate(RKH_TE_MP_GET, second + 1);
+    TEST_ASSERT_TRUE(rkh_trc_isSampled_(RKH_TE_MP_GET) == RKH_TRUE);
+    expectRate(RKH_TE_MP_GET, second + 2);
+    TEST_ASSERT_TRUE(rkh_trc_isSampled_(RKH_TE_MP_GET) == RKH_FALSE);
+}
+
+void
+test_groupSamplerSharesItsCounter(void)
+{
+    sampleGroup(RKH_TG_MP, RKH_TRC_SMPL_ONE_IN_N, 2);
+
+    expectOneInN(RKH_TE_MP_GET);
+    TEST_ASSERT_TRUE(rkh_trc_isSampled_(RKH_TE_MP_GET) == RKH_TRUE);
+    expectOneInN(RKH_TE_MP_PUT);
+    TEST_ASSERT_TRUE(rkh_trc_isSampled_(RKH_TE_MP_PUT) == RKH_FALSE);
+    expectOneInN(RKH_TE_MP_INIT);
+    TEST_ASSERT_TRUE(rkh_trc_isSampled_(RKH_TE_MP_INIT) == RKH_TRUE);
+
+    expectSampledBit(RKH_TE_SM_INIT);
+    TEST_ASSERT_TRUE(rkh_trc_isSampled_(RKH_TE_SM_INIT) == RKH_TRUE);
+}
+
+void
+test_eventSamplerTakesPrecedenceOverItsGroup(void)
+{
+    int i;
+
+    sampleGroup(RKH_TG_MP, RKH_TRC_SMPL_ONE_IN_N, 2);
+    sampleEvent(RKH_TE_MP_GET, RKH_TRC_SMPL_ONE_IN_N, 3);
+
+    for (i = 0; i < 4; ++i)
+    {
+        expectOneInN(RKH_TE_MP_GET);
+        TEST_ASSERT_EQUAL((i % 3) == 0, rkh_trc_isSampled_(RKH_TE_MP_GET));
+    }
+    expectOneInN(RKH_TE_MP_PUT);
+    TEST_ASSERT_TRUE(rkh_trc_isSampled_(RKH_TE_MP_PUT) == RKH_TRUE);
+    expectOneInN(RKH_TE_MP_PUT);
+    TEST_ASSERT_TRUE(rkh_trc_isSampled_(RKH_TE_MP_PUT) == RKH_FALSE);
+}
+
+void
+test_removeEventSampler(void)
+{
+    sampleEvent(RKH_TE_MP_GET, RKH_TRC_SMPL_ONE_IN_N, 2);
+    expectOneInN(RKH_TE_MP_GET);
+    rkh_trc_isSampled_(RKH_TE_MP_GET);
+
+    rkh_enter_critical_Expect();
+    rkh_exit_critical_Expect();
+    rkh_trc_sample_(RKH_TE_MP_GET, RKH_FALSE, RKH_TRC_SMPL_NONE, 0);
+
+    expectSampledBit(RKH_TE_MP_GET);
+    TEST_ASSERT_TRUE(rkh_trc_isSampled_(RKH_TE_MP_GET) == RKH_TRUE);
+    expectSampledBit(RKH_TE_MP_GET);
+    TEST_ASSERT_TRUE(rkh_trc_isSampled_(RKH_TE_MP_GET) == RKH_TRUE);
+}
+
+void
+test_removeEventSamplerFallsBackToItsGroup(void)
+{
+    sampleGroup(RKH_TG_MP, RKH_TRC_SMPL_ONE_IN_N, 2);
+    sampleEvent(RKH_TE_MP_GET, RKH_TRC_SMPL_ONE_IN_N, 3);
+
+    rkh_enter_critical_Expect();
+    rkh_exit_critical_Expect();
+    rkh_trc_sample_(RKH_TE_MP_GET, RKH_FALSE, RKH_TRC_SMPL_NONE, 0);
+
+    expectOneInN(RKH_TE_MP_GET);
+    TEST_ASSERT_TRUE(rkh_trc_isSampled_(RKH_TE_MP_GET) == RKH_TRUE);
+    expectOneInN(RKH_TE_MP_GET);
+    TEST_ASSERT_TRUE(rkh_trc_isSampled_(RKH_TE_MP_GET) == RKH_FALSE);
+}
+
+void
+test_removeGroupSampler(void)
+{
+    sampleGroup(RKH_TG_MP, RKH_TRC_SMPL_ONE_IN_N, 2);
+
+    rkh_enter_critical_Expect();
+    rkh_exit_critical_Expect();
+    rkh_trc_sample_(RKH_TG_MP, RKH_TRUE, RKH_TRC_SMPL_NONE, 0);
+
+    expectSampledBit(RKH_TE_MP_PUT);
+    TEST_ASSERT_TRUE(rkh_trc_isSampled_(RKH_TE_MP_PUT) == RKH_TRUE);
+    expectSampledBit(RKH_TE_MP_PUT);
+    TEST_ASSERT_TRUE(rkh_trc_isSampled_(RKH_TE_MP_PUT) == RKH_TRUE);
+}
+
+void
+test_Fails_InvalidSamplingValue(void)
+{
+    rkh_assert_Expect("rkhtrc_filter", 0);
+    rkh_assert_IgnoreArg_file();
+    rkh_assert_IgnoreArg_line();
+    rkh_assert_StubWithCallback(MockAssertCallback);
+
+    rkh_trc_sample_(RKH_TE_MP_GET, RKH_FALSE, RKH_TRC_SMPL_ONE_IN_N, 0);
+}
+
+void
+test_Fails_TooManySamplers(void)
+{
+    RKH_TG_T grp;
+
+    for (grp = 0; grp < RKH_CFG_TRC_MAX_SAMPLERS; ++grp)
+    {
+        sampleGroup(grp, RKH_TRC_SMPL_ONE_IN_N, 2);
+    }
+
+    rkh_enter_critical_Expect();
+    rkh_exit_critical_Expect();
+    rkh_assert_Expect("rkhtrc_filter", 0);
+    rkh_assert_IgnoreArg_file();
+    rkh_assert_IgnoreArg_line();
+    rkh_assert_StubWithCallback(MockAssertCallback);
+
+    rkh_trc_sample_(grp, RKH_TRUE, RKH_TRC_SMPL_ONE_IN_N, 2);
+}
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
@@ -0,0 +1,263 @@
+/*
+ *  --------------------------------------------------------------------------
+ *
+ *                                Framework RKH
+ *                                -------------
+ *
+ *            State-machine framework for reactive embedded systems
+ *
+ *                      Copyright (C) 2010 Leandro Francucci.
+ *          All rights reserved. Protected by international copyright laws.
+ *
+ *
+ *  RKH is free software: you can redistribute it and/or modify it under the
+ *  terms of the GNU General Public License as published by the Free Software
+ *  Foundation, either version 3 of the License, or (at your option) any
+ *  later version.
+ *
+ *  RKH is distributed in the hope that it will be useful, but WITHOUT ANY
+ *  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with RKH, see copying.txt file.
+ *
+ *  Contact information:
+ *  RKH site: http://vortexmakes.com/que-es/
+ *  RKH GitHub: https://github.com/vortexmakes/RKH
+ *  RKH Sourceforge: https://sourceforge.net/projects/rkh-reactivesys/
+ *  e-mail: lf@vortexmakes.com
+ *  ---------------------------------------------------------------------------
+ */
+
+/**
+ *  \file       test_rkhtrc_filter_fast.c
+ *  \ingroup    test_trace
+ *  \brief      Unit test for the combined filter table of trace events.
+ *
+ *  \addtogroup test
+ *  @{
+ *  \addtogroup test_trace Trace
+ *  @{
+ *  \brief      Unit test for trace module.
+ */
+
+/* -------------------------- Development history -------------------------- */
+/*
+ *  2026.10.19  LeFr  v3.4.00  Initial version
+ */
+
+/* -------------------------------- Authors -------------------------------- */
+/*
+ *  LeFr  Leandro Francucci  lf@vortexmakes.com
+ */
+
+/* --------------------------------- Notes --------------------------------- */
+/*
+ *  This test requires RKH_CFG_TRC_RTFIL_FAST_EN set to RKH_ENABLED, which 
+ *  is defined for this test file only in project.yml. After every change 
+ *  of the filters, rkh_trcEvtFil[], as read by RKH_TRC_EVT_ISOFF(), is 
+ *  compared with rkh_trc_isoff_() for every trace event. Thus, the bit 
+ *  mask table is not mocked but replaced by a fake one.
+ */
+
+/* ----------------------------- Include files ----------------------------- */
+#include "unity.h"
+#include "rkhtrc_filter.h"
+#include "Mock_rkhassert.h"
+
+/* ----------------------------- Local macros ------------------------------ */
+/* ------------------------------- Constants ------------------------------- */
+/* ---------------------------- Local data types --------------------------- */
+/* ---------------------------- Global variables --------------------------- */
+/* ---------------------------- Local variables ---------------------------- */
+static RKH_FilterTbl filStatus;
+
+/* ----------------------- Local function prototypes ----------------------- */
+/* ---------------------------- Local functions ---------------------------- */
+static rbool_t
+isValidEvent(RKH_TE_ID_T e)
+{
+    return (e < RKH_TRC_ALL_EVENTS) && 
+           (GETEVT(e) < (filStatus.grpFilMap[GETGRP(e)].range * 8));
+}
+
+static void
+checkEvtFil(void)
+{
+    RKH_TE_ID_T e;
+
+    for (e = 0; e < RKH_TRC_ALL_EVENTS; ++e)
+    {
+        if (isValidEvent(e))
+        {
+            TEST_ASSERT_EQUAL(rkh_trc_isoff_(e), RKH_TRC_EVT_ISOFF(e));
+        }
+    }
+}
+
+/* ---------------------------- Global functions --------------------------- */
+rui8_t
+rkh_bittbl_getBitMask(rui8_t bitPos)
+{
+    TEST_ASSERT_TRUE(bitPos < 8);
+    return (rui8_t)(1 << bitPos);
+}
+
+void
+setUp(void)
+{
+    Mock_rkhassert_Init();
+    rkh_trc_filter_get(&filStatus);
+    RKH_FILTER_ON_EVENT(RKH_TRC_ALL_EVENTS);
+}
+
+void
+tearDown(void)
+{
+    Mock_rkhassert_Verify();
+    Mock_rkhassert_Destroy();
+}
+
+/**
+ *  \addtogroup test_filter_fast Combined filter table test group
+ *  @{
+ *  \name Test cases of combined filter table group
+ *  @{ 
+ */
+void
+test_AllEventsAreFilteredAfterReset(void)
+{
+    checkEvtFil();
+    TEST_ASSERT_FALSE(RKH_TRC_EVT_ISOFF(RKH_TE_SM_INIT));
+}
+
+void
+test_EmitAndSuppressOneEvent(void)
+{
+    RKH_FILTER_OFF_EVENT(RKH_TE_SM_INIT);
+    checkEvtFil();
+    TEST_ASSERT_TRUE(RKH_TRC_EVT_ISOFF(RKH_TE_SM_INIT));
+    TEST_ASSERT_FALSE(RKH_TRC_EVT_ISOFF(RKH_TE_SM_CLRH));
+
+    RKH_FILTER_OFF_EVENT(RKH_TE_SM_CLRH);
+    RKH_FILTER_ON_EVENT(RKH_TE_SM_INIT);
+    checkEvtFil();
+    TEST_ASSERT_FALSE(RKH_TRC_EVT_ISOFF(RKH_TE_SM_INIT));
+    TEST_ASSERT_TRUE(RKH_TRC_EVT_ISOFF(RKH_TE_SM_CLRH));
+}
+
+void
+test_EmitAndSuppressEveryEvent(void)
+{
+    RKH_TE_ID_T e;
+
+    for (e = 0; e < RKH_TRC_ALL_EVENTS; ++e)
+    {
+        if (isValidEvent(e))
+        {
+            RKH_FILTER_OFF_EVENT(e);
+            checkEvtFil();
+            TEST_ASSERT_TRUE(RKH_TRC_EVT_ISOFF(e));
+        }
+    }
+    for (e = 0; e < RKH_TRC_ALL_EVENTS; ++e)
+    {
+        if (isValidEvent(e))
+        {
+            RKH_FILTER_ON_EVENT(e);
+            checkEvtFil();
+            TEST_ASSERT_FALSE(RKH_TRC_EVT_ISOFF(e));
+        }
+    }
+}
+
+void
+test_SuppressAndEmitGroupKeepsItsEvents(void)
+{
+    RKH_FILTER_OFF_EVENT(RKH_TE_MP_GET);
+    RKH_FILTER_OFF_EVENT(RKH_TE_SM_INIT);
+
+    RKH_FILTER_ON_GROUP(RKH_TG_MP);
+    checkEvtFil();
+    TEST_ASSERT_FALSE(RKH_TRC_EVT_ISOFF(RKH_TE_MP_GET));
+    TEST_ASSERT_TRUE(RKH_TRC_EVT_ISOFF(RKH_TE_SM_INIT));
+
+    RKH_FILTER_OFF_GROUP(RKH_TG_MP);
+    checkEvtFil();
+    TEST_ASSERT_TRUE(RKH_TRC_EVT_ISOFF(RKH_TE_MP_GET));
+    TEST_ASSERT_FALSE(RKH_TRC_EVT_ISOFF(RKH_TE_MP_PUT));
+}
+
+void
+test_EmitAndSuppressEveryGroup(void)
+{
+    RKH_TG_T grp;
+
+    RKH_FILTER_OFF_EVENT(RKH_TRC_ALL_EVENTS);
+    for (grp = 0; grp < RKH_TRC_ALL_GROUPS; ++grp)
+    {
+        RKH_FILTER_ON_GROUP(grp);
+        checkEvtFil();
+    }
+    for (grp = 0; grp < RKH_TRC_ALL_GROUPS; ++grp)
+    {
+        RKH_FILTER_OFF_GROUP(grp);
+        checkEvtFil();
+    }
+}
+
+void
+test_EmitAndSuppressAllEventsOfGroup(void)
+{
+    RKH_FILTER_OFF_GROUP_ALL_EVENTS(RKH_TG_SMA);
+    checkEvtFil();
+    TEST_ASSERT_TRUE(RKH_TRC_EVT_ISOFF(RKH_TE_SMA_FIFO));
+    TEST_ASSERT_FALSE(RKH_TRC_EVT_ISOFF(RKH_TE_SM_INIT));
+
+    RKH_FILTER_ON_EVENT(RKH_TE_SMA_FIFO);
+    checkEvtFil();
+    TEST_ASSERT_FALSE(RKH_TRC_EVT_ISOFF(RKH_TE_SMA_FIFO));
+    TEST_ASSERT_TRUE(RKH_TRC_EVT_ISOFF(RKH_TE_SMA_LIFO));
+
+    RKH_FILTER_ON_GROUP_ALL_EVENTS(RKH_TG_SMA);
+    checkEvtFil();
+    TEST_ASSERT_FALSE(RKH_TRC_EVT_ISOFF(RKH_TE_SMA_LIFO));
+}
+
+void
+test_EmitAndSuppressAllGroups(void)
+{
+    RKH_FILTER_OFF_EVENT(RKH_TE_TMR_START);
+    RKH_FILTER_ON_GROUP(RKH_TRC_ALL_GROUPS);
+    checkEvtFil();
+    TEST_ASSERT_FALSE(RKH_TRC_EVT_ISOFF(RKH_TE_TMR_START));
+
+    RKH_FILTER_OFF_GROUP(RKH_TRC_ALL_GROUPS);
+    checkEvtFil();
+    TEST_ASSERT_TRUE(RKH_TRC_EVT_ISOFF(RKH_TE_TMR_START));
+    TEST_ASSERT_FALSE(RKH_TRC_EVT_ISOFF(RKH_TE_TMR_STOP));
+}
+
+void
+test_EmitAndSuppressAllEvents(void)
+{
+    RKH_FILTER_OFF_EVENT(RKH_TRC_ALL_EVENTS);
+    checkEvtFil();
+    TEST_ASSERT_TRUE(RKH_TRC_EVT_ISOFF(RKH_TE_FWK_OBJ));
+
+    RKH_FILTER_ON_GROUP(RKH_TG_FWK);
+    checkEvtFil();
+    TEST_ASSERT_FALSE(RKH_TRC_EVT_ISOFF(RKH_TE_FWK_OBJ));
+
+    RKH_FILTER_ON_EVENT(RKH_TRC_ALL_EVENTS);
+    checkEvtFil();
+    TEST_ASSERT_FALSE(RKH_TRC_EVT_ISOFF(RKH_TE_UT_IGNORE_ARG));
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/* ------------------------------ End of file ------------------------------ */
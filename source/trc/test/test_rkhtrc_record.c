@@ -484,6 +484,22 @@ test_InsertSmaPostLifoRecord(void)
                     nMin);
 }
 
+void
+test_InsertSmaDeadlineMissRecord(void)
+{
+    RKH_TNT_T lateness = 3;
+
+    rkh_trc_isoff__ExpectAndReturn(RKH_TE_SMA_DLMISS, RKH_TRUE);
+    rkh_trc_symFil_isoff_ExpectAndReturn(RKHFilterSma, RKH_GET_PRIO(&receiver), 
+                                         RKH_TRUE);
+    expectHeader(RKH_TE_SMA_DLMISS, 0, 0x12345678, 0);
+    expectObjectAddress(&receiver);
+    expectU16(lateness);
+    expectTrailer(0);
+
+    RKH_TR_SMA_DLMISS(&receiver, lateness);
+}
+
 void
 test_InsertFwkAeRecord(void)
 {
@@ -0,0 +1,254 @@
+/*
+ *  --------------------------------------------------------------------------
+ *
+ *                                Framework RKH
+ *                                -------------
+ *
+ *            State-machine framework for reactive embedded systems
+ *
+ *                      Copyright (C) 2010 Leandro Francucci.
+ *          All rights reserved. Protected by international copyright laws.
+ *
+ *
+ *  RKH is free software: you can redistribute it and/or modify it under the
+ *  terms of the GNU General Public License as published by the Free Software
+ *  Foundation, either version 3 of the License, or (at your option) any
+ *  later version.
+ *
+ *  RKH is distributed in the hope that it will be useful, but WITHOUT ANY
+ *  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with RKH, see copying.txt file.
+ *
+ *  Contact information:
+ *  RKH site: http://vortexmakes.com/que-es/
+ *  RKH GitHub: https://github.com/vortexmakes/RKH
+ *  RKH Sourceforge: https://sourceforge.net/projects/rkh-reactivesys/
+ *  e-mail: lf@vortexmakes.com
+ *  ---------------------------------------------------------------------------
+ */
+
+
+/**
+ *  \file       test_rkhtrc_ring.c
+ *  \ingroup    test_trace
+ *  \brief      Unit test for trace ring module.
+ *
+ *  \addtogroup test
+ *  @{
+ *  \addtogroup test_trace Trace
+ *  @{
+ *  \brief      Unit test for trace module.
+ */
+
+/* -------------------------- Development history -------------------------- */
+/*
+ *  2026.10.19  LeFr  v3.4.00  Initial version
+ */
+
+/* -------------------------------- Authors -------------------------------- */
+/*
+ *  LeFr  Leandro Francucci  lf@vortexmakes.com
+ */
+
+/* --------------------------------- Notes --------------------------------- */
+/* ----------------------------- Include files ----------------------------- */
+#include "unity.h"
+#include "rkhtrc_ring.h"
+#include "Mock_rkhassert.h"
+
+/* ----------------------------- Local macros ------------------------------ */
+/* ------------------------------- Constants ------------------------------- */
+#define SIZEOF_RING     16u
+
+/* ---------------------------- Local data types --------------------------- */
+/* ---------------------------- Global variables --------------------------- */
+/* ---------------------------- Local variables ---------------------------- */
+static RKHTrcRing ring;
+static rui8_t sto[SIZEOF_RING];
+
+/* ----------------------- Local function prototypes ----------------------- */
+/* ---------------------------- Local functions ---------------------------- */
+static void 
+MockAssertCallback(const char* const file, int line, int cmock_num_calls)
+{
+    TEST_PASS();
+}
+
+static void
+putRecord(rui8_t first, rui8_t len)
+{
+    rkh_trcRing_begin(&ring);
+    for (; len != 0; --len, ++first)
+    {
+        rkh_trcRing_put(&ring, first);
+    }
+}
+
+/* ---------------------------- Global functions --------------------------- */
+void
+setUp(void)
+{
+    Mock_rkhassert_Init();
+    rkh_trcRing_init(&ring, sto, SIZEOF_RING);
+}
+
+void
+tearDown(void)
+{
+    Mock_rkhassert_Verify();
+    Mock_rkhassert_Destroy();
+}
+
+/**
+ *  \addtogroup test_ring Trace ring test group
+ *  @{
+ *  \name Test cases of trace ring group
+ *  @{ 
+ */
+void
+test_EmptyAfterInit(void)
+{
+    rui32_t len;
+
+    TEST_ASSERT_FALSE(rkh_trcRing_peek(&ring, &len));
+    TEST_ASSERT_EQUAL(0, rkh_trcRing_getDropped(&ring));
+}
+
+void
+test_RecordIsHiddenUntilEnd(void)
+{
+    rui32_t len;
+
+    putRecord(1, 3);
+    TEST_ASSERT_FALSE(rkh_trcRing_peek(&ring, &len));
+
+    TEST_ASSERT_TRUE(rkh_trcRing_end(&ring));
+    TEST_ASSERT_TRUE(rkh_trcRing_peek(&ring, &len));
+    TEST_ASSERT_EQUAL(3, len);
+    TEST_ASSERT_EQUAL(1, rkh_trcRing_getByte(&ring, 0));
+    TEST_ASSERT_EQUAL(3, rkh_trcRing_getByte(&ring, 2));
+}
+
+void
+test_PopReleasesTheOldestRecord(void)
+{
+    rui32_t len;
+
+    putRecord(1, 2);
+    rkh_trcRing_end(&ring);
+    putRecord(10, 4);
+    rkh_trcRing_end(&ring);
+
+    rkh_trcRing_pop(&ring);
+    TEST_ASSERT_TRUE(rkh_trcRing_peek(&ring, &len));
+    TEST_ASSERT_EQUAL(4, len);
+    TEST_ASSERT_EQUAL(10, rkh_trcRing_getByte(&ring, 0));
+
+    rkh_trcRing_pop(&ring);
+    TEST_ASSERT_FALSE(rkh_trcRing_peek(&ring, &len));
+}
+
+void
+test_RecordWrapsAround(void)
+{
+    rui32_t len;
+
+    putRecord(0, 8);
+    rkh_trcRing_end(&ring);
+    rkh_trcRing_pop(&ring);
+
+    putRecord(20, 10);
+    TEST_ASSERT_TRUE(rkh_trcRing_end(&ring));
+    TEST_ASSERT_TRUE(rkh_trcRing_peek(&ring, &len));
+    TEST_ASSERT_EQUAL(10, len);
+    TEST_ASSERT_EQUAL(20, rkh_trcRing_getByte(&ring, 0));
+    TEST_ASSERT_EQUAL(29, rkh_trcRing_getByte(&ring, 9));
+}
+
+void
+test_DiscardsARecordThatDoesNotFit(void)
+{
+    rui32_t len;
+
+    putRecord(1, 8);
+    rkh_trcRing_end(&ring);
+
+    putRecord(20, 8);
+    TEST_ASSERT_FALSE(rkh_trcRing_end(&ring));
+    TEST_ASSERT_EQUAL(1, rkh_trcRing_getDropped(&ring));
+
+    rkh_trcRing_pop(&ring);
+    TEST_ASSERT_FALSE(rkh_trcRing_peek(&ring, &len));
+}
+
+void
+test_FreedSpaceIsReused(void)
+{
+    rui32_t len;
+
+    putRecord(1, 12);
+    rkh_trcRing_end(&ring);
+    rkh_trcRing_pop(&ring);
+
+    putRecord(30, 14);
+    TEST_ASSERT_TRUE(rkh_trcRing_end(&ring));
+    TEST_ASSERT_TRUE(rkh_trcRing_peek(&ring, &len));
+    TEST_ASSERT_EQUAL(14, len);
+    TEST_ASSERT_EQUAL(43, rkh_trcRing_getByte(&ring, 13));
+}
+
+void
+test_WritesAWholeRecordAtOnce(void)
+{
+    rui8_t rec[] = {5, 6, 7};
+    rui32_t len;
+
+    TEST_ASSERT_TRUE(rkh_trcRing_write(&ring, rec, sizeof(rec)));
+    TEST_ASSERT_TRUE(rkh_trcRing_peek(&ring, &len));
+    TEST_ASSERT_EQUAL(3, len);
+    TEST_ASSERT_EQUAL(5, rkh_trcRing_getByte(&ring, 0));
+    TEST_ASSERT_EQUAL(7, rkh_trcRing_getByte(&ring, 2));
+
+    TEST_ASSERT_FALSE(rkh_trcRing_write(&ring, sto, SIZEOF_RING));
+    TEST_ASSERT_EQUAL(1, rkh_trcRing_getDropped(&ring));
+}
+
+void
+test_PutsABlockIntoARecord(void)
+{
+    rui8_t blk[] = {40, 41, 42, 43};
+    rui32_t len;
+
+    putRecord(0, 8);
+    rkh_trcRing_end(&ring);
+    rkh_trcRing_pop(&ring);
+
+    putRecord(1, 1);
+    rkh_trcRing_putBlock(&ring, blk, sizeof(blk));
+    TEST_ASSERT_TRUE(rkh_trcRing_end(&ring));
+    TEST_ASSERT_TRUE(rkh_trcRing_peek(&ring, &len));
+    TEST_ASSERT_EQUAL(5, len);
+    TEST_ASSERT_EQUAL(1, rkh_trcRing_getByte(&ring, 0));
+    TEST_ASSERT_EQUAL(43, rkh_trcRing_getByte(&ring, 4));
+}
+
+void
+test_Fails_InitWithSizeNotPowerOfTwo(void)
+{
+    rkh_assert_Expect("rkhtrc_ring", 0);
+    rkh_assert_IgnoreArg_line();
+    rkh_assert_StubWithCallback(MockAssertCallback);
+
+    rkh_trcRing_init(&ring, sto, SIZEOF_RING - 1);
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+
+/* ------------------------------ End of file ------------------------------ */
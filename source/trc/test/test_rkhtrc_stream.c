@@ -381,6 +381,129 @@ test_GetManyElemsMoreThanStoredWrapAroundUsingWholeBlock(void)
     TEST_ASSERT_EQUAL(0xaa, block[RKH_CFG_TRC_SIZEOF_STREAM + 1]);
 }
 
+void
+test_PutBlockAsManyBytes(void)
+{
+    rui8_t data[] = {1, 2, 3, 4, 5};
+    TRCQTY_T nData;
+    rui8_t *output;
+
+    rkh_trc_get();
+    rkh_trc_putBlock(data, sizeof(data));
+
+    nData = RKH_CFG_TRC_SIZEOF_STREAM;
+    output = rkh_trc_get_block(&nData);
+    TEST_ASSERT_EQUAL(sizeof(data), nData);
+    TEST_ASSERT_EQUAL_MEMORY(data, output, sizeof(data));
+}
+
+void
+test_PutBlockWrapAround(void)
+{
+    rui8_t data[] = {1, 2, 3, 4, 5};
+    rui8_t i;
+
+    memset(block, 0, sizeof(block));
+    rkh_trc_get();
+    for (i = 0; i < (RKH_CFG_TRC_SIZEOF_STREAM - 2); ++i)
+    {
+        rkh_trc_put(i);
+    }
+    for (i = 0; i < (RKH_CFG_TRC_SIZEOF_STREAM - 2); ++i)
+    {
+        rkh_trc_get();
+    }
+
+    rkh_trc_putBlock(data, sizeof(data));
+
+    TEST_ASSERT_EQUAL(sizeof(data), 
+                      rkh_trc_getWholeBlock(block, sizeof(block)));
+    TEST_ASSERT_EQUAL_MEMORY(data, block, sizeof(data));
+}
+
+void
+test_PutBlockOverwritesTheOldestBytes(void)
+{
+    rui8_t data[RKH_CFG_TRC_SIZEOF_STREAM];
+    TRCQTY_T i;
+
+    memset(block, 0, sizeof(block));
+    rkh_trc_get();
+    rkh_trc_put(0xaa);
+    for (i = 0; i < RKH_CFG_TRC_SIZEOF_STREAM; ++i)
+    {
+        data[i] = (rui8_t)i;
+    }
+
+    rkh_trc_putBlock(data, RKH_CFG_TRC_SIZEOF_STREAM);
+
+    TEST_ASSERT_EQUAL(RKH_CFG_TRC_SIZEOF_STREAM, 
+                      rkh_trc_getWholeBlock(block, sizeof(block)));
+    TEST_ASSERT_EQUAL_MEMORY(data, block, RKH_CFG_TRC_SIZEOF_STREAM);
+}
+
+void
+test_ReserveAndCommitAWholeRecord(void)
+{
+    rui8_t data[] = {1, 2, 3, RKH_FLG};
+    rui8_t *p;
+
+    memset(block, 0, sizeof(block));
+    rkh_trc_get();
+
+    p = rkh_trc_reserve(8);
+    TEST_ASSERT_NOT_NULL(p);
+    memcpy(p, data, sizeof(data));
+    rkh_trc_commit(sizeof(data));
+
+    TEST_ASSERT_EQUAL(sizeof(data), 
+                      rkh_trc_getWholeBlock(block, sizeof(block)));
+    TEST_ASSERT_EQUAL_MEMORY(data, block, sizeof(data));
+}
+
+void
+test_ReserveFailsInsteadOfOverwriting(void)
+{
+    rui8_t data[RKH_CFG_TRC_SIZEOF_STREAM - 4];
+
+    memset(data, 0x55, sizeof(data));
+    rkh_trc_putBlock(data, sizeof(data));   /* after the initial flag */
+
+    TEST_ASSERT_NULL(rkh_trc_reserve(4));
+    TEST_ASSERT_NOT_NULL(rkh_trc_reserve(3));
+    TEST_ASSERT_FALSE(rkh_trc_append(data, 4));
+    TEST_ASSERT_TRUE(rkh_trc_append(data, 3));
+}
+
+void
+test_ReserveFillsTheEndWithFlags(void)
+{
+    rui8_t data[] = {1, 2, 3, 4, 5};
+    rui8_t i;
+    rui8_t *p;
+
+    memset(block, 0, sizeof(block));
+    rkh_trc_get();
+    for (i = 0; i < (RKH_CFG_TRC_SIZEOF_STREAM - 2); ++i)
+    {
+        rkh_trc_put(i);
+    }
+    for (i = 0; i < (RKH_CFG_TRC_SIZEOF_STREAM - 2); ++i)
+    {
+        rkh_trc_get();
+    }
+
+    p = rkh_trc_reserve(sizeof(data));
+    TEST_ASSERT_NOT_NULL(p);
+    memcpy(p, data, sizeof(data));
+    rkh_trc_commit(sizeof(data));
+
+    TEST_ASSERT_EQUAL(sizeof(data) + 1, 
+                      rkh_trc_getWholeBlock(block, sizeof(block)));
+    TEST_ASSERT_EQUAL(RKH_FLG, block[0]);
+    TEST_ASSERT_EQUAL_MEMORY(data, &block[1], sizeof(data));
+}
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
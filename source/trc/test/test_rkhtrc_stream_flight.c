@@ -0,0 +1,275 @@
+/*
+ *  --------------------------------------------------------------------------
+ *
+ *                                Framework RKH
+ *                                -------------
+ *
+ *            State-machine framework for reactive embedded systems
+ *
+ *                      Copyright (C) 2010 Leandro Francucci.
+ *          All rights reserved. Protected by international copyright laws.
+ *
+ *
+ *  RKH is free software: you can redistribute it and/or modify it under the
+ *  terms of the GNU General Public License as published by the Free Software
+ *  Foundation, either version 3 of the License, or (at your option) any
+ *  later version.
+ *
+ *  RKH is distributed in the hope that it will be useful, but WITHOUT ANY
+ *  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with RKH, see copying.txt file.
+ *
+ *  Contact information:
+ *  RKH site: http://vortexmakes.com/que-es/
+ *  RKH GitHub: https://github.com/vortexmakes/RKH
+ *  RKH Sourceforge: https://sourceforge.net/projects/rkh-reactivesys/
+ *  e-mail: lf@vortexmakes.com
+ *  ---------------------------------------------------------------------------
+ */
+
+/**
+ *  \file       test_rkhtrc_stream_flight.c
+ *  \ingroup    test_trace
+ *  \brief      Unit test for the trace stream as a flight recorder.
+ *
+ *  \addtogroup test
+ *  @{
+ *  \addtogroup test_trace Trace
+ *  @{
+ *  \brief      Unit test for trace module.
+ */
+
+/* -------------------------- Development history -------------------------- */
+/*
+ *  2026.10.19  LeFr  v3.4.00  Initial version
+ */
+
+/* -------------------------------- Authors -------------------------------- */
+/*
+ *  LeFr  Leandro Francucci  lf@vortexmakes.com
+ */
+
+/* --------------------------------- Notes --------------------------------- */
+/*
+ *  This test requires RKH_CFG_TRC_FLIGHT_EN set to RKH_ENABLED, which is
+ *  defined for this test file only in project.yml. The trace records are 
+ *  built by the record module, so that the trigger event is exercised as 
+ *  the framework does.
+ */
+
+/* ----------------------------- Include files ----------------------------- */
+#include <string.h>
+#include "unity.h"
+#include "rkhtrc_stream.h"
+#include "rkhtrc_record.h"
+#include "Mock_rkhsm.h"
+#include "Mock_rkhsma.h"
+#include "Mock_rkhport.h"
+#include "Mock_rkhtrc_out.h"
+
+/* ----------------------------- Local macros ------------------------------ */
+/* ------------------------------- Constants ------------------------------- */
+#define STREAM_SIZE     RKH_CFG_TRC_SIZEOF_STREAM
+
+/* ---------------------------- Local data types --------------------------- */
+/* ---------------------------- Global variables --------------------------- */
+/* ---------------------------- Local variables ---------------------------- */
+static rui8_t block[STREAM_SIZE + 8];
+
+/* ----------------------- Local function prototypes ----------------------- */
+/* ---------------------------- Local functions ---------------------------- */
+static void
+putSequence(rui8_t from, int nBytes)
+{
+    for (; nBytes != 0; --nBytes, ++from)
+    {
+        rkh_trc_put(from);
+    }
+}
+
+static void
+putRecord(RKH_TE_ID_T eid)
+{
+    rkh_trc_begin(eid);
+    rkh_trc_u8(0x55);
+    rkh_trc_end();
+}
+
+static TRCQTY_T
+dump(void)
+{
+    return rkh_trc_getWholeBlock(block, sizeof(block));
+}
+
+/* ---------------------------- Global functions --------------------------- */
+void
+setUp(void)
+{
+    Mock_rkhport_Init();
+    Mock_rkhtrc_out_Init();
+
+    rkh_enter_critical_Ignore();
+    rkh_exit_critical_Ignore();
+    rkh_trc_getts_IgnoreAndReturn(0);
+    rkh_trc_init();
+}
+
+void
+tearDown(void)
+{
+    rkh_trc_clearTrigger();
+    Mock_rkhport_Verify();
+    Mock_rkhtrc_out_Verify();
+    Mock_rkhport_Destroy();
+    Mock_rkhtrc_out_Destroy();
+}
+
+/**
+ *  \addtogroup test_stream_flight Flight recorder test group
+ *  @{
+ *  \name Test cases of flight recorder group
+ *  @{ 
+ */
+void
+test_GettersRetrieveNothingWhileRecording(void)
+{
+    TRCQTY_T nData;
+
+    putSequence(1, 8);
+
+    TEST_ASSERT_FALSE(rkh_trc_isFrozen());
+    TEST_ASSERT_NULL(rkh_trc_get());
+    nData = STREAM_SIZE;
+    TEST_ASSERT_NULL(rkh_trc_get_block(&nData));
+    TEST_ASSERT_EQUAL(0, nData);
+    TEST_ASSERT_EQUAL(0, dump());
+}
+
+void
+test_FreezeByApi(void)
+{
+    rui8_t *output;
+
+    putSequence(1, 3);
+
+    rkh_trc_freeze();
+
+    TEST_ASSERT_TRUE(rkh_trc_isFrozen());
+    output = rkh_trc_get();
+    TEST_ASSERT_NOT_NULL(output);
+    TEST_ASSERT_EQUAL(RKH_FLG, *output);
+    TEST_ASSERT_EQUAL(3, dump());
+    TEST_ASSERT_EQUAL(1, block[0]);
+    TEST_ASSERT_EQUAL(3, block[2]);
+}
+
+void
+test_FreezeByTriggerEvent(void)
+{
+    TRCQTY_T nData;
+    int i;
+
+    rkh_trc_setTrigger(RKH_TE_SMA_FIFO);
+    putRecord(RKH_TE_SMA_ACT);
+    TEST_ASSERT_FALSE(rkh_trc_isFrozen());
+
+    putRecord(RKH_TE_SMA_FIFO);
+
+    TEST_ASSERT_TRUE(rkh_trc_isFrozen());
+    nData = dump();
+    TEST_ASSERT_TRUE(nData > 2);
+    TEST_ASSERT_EQUAL(RKH_FLG, block[0]);
+    TEST_ASSERT_EQUAL(RKH_TE_SMA_ACT, block[1]);
+    TEST_ASSERT_EQUAL(RKH_FLG, block[nData - 1]);
+    for (i = nData - 2; block[i] != RKH_FLG; --i)
+    {
+    }
+    TEST_ASSERT_EQUAL(RKH_TE_SMA_FIFO, block[i + 1]);
+}
+
+void
+test_ClearedTriggerDoesNotFreeze(void)
+{
+    rkh_trc_setTrigger(RKH_TE_SMA_FIFO);
+    rkh_trc_clearTrigger();
+
+    putRecord(RKH_TE_SMA_FIFO);
+
+    TEST_ASSERT_FALSE(rkh_trc_isFrozen());
+}
+
+void
+test_DumpStartsAtFlagAfterWraparound(void)
+{
+    putSequence(1, STREAM_SIZE + 8);    /* overwrites the initial flag */
+    rkh_trc_put(RKH_FLG);
+    putSequence(0x30, 4);
+
+    rkh_trc_freeze();
+
+    TEST_ASSERT_EQUAL(5, dump());
+    TEST_ASSERT_EQUAL(RKH_FLG, block[0]);
+    TEST_ASSERT_EQUAL(0x30, block[1]);
+    TEST_ASSERT_EQUAL(0x33, block[4]);
+}
+
+void
+test_DumpStartsAtOldestWholeRecordAfterWraparound(void)
+{
+    TRCQTY_T nData;
+    int i;
+
+    for (i = 0; i < STREAM_SIZE; ++i)
+    {
+        putRecord(RKH_TE_SMA_ACT);
+    }
+    rkh_trc_setTrigger(RKH_TE_SMA_FIFO);
+    putRecord(RKH_TE_SMA_FIFO);
+
+    nData = dump();
+    TEST_ASSERT_TRUE(nData < STREAM_SIZE);
+    TEST_ASSERT_EQUAL(RKH_FLG, block[0]);
+    TEST_ASSERT_EQUAL(RKH_TE_SMA_ACT, block[1]);
+    TEST_ASSERT_EQUAL(RKH_FLG, block[nData - 1]);
+}
+
+void
+test_PutsAreDiscardedWhileFrozen(void)
+{
+    const rui8_t blk[] = {1, 2, 3};
+
+    rkh_trc_freeze();
+    rkh_trc_put(0x30);
+    rkh_trc_putBlock(blk, sizeof(blk));
+    putRecord(RKH_TE_SMA_ACT);
+
+    TEST_ASSERT_EQUAL(1, dump());
+    TEST_ASSERT_EQUAL(RKH_FLG, block[0]);
+}
+
+void
+test_UnfreezeRestartsRecording(void)
+{
+    putSequence(1, 8);
+    rkh_trc_freeze();
+
+    rkh_trc_unfreeze();
+
+    TEST_ASSERT_FALSE(rkh_trc_isFrozen());
+    TEST_ASSERT_NULL(rkh_trc_get());
+    rkh_trc_put(0x30);
+    rkh_trc_freeze();
+    TEST_ASSERT_EQUAL(2, dump());
+    TEST_ASSERT_EQUAL(RKH_FLG, block[0]);
+    TEST_ASSERT_EQUAL(0x30, block[1]);
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/* ------------------------------ End of file ------------------------------ */
@@ -0,0 +1,235 @@
+/*
+ *  --------------------------------------------------------------------------
+ *
+ *                                Framework RKH
+ *                                -------------
+ *
+ *            State-machine framework for reactive embedded systems
+ *
+ *                      Copyright (C) 2010 Leandro Francucci.
+ *          All rights reserved. Protected by international copyright laws.
+ *
+ *
+ *  RKH is free software: you can redistribute it and/or modify it under the
+ *  terms of the GNU General Public License as published by the Free Software
+ *  Foundation, either version 3 of the License, or (at your option) any
+ *  later version.
+ *
+ *  RKH is distributed in the hope that it will be useful, but WITHOUT ANY
+ *  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with RKH, see copying.txt file.
+ *
+ *  Contact information:
+ *  RKH site: http://vortexmakes.com/que-es/
+ *  RKH GitHub: https://github.com/vortexmakes/RKH
+ *  RKH Sourceforge: https://sourceforge.net/projects/rkh-reactivesys/
+ *  e-mail: lf@vortexmakes.com
+ *  ---------------------------------------------------------------------------
+ */
+
+/**
+ *  \file       test_rkhtrc_stream_shared.c
+ *  \ingroup    test_trace
+ *  \brief      Unit test for the shared trace stream.
+ *
+ *  \addtogroup test
+ *  @{
+ *  \addtogroup test_trace Trace
+ *  @{
+ *  \brief      Unit test for trace module.
+ */
+
+/* -------------------------- Development history -------------------------- */
+/*
+ *  2026.10.19  LeFr  v3.4.00  Initial version
+ */
+
+/* -------------------------------- Authors -------------------------------- */
+/*
+ *  LeFr  Leandro Francucci  lf@vortexmakes.com
+ */
+
+/* --------------------------------- Notes --------------------------------- */
+/*
+ *  This test requires RKH_CFG_TRC_SHARED_EN set to RKH_ENABLED, which is
+ *  defined for this test file only in project.yml. The stream is attached 
+ *  to a local area, so that its header is inspected as an external reader 
+ *  does.
+ */
+
+/* ----------------------------- Include files ----------------------------- */
+#include <string.h>
+#include "unity.h"
+#include "rkhtrc_stream.h"
+#include "Mock_rkhsm.h"
+#include "Mock_rkhsma.h"
+
+/* ----------------------------- Local macros ------------------------------ */
+/* ------------------------------- Constants ------------------------------- */
+#define STREAM_SIZE     RKH_CFG_TRC_SIZEOF_STREAM
+
+/* ---------------------------- Local data types --------------------------- */
+/* ---------------------------- Global variables --------------------------- */
+/* ---------------------------- Local variables ---------------------------- */
+static rui32_t areaSto[(RKH_TRC_SIZEOF_SHARED + 3) / 4];
+static RKHTrcShared *const area = (RKHTrcShared *)areaSto;
+static rui8_t block[STREAM_SIZE + 8];
+
+/* ----------------------- Local function prototypes ----------------------- */
+/* ---------------------------- Local functions ---------------------------- */
+static void
+putSequence(rui8_t from, int nBytes)
+{
+    for (; nBytes != 0; --nBytes, ++from)
+    {
+        rkh_trc_put(from);
+    }
+}
+
+/* ---------------------------- Global functions --------------------------- */
+void
+setUp(void)
+{
+    rkh_trcStream_attach(area);
+    rkh_trcStream_init();
+}
+
+void
+tearDown(void)
+{
+    rkh_trcStream_attach((RKHTrcShared *)0);
+}
+
+/**
+ *  \addtogroup test_stream_shared Shared trace stream test group
+ *  @{
+ *  \name Test cases of shared trace stream group
+ *  @{ 
+ */
+void
+test_InitSharedArea(void)
+{
+    TEST_ASSERT_EQUAL_HEX32(RKH_TRC_SHARED_MAGIC, area->magic);
+    TEST_ASSERT_EQUAL(STREAM_SIZE, area->size);
+    TEST_ASSERT_EQUAL(1, area->head);
+    TEST_ASSERT_EQUAL(1, area->next);
+    TEST_ASSERT_EQUAL(0, area->tail);
+    TEST_ASSERT_EQUAL(RKH_FLG, RKH_TRC_SHARED_STO(area)[0]);
+}
+
+void
+test_PublishHeadAndNextAfterPut(void)
+{
+    rui8_t *output;
+
+    putSequence(1, 3);
+
+    TEST_ASSERT_EQUAL(4, area->head);
+    TEST_ASSERT_EQUAL(4, area->next);
+    output = rkh_trc_get();
+    TEST_ASSERT_NOT_NULL(output);
+    TEST_ASSERT_EQUAL(RKH_FLG, *output);
+    TEST_ASSERT_EQUAL(1, area->tail);
+}
+
+void
+test_OverwriteOldestBytesOfLaggingTail(void)
+{
+    TRCQTY_T nData;
+    int i;
+
+    rkh_trc_get();                          /* removes RKH_FLG */
+    putSequence(0, 4);
+    rkh_trc_get();                          /* the tail lags behind */
+    putSequence(4, STREAM_SIZE + 8);
+
+    TEST_ASSERT_EQUAL(STREAM_SIZE + 13, area->head);
+    TEST_ASSERT_EQUAL(2, area->tail);
+
+    nData = rkh_trc_getWholeBlock(block, sizeof(block));
+
+    TEST_ASSERT_EQUAL(STREAM_SIZE, nData);
+    for (i = 0; i < STREAM_SIZE; ++i)
+    {
+        TEST_ASSERT_EQUAL(i + 12, block[i]);
+    }
+    TEST_ASSERT_EQUAL(area->head, area->tail);
+    rkh_trc_get_block(&nData);
+    TEST_ASSERT_EQUAL(0, nData);
+}
+
+void
+test_LaggingTailSkipsToOldestByteOnGet(void)
+{
+    rui8_t *output;
+
+    putSequence(0, STREAM_SIZE + 1);        /* overwrites RKH_FLG and 0 */
+
+    output = rkh_trc_get();
+
+    TEST_ASSERT_NOT_NULL(output);
+    TEST_ASSERT_EQUAL(1, *output);
+    TEST_ASSERT_EQUAL(3, area->tail);
+}
+
+void
+test_DetectLappedReadThroughNext(void)
+{
+    rui32_t tail;
+    rui8_t byte;
+
+    tail = area->tail;                      /* reader snapshot */
+    byte = RKH_TRC_SHARED_STO(area)[tail % STREAM_SIZE];
+    putSequence(0, STREAM_SIZE - 1);
+
+    TEST_ASSERT_EQUAL(STREAM_SIZE, area->next);
+    TEST_ASSERT_TRUE((area->next - tail) <= area->size);    /* intact */
+    TEST_ASSERT_EQUAL(byte, RKH_TRC_SHARED_STO(area)[tail % STREAM_SIZE]);
+
+    rkh_trc_put(0xaa);
+
+    TEST_ASSERT_EQUAL(STREAM_SIZE + 1, area->next);
+    TEST_ASSERT_TRUE((area->next - tail) > area->size);     /* lapped */
+    TEST_ASSERT_EQUAL(0xaa, RKH_TRC_SHARED_STO(area)[tail % STREAM_SIZE]);
+}
+
+void
+test_DetectLappedReadThroughNextOfBlock(void)
+{
+    rui32_t tail;
+
+    putSequence(0, 8);
+    tail = area->tail;
+    memset(block, 0x55, sizeof(block));
+
+    rkh_trc_putBlock(block, STREAM_SIZE - 9);
+
+    TEST_ASSERT_TRUE((area->next - tail) <= area->size);
+
+    rkh_trc_putBlock(block, 1);
+
+    TEST_ASSERT_TRUE((area->next - tail) > area->size);
+}
+
+void
+test_AttachedAreaKeepsInternalStreamApart(void)
+{
+    rkh_trcStream_attach((RKHTrcShared *)0);
+    rkh_trcStream_init();
+    putSequence(0, 4);
+
+    TEST_ASSERT_EQUAL(1, area->head);
+    rkh_trcStream_attach(area);
+    TEST_ASSERT_EQUAL(RKH_FLG, *rkh_trc_get());
+    TEST_ASSERT_NULL(rkh_trc_get());
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/* ------------------------------ End of file ------------------------------ */
@@ -0,0 +1,260 @@
+/*
+ *  --------------------------------------------------------------------------
+ *
+ *                                Framework RKH
+ *                                -------------
+ *
+ *            State-machine framework for reactive embedded systems
+ *
+ *                      Copyright (C) 2010 Leandro Francucci.
+ *          All rights reserved. Protected by international copyright laws.
+ *
+ *
+ *  RKH is free software: you can redistribute it and/or modify it under the
+ *  terms of the GNU General Public License as published by the Free Software
+ *  Foundation, either version 3 of the License, or (at your option) any
+ *  later version.
+ *
+ *  RKH is distributed in the hope that it will be useful, but WITHOUT ANY
+ *  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with RKH, see copying.txt file.
+ *
+ *  Contact information:
+ *  RKH site: http://vortexmakes.com/que-es/
+ *  RKH GitHub: https://github.com/vortexmakes/RKH
+ *  RKH Sourceforge: https://sourceforge.net/projects/rkh-reactivesys/
+ *  e-mail: lf@vortexmakes.com
+ *  ---------------------------------------------------------------------------
+ */
+
+/**
+ *  \file       main.c
+ *  \brief      Offline trace analyzer.
+ */
+
+/* -------------------------- Development history -------------------------- */
+/*
+ *  2026.10.19  LeFr  v3.4.00  Initial version
+ */
+
+/* -------------------------------- Authors -------------------------------- */
+/*
+ *  LeFr  Leandro Francucci  lf@vortexmakes.com
+ */
+
+/* --------------------------------- Notes --------------------------------- */
+/*
+ *  Usage: rkhtrcan [-f json|csv] [-r all|ao|latency|queue|pool] [-m] 
+ *                  [-o output] [trace]
+ *
+ *  The trace is a binary file written by trace_io, i.e. the "-f" option 
+ *  of the demo applications, or the standard input. With "-m", it is a 
+ *  trace stream mapped by rkhport_trc_map(), which is read in place.
+ */
+
+/* ----------------------------- Include files ----------------------------- */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "rkh.h"
+#include "rkhtrc_decode.h"
+#include "rkhport_trc.h"
+#include "getopt.h"
+#include "trcan.h"
+
+/* ----------------------------- Local macros ------------------------------ */
+/* ------------------------------- Constants ------------------------------- */
+#define SIZEOF_BLOCK        4096u
+
+/* ---------------------------- Local data types --------------------------- */
+/* ---------------------------- Global variables --------------------------- */
+/* ---------------------------- Local variables ---------------------------- */
+static const char *helpMessage =
+{
+    "\nUsage: rkhtrcan [options] [trace]\n"
+    "\t -f Output format: json (default) or csv\n"
+    "\t -r Report: all (default), ao, latency, queue or pool\n"
+    "\t -m The trace is a memory-mapped trace stream\n"
+    "\t -o Output file name, standard output by default\n"
+    "\t -h (help)\n"
+};
+
+static RKHTrcDec dec;
+static rui32_t nLost;
+
+/* ----------------------- Local function prototypes ----------------------- */
+/* ---------------------------- Local functions ---------------------------- */
+static void
+putBlock(const rui8_t *blk, rui32_t n)
+{
+    const RKHTrcDecRecord *rec;
+
+    for (; n != 0; --n, ++blk)
+    {
+        rec = rkh_trcDec_put(&dec, *blk);
+        if (rec == (const RKHTrcDecRecord *)0)
+        {
+            continue;
+        }
+        if (rkh_trcDec_getLost(&dec) != nLost)
+        {
+            nLost = rkh_trcDec_getLost(&dec);
+            trcan_resync();
+        }
+        trcan_put(rec, rkh_trcDec_getCfg(&dec));
+    }
+}
+
+static int
+readFile(const char *path)
+{
+    FILE *in;
+    rui8_t blk[SIZEOF_BLOCK];
+    size_t n;
+
+    in = (path == NULL) ? stdin : fopen(path, "rb");
+    if (in == NULL)
+    {
+        fprintf(stderr, "Can't open trace file %s\n", path);
+        return -1;
+    }
+    while ((n = fread(blk, 1, sizeof(blk), in)) != 0)
+    {
+        putBlock(blk, (rui32_t)n);
+    }
+    if (in != stdin)
+    {
+        fclose(in);
+    }
+    return 0;
+}
+
+static int
+readMapped(const char *path)
+{
+    RKHTrcReader reader;
+    const rui8_t *blk;
+    rui32_t n;
+
+    if ((path == NULL) || (rkhport_trc_reader_open(&reader, path) != 0))
+    {
+        fprintf(stderr, "Can't open trace stream %s\n", 
+                (path == NULL) ? "" : path);
+        return -1;
+    }
+    while (((blk = rkhport_trc_reader_peek(&reader, &n)) != NULL) && 
+           (n != 0))
+    {
+        putBlock(blk, n);
+        if (!rkhport_trc_reader_release(&reader, n))
+        {
+            trcan_resync();     /* the writer lapped the reader */
+        }
+    }
+    rkhport_trc_reader_close(&reader);
+    return 0;
+}
+
+/* ---------------------------- Global functions --------------------------- */
+void
+rkh_assert(RKHROM char * const file, int line)
+{
+    fprintf(stderr, "RKH_ASSERT: [%d] line from %s file\n", line, file);
+    exit(EXIT_FAILURE);
+}
+
+int
+main(int argc, char *argv[])
+{
+    static const char *reports[] = 
+    {
+        "all", "ao", "latency", "queue", "pool"
+    };
+    TrcAnFormat format = TRCAN_JSON;
+    TrcAnReport report = TRCAN_ALL;
+    rbool_t isMapped = RKH_FALSE;
+    const char *outName = NULL, *path;
+    FILE *out = stdout;
+    int c, i, result;
+
+    while ((c = getopt(argc, argv, (char *)"f:r:o:mh")) != EOF)
+    {
+        switch (c)
+        {
+            case 'f':
+                if (strcmp(optarg, "csv") == 0)
+                {
+                    format = TRCAN_CSV;
+                }
+                else if (strcmp(optarg, "json") != 0)
+                {
+                    fprintf(stderr, "Unknown format %s\n", optarg);
+                    return EXIT_FAILURE;
+                }
+                break;
+
+            case 'r':
+                for (i = 0; i < (int)(sizeof(reports) / sizeof(reports[0])); 
+                     ++i)
+                {
+                    if (strcmp(optarg, reports[i]) == 0)
+                    {
+                        break;
+                    }
+                }
+                if (i == (int)(sizeof(reports) / sizeof(reports[0])))
+                {
+                    fprintf(stderr, "Unknown report %s\n", optarg);
+                    return EXIT_FAILURE;
+                }
+                report = (TrcAnReport)i;
+                break;
+
+            case 'o':
+                outName = optarg;
+                break;
+
+            case 'm':
+                isMapped = RKH_TRUE;
+                break;
+
+            case '?':
+            case 'h':
+            default:
+                printf("%s", helpMessage);
+                return (c == 'h') ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+    path = (optind < argc) ? argv[optind] : NULL;
+
+    rkh_trcDec_init(&dec, NULL);
+    trcan_init();
+    nLost = 0;
+    result = isMapped ? readMapped(path) : readFile(path);
+    if (result == 0)
+    {
+        if ((outName != NULL) && ((out = fopen(outName, "w")) == NULL))
+        {
+            fprintf(stderr, "Can't open output file %s\n", outName);
+            result = -1;
+        }
+        else
+        {
+            trcan_setDecStats(rkh_trcDec_getErrors(&dec), 
+                              rkh_trcDec_getLost(&dec));
+            trcan_print(out, format, report);
+            if (out != stdout)
+            {
+                fclose(out);
+            }
+        }
+    }
+    trcan_deinit();
+    return (result == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* ------------------------------ End of file ------------------------------ */
@@ -0,0 +1,112 @@
+/**
+ *  \file       rkhcfg.h
+ *  \brief      RKH configuration of the trace analyzer. The decoder takes 
+ *              the trace options of the target from its RKH_TE_FWK_TCFG 
+ *              record, hence only the trace options used by the reader of 
+ *              a memory-mapped trace stream and the default layout of the 
+ *              decoder are relevant. The remaining options are required by 
+ *              rkhitl.h and are set to their minimal values.
+ */
+
+#ifndef __RKHCFG_H__
+#define __RKHCFG_H__
+
+#include "rkhdef.h"
+
+/* --- Trace options ------------------------------------------------------ */
+#define RKH_CFG_TRC_EN                  RKH_ENABLED
+#define RKH_CFG_TRC_SHARED_EN           RKH_ENABLED
+#define RKH_CFG_TRC_SIZEOF_STREAM       128u
+#define RKH_CFG_TRC_ALL_EN              RKH_ENABLED
+#define RKH_CFG_TRC_RTFIL_EN            RKH_DISABLED
+#define RKH_CFG_TRC_RTFIL_SMA_EN        RKH_DISABLED
+#define RKH_CFG_TRC_RTFIL_SIGNAL_EN     RKH_DISABLED
+#define RKH_CFG_TRC_USER_TRACE_EN       RKH_DISABLED
+#define RKH_CFG_TRC_MP_EN               RKH_DISABLED
+#define RKH_CFG_TRC_QUE_EN              RKH_DISABLED
+#define RKH_CFG_TRC_SMA_EN              RKH_DISABLED
+#define RKH_CFG_TRC_TMR_EN              RKH_DISABLED
+#define RKH_CFG_TRC_SM_EN               RKH_DISABLED
+#define RKH_CFG_TRC_FWK_EN              RKH_DISABLED
+#define RKH_CFG_TRC_ASSERT_EN           RKH_DISABLED
+#define RKH_CFG_TRC_SM_INIT_EN          RKH_DISABLED
+#define RKH_CFG_TRC_SM_DCH_EN           RKH_DISABLED
+#define RKH_CFG_TRC_SM_CLRH_EN          RKH_DISABLED
+#define RKH_CFG_TRC_SM_TRN_EN           RKH_DISABLED
+#define RKH_CFG_TRC_SM_STATE_EN         RKH_DISABLED
+#define RKH_CFG_TRC_SM_ENSTATE_EN       RKH_DISABLED
+#define RKH_CFG_TRC_SM_EXSTATE_EN       RKH_DISABLED
+#define RKH_CFG_TRC_SM_NENEX_EN         RKH_DISABLED
+#define RKH_CFG_TRC_SM_NTRNACT_EN       RKH_DISABLED
+#define RKH_CFG_TRC_SM_TS_STATE_EN      RKH_DISABLED
+#define RKH_CFG_TRC_SM_PROCESS_EN       RKH_DISABLED
+#define RKH_CFG_TRC_SM_EXE_ACT_EN       RKH_DISABLED
+#define RKH_CFG_TRC_NSEQ_EN             RKH_ENABLED
+#define RKH_CFG_TRC_CHK_EN              RKH_ENABLED
+#define RKH_CFG_TRC_TSTAMP_EN           RKH_ENABLED
+
+/* --- Default layout of the decoder, until a RKH_TE_FWK_TCFG arrives ----- */
+#define RKH_CFG_FWK_SIZEOF_EVT          8u
+#define RKH_CFG_FWK_SIZEOF_EVT_SIZE     16u
+#define RKH_CFG_QUE_SIZEOF_NELEM        8u
+#define RKH_CFG_MP_SIZEOF_BSIZE         8u
+#define RKH_CFG_MP_SIZEOF_NBLOCK        8u
+#define RKH_CFG_TMR_SIZEOF_NTIMER       16u
+
+/* --- Options required by rkhitl.h, unused by the analyzer --------------- */
+#define RKH_CFG_FWK_MAX_SMA             1u
+#define RKH_CFG_FWK_DYN_EVT_EN          RKH_DISABLED
+#define RKH_CFG_FWK_MAX_EVT_POOL        0u
+#define RKH_CFG_FWK_MAX_SIGNALS         1u
+#define RKH_CFG_FWK_DEFER_EVT_EN        RKH_DISABLED
+#define RKH_CFG_FWK_ASSERT_EN           RKH_DISABLED
+#define RKH_CFG_HOOK_DISPATCH_EN        RKH_DISABLED
+#define RKH_CFG_HOOK_SIGNAL_EN          RKH_DISABLED
+#define RKH_CFG_HOOK_TIMEOUT_EN         RKH_DISABLED
+#define RKH_CFG_HOOK_START_EN           RKH_DISABLED
+#define RKH_CFG_HOOK_EXIT_EN            RKH_DISABLED
+#define RKH_CFG_HOOK_TIMETICK_EN        RKH_DISABLED
+#define RKH_CFG_HOOK_PUT_TRCEVT_EN      RKH_DISABLED
+
+#define RKH_CFG_SMA_GET_INFO_EN         RKH_DISABLED
+#define RKH_CFG_SMA_PPRO_EN             RKH_DISABLED
+#define RKH_CFG_SMA_HCAL_EN             RKH_DISABLED
+#define RKH_CFG_SMA_MAX_HCAL_DEPTH      4u
+#define RKH_CFG_SMA_MAX_TRC_SEGS        4u
+#define RKH_CFG_SMA_PSEUDOSTATE_EN      RKH_DISABLED
+#define RKH_CFG_SMA_DEEP_HIST_EN        RKH_DISABLED
+#define RKH_CFG_SMA_SHALLOW_HIST_EN     RKH_DISABLED
+#define RKH_CFG_SMA_CHOICE_EN           RKH_DISABLED
+#define RKH_CFG_SMA_CONDITIONAL_EN      RKH_DISABLED
+#define RKH_CFG_SMA_SUBMACHINE_EN       RKH_DISABLED
+#define RKH_CFG_SMA_TRC_SNDR_EN         RKH_DISABLED
+#define RKH_CFG_SMA_INIT_EVT_EN         RKH_DISABLED
+#define RKH_CFG_SMA_ENT_ARG_SMA_EN      RKH_DISABLED
+#define RKH_CFG_SMA_ENT_ARG_STATE_EN    RKH_DISABLED
+#define RKH_CFG_SMA_EXT_ARG_SMA_EN      RKH_DISABLED
+#define RKH_CFG_SMA_EXT_ARG_STATE_EN    RKH_DISABLED
+#define RKH_CFG_SMA_ACT_ARG_SMA_EN      RKH_DISABLED
+#define RKH_CFG_SMA_ACT_ARG_EVT_EN      RKH_DISABLED
+#define RKH_CFG_SMA_GRD_ARG_EVT_EN      RKH_DISABLED
+#define RKH_CFG_SMA_GRD_ARG_SMA_EN      RKH_DISABLED
+#define RKH_CFG_SMA_PPRO_ARG_SMA_EN     RKH_DISABLED
+#define RKH_CFG_SMA_SM_CONST_EN         RKH_DISABLED
+#define RKH_CFG_SMA_RT_CTOR_EN          RKH_DISABLED
+#define RKH_CFG_SMA_VFUNCT_EN           RKH_DISABLED
+#define RKH_CFG_SMA_ORTHREG_EN          RKH_DISABLED
+
+#define RKH_CFG_QUE_EN                  RKH_ENABLED
+#define RKH_CFG_QUE_GET_LWMARK_EN       RKH_DISABLED
+#define RKH_CFG_QUE_READ_EN             RKH_DISABLED
+#define RKH_CFG_QUE_DEPLETE_EN          RKH_DISABLED
+#define RKH_CFG_QUE_IS_FULL_EN          RKH_DISABLED
+#define RKH_CFG_QUE_GET_NELEMS_EN       RKH_DISABLED
+#define RKH_CFG_QUE_PUT_LIFO_EN         RKH_DISABLED
+#define RKH_CFG_QUE_GET_INFO_EN         RKH_DISABLED
+
+#define RKH_CFG_MP_EN                   RKH_DISABLED
+#define RKH_CFG_TMR_EN                  RKH_DISABLED
+
+#endif
+
+/* ------------------------------ End of file ------------------------------ */
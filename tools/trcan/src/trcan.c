@@ -0,0 +1,907 @@
+/*
+ *  --------------------------------------------------------------------------
+ *
+ *                                Framework RKH
+ *                                -------------
+ *
+ *            State-machine framework for reactive embedded systems
+ *
+ *                      Copyright (C) 2010 Leandro Francucci.
+ *          All rights reserved. Protected by international copyright laws.
+ *
+ *
+ *  RKH is free software: you can redistribute it and/or modify it under the
+ *  terms of the GNU General Public License as published by the Free Software
+ *  Foundation, either version 3 of the License, or (at your option) any
+ *  later version.
+ *
+ *  RKH is distributed in the hope that it will be useful, but WITHOUT ANY
+ *  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with RKH, see copying.txt file.
+ *
+ *  Contact information:
+ *  RKH site: http://vortexmakes.com/que-es/
+ *  RKH GitHub: https://github.com/vortexmakes/RKH
+ *  RKH Sourceforge: https://sourceforge.net/projects/rkh-reactivesys/
+ *  e-mail: lf@vortexmakes.com
+ *  ---------------------------------------------------------------------------
+ */
+
+/**
+ *  \file       trcan.c
+ *  \brief      Performance analyzer of a decoded trace stream.
+ */
+
+/* -------------------------- Development history -------------------------- */
+/*
+ *  2026.10.19  LeFr  v3.4.00  Initial version
+ */
+
+/* -------------------------------- Authors -------------------------------- */
+/*
+ *  LeFr  Leandro Francucci  lf@vortexmakes.com
+ */
+
+/* --------------------------------- Notes --------------------------------- */
+/*
+ *  Each active object keeps the timestamps of the events posted to it, in 
+ *  the order of its queue, so that a RKH_TE_SMA_GET record takes the 
+ *  oldest one, or the newest one if it was posted as LIFO. The queue 
+ *  depth given by the records fixes up the pending posts when records 
+ *  were lost or when the events were posted before the capture started, 
+ *  in which case their latencies are unknown.
+ *
+ *  A dispatch ends at the record that ends the processing of the event, 
+ *  i.e. RKH_TE_SM_EVT_PROC, or at the last record of the state machine 
+ *  seen before its next dispatch, i.e. when a guard evaluates to false.
+ */
+
+/* ----------------------------- Include files ----------------------------- */
+#include <stdlib.h>
+#include <string.h>
+#include "trcan.h"
+
+/* ----------------------------- Local macros ------------------------------ */
+#define TS_DIFF(t1_, t0_)       (((t1_) - (t0_)) & tsMask)
+
+/* ------------------------------- Constants ------------------------------- */
+#define NO_VALUE                0xfffffffful
+#define SIZEOF_NAME             64u
+#define MIN_PENDING             16u
+
+/* ---------------------------- Local data types --------------------------- */
+typedef struct Symbol Symbol;
+struct Symbol
+{
+    rui32_t value;
+    char name[SIZEOF_NAME];
+};
+
+typedef struct Pending Pending;
+struct Pending
+{
+    rui32_t tstamp;
+    rbool_t isKnown;        /* posted after the capture started */
+};
+
+typedef struct Ao Ao;
+struct Ao
+{
+    rui32_t addr;
+    rui32_t nPosts;
+    rui32_t nGets;
+    rui32_t nDispatches;
+    rui32_t dchMin;
+    rui32_t dchMax;
+    unsigned long long dchSum;
+    rbool_t isDispatching;
+    rui32_t dchStart;
+    rui32_t dchLast;        /* last record of the state machine */
+    rui32_t qMax;
+    rui32_t qMin;           /* low watermark of free entries, if any */
+    rui32_t nLat;
+    rui32_t latMin;
+    rui32_t latMax;
+    unsigned long long latSum;
+    rui32_t hist[TRCAN_NUM_BUCKETS];
+    Pending *pend;          /* circular buffer of pending posts */
+    rui32_t pendSize;       /* a power of two */
+    rui32_t pendHead;
+    rui32_t pendQty;
+};
+
+typedef struct Pool Pool;
+struct Pool
+{
+    rui32_t addr;
+    rui32_t nBlocks;
+    rui32_t blockSize;
+    rui32_t nGets;
+    rui32_t nPuts;
+    rui32_t nFree;
+    rui32_t minFree;
+};
+
+typedef struct Sample Sample;
+struct Sample
+{
+    rui32_t tstamp;
+    rui32_t ao;
+    rui32_t sig;
+    rui32_t depth;
+    RKH_TE_ID_T eid;
+};
+
+typedef struct Vector Vector;
+struct Vector
+{
+    void *items;
+    rui32_t qty;
+    rui32_t size;
+};
+
+/* ---------------------------- Global variables --------------------------- */
+/* ---------------------------- Local variables ---------------------------- */
+static Vector aos, pools, samples, objNames, sigNames;
+static rui32_t tsMask;
+static rui32_t tsHz;
+static rui32_t nRecords;
+static rui32_t nErrors;
+static rui32_t nLost;
+static rui32_t nDropped;
+static rbool_t isResyncing;
+
+/* ----------------------- Local function prototypes ----------------------- */
+/* ---------------------------- Local functions ---------------------------- */
+static void *
+grow(Vector *me, size_t sizeofItem)
+{
+    void *items;
+
+    if (me->qty == me->size)
+    {
+        me->size = (me->size == 0) ? MIN_PENDING : (me->size * 2);
+        items = realloc(me->items, me->size * sizeofItem);
+        if (items == NULL)
+        {
+            fprintf(stderr, "trcan: out of memory\n");
+            exit(EXIT_FAILURE);
+        }
+        me->items = items;
+    }
+    return (char *)me->items + (me->qty++ * sizeofItem);
+}
+
+static void
+setName(Vector *names, rui32_t value, const RKHTrcDecArg *arg)
+{
+    Symbol *sym;
+    rui32_t i, len;
+
+    for (i = 0, sym = (Symbol *)names->items; i < names->qty; ++i, ++sym)
+    {
+        if (sym->value == value)
+        {
+            break;
+        }
+    }
+    if (i == names->qty)
+    {
+        sym = (Symbol *)grow(names, sizeof(Symbol));
+        sym->value = value;
+    }
+    len = (arg->value < (SIZEOF_NAME - 1)) ? arg->value : (SIZEOF_NAME - 1);
+    memcpy(sym->name, arg->data, len);
+    sym->name[len] = '\0';
+}
+
+static const char *
+getName(const Vector *names, rui32_t value, char *buf, const char *fmt)
+{
+    const Symbol *sym;
+    rui32_t i;
+
+    for (i = 0, sym = (const Symbol *)names->items; i < names->qty; 
+         ++i, ++sym)
+    {
+        if (sym->value == value)
+        {
+            return sym->name;
+        }
+    }
+    sprintf(buf, fmt, (unsigned long)value);
+    return buf;
+}
+
+static Ao *
+getAo(rui32_t addr)
+{
+    Ao *ao;
+    rui32_t i;
+
+    for (i = 0, ao = (Ao *)aos.items; i < aos.qty; ++i, ++ao)
+    {
+        if (ao->addr == addr)
+        {
+            return ao;
+        }
+    }
+    ao = (Ao *)grow(&aos, sizeof(Ao));
+    memset(ao, 0, sizeof(Ao));
+    ao->addr = addr;
+    ao->dchMin = ao->latMin = ao->qMin = NO_VALUE;
+    return ao;
+}
+
+static Pool *
+getPool(rui32_t addr)
+{
+    Pool *pool;
+    rui32_t i;
+
+    for (i = 0, pool = (Pool *)pools.items; i < pools.qty; ++i, ++pool)
+    {
+        if (pool->addr == addr)
+        {
+            return pool;
+        }
+    }
+    pool = (Pool *)grow(&pools, sizeof(Pool));
+    memset(pool, 0, sizeof(Pool));
+    pool->addr = addr;
+    pool->nFree = pool->minFree = NO_VALUE;
+    return pool;
+}
+
+static void
+pushPending(Ao *ao, rui32_t tstamp, rbool_t isKnown, rbool_t isLifo)
+{
+    Pending *pend;
+    rui32_t i, mask;
+
+    if (ao->pendQty == ao->pendSize)
+    {
+        i = (ao->pendSize == 0) ? MIN_PENDING : (ao->pendSize * 2);
+        pend = (Pending *)malloc(i * sizeof(Pending));
+        if (pend == NULL)
+        {
+            fprintf(stderr, "trcan: out of memory\n");
+            exit(EXIT_FAILURE);
+        }
+        for (mask = ao->pendSize - 1, i = 0; i < ao->pendQty; ++i)
+        {
+            pend[i] = ao->pend[(ao->pendHead + i) & mask];
+        }
+        free(ao->pend);
+        ao->pend = pend;
+        ao->pendSize = (ao->pendSize == 0) ? MIN_PENDING : 
+                                             (ao->pendSize * 2);
+        ao->pendHead = 0;
+    }
+    mask = ao->pendSize - 1;
+    if (isLifo)
+    {
+        ao->pendHead = (ao->pendHead - 1) & mask;
+        i = ao->pendHead;
+    }
+    else
+    {
+        i = (ao->pendHead + ao->pendQty) & mask;
+    }
+    ao->pend[i].tstamp = tstamp;
+    ao->pend[i].isKnown = isKnown;
+    ++ao->pendQty;
+}
+
+static rbool_t
+popPending(Ao *ao, Pending *pend)
+{
+    if (ao->pendQty == 0)
+    {
+        return RKH_FALSE;
+    }
+    *pend = ao->pend[ao->pendHead];
+    ao->pendHead = (ao->pendHead + 1) & (ao->pendSize - 1);
+    --ao->pendQty;
+    return RKH_TRUE;
+}
+
+/*
+ *  Makes the number of pending posts equal to the depth of the queue. 
+ *  The oldest ones were lost if there are more, and they were posted 
+ *  before the capture or lost if there are less.
+ */
+static void
+fixPending(Ao *ao, rui32_t depth, rui32_t tstamp)
+{
+    Pending pend;
+
+    while (ao->pendQty > depth)
+    {
+        (void)popPending(ao, &pend);
+    }
+    while (ao->pendQty < depth)
+    {
+        pushPending(ao, tstamp, RKH_FALSE, RKH_TRUE);
+    }
+}
+
+static rui32_t
+getBucket(rui32_t value)
+{
+    rui32_t n;
+
+    for (n = 0; value != 0; value >>= 1)
+    {
+        ++n;
+    }
+    return n;
+}
+
+static void
+endDispatch(Ao *ao, rui32_t tstamp)
+{
+    rui32_t d;
+
+    if (ao->isDispatching)
+    {
+        ao->isDispatching = RKH_FALSE;
+        d = TS_DIFF(tstamp, ao->dchStart);
+        ++ao->nDispatches;
+        ao->dchSum += d;
+        ao->dchMin = (d < ao->dchMin) ? d : ao->dchMin;
+        ao->dchMax = (d > ao->dchMax) ? d : ao->dchMax;
+    }
+}
+
+static void
+putSample(const RKHTrcDecRecord *rec, Ao *ao, rui32_t depth)
+{
+    Sample *s;
+
+    s = (Sample *)grow(&samples, sizeof(Sample));
+    s->tstamp = rec->tstamp;
+    s->ao = ao->addr;
+    s->sig = rec->args[1].value;
+    s->depth = depth;
+    s->eid = rec->eid;
+    ao->qMax = (depth > ao->qMax) ? depth : ao->qMax;
+}
+
+static void
+post(const RKHTrcDecRecord *rec, const RKHTrcDecCfg *cfg)
+{
+    Ao *ao;
+    rui32_t base, depth;
+
+    ao = getAo(rec->args[0].value);
+    base = ((cfg->options & RKH_TRC_DEC_SNDR_EN) != 0) ? 3 : 2;
+    depth = rec->args[base + 2].value;
+    if ((cfg->options & RKH_TRC_DEC_QUE_LWM_EN) != 0)
+    {
+        ao->qMin = rec->args[base + 3].value;
+    }
+    ++ao->nPosts;
+    pushPending(ao, rec->tstamp, RKH_TRUE, rec->eid == RKH_TE_SMA_LIFO);
+    fixPending(ao, depth, rec->tstamp);
+    putSample(rec, ao, depth);
+}
+
+static void
+get(const RKHTrcDecRecord *rec, const RKHTrcDecCfg *cfg)
+{
+    Ao *ao;
+    Pending pend;
+    rui32_t lat, n, depth;
+
+    ao = getAo(rec->args[0].value);
+    depth = rec->args[4].value;
+    if ((cfg->options & RKH_TRC_DEC_QUE_LWM_EN) != 0)
+    {
+        ao->qMin = rec->args[5].value;
+    }
+    ++ao->nGets;
+    if (popPending(ao, &pend) && pend.isKnown)
+    {
+        lat = TS_DIFF(rec->tstamp, pend.tstamp);
+        ++ao->nLat;
+        ao->latSum += lat;
+        ao->latMin = (lat < ao->latMin) ? lat : ao->latMin;
+        ao->latMax = (lat > ao->latMax) ? lat : ao->latMax;
+        n = getBucket(lat);
+        ++ao->hist[n];
+    }
+    fixPending(ao, depth, rec->tstamp);
+    putSample(rec, ao, depth);
+}
+
+static void
+dispatch(const RKHTrcDecRecord *rec)
+{
+    Ao *ao;
+    rui32_t addr;
+
+    addr = rec->args[(rec->eid == RKH_TE_SM_EXE_ACT) ? 1 : 0].value;
+    ao = getAo(addr);
+    switch (rec->eid)
+    {
+        case RKH_TE_SM_DCH:
+            endDispatch(ao, ao->dchLast);
+            ao->isDispatching = RKH_TRUE;
+            ao->dchStart = rec->tstamp;
+            break;
+        case RKH_TE_SM_EVT_PROC:
+        case RKH_TE_SM_EVT_NFOUND:
+        case RKH_TE_SM_CND_NFOUND:
+        case RKH_TE_SM_UNKN_STATE:
+        case RKH_TE_SM_EX_HLEVEL:
+        case RKH_TE_SM_EX_TSEG:
+            endDispatch(ao, rec->tstamp);
+            break;
+        default:
+            break;
+    }
+    ao->dchLast = rec->tstamp;
+}
+
+static void
+pool(const RKHTrcDecRecord *rec, const RKHTrcDecCfg *cfg)
+{
+    Pool *p;
+
+    p = getPool(rec->args[0].value);
+    switch (rec->eid)
+    {
+        case RKH_TE_MP_INIT:
+            p->nBlocks = rec->args[1].value;
+            p->blockSize = rec->args[2].value;
+            p->nFree = p->minFree = p->nBlocks;
+            break;
+        case RKH_TE_MP_GET:
+            ++p->nGets;
+            p->nFree = rec->args[1].value;
+            if ((cfg->options & RKH_TRC_DEC_MP_LWM_EN) != 0)
+            {
+                p->minFree = rec->args[2].value;
+            }
+            break;
+        case RKH_TE_MP_PUT:
+            ++p->nPuts;
+            p->nFree = rec->args[1].value;
+            break;
+        default:
+            break;
+    }
+    if (p->nFree < p->minFree)
+    {
+        p->minFree = p->nFree;
+    }
+}
+
+static void
+putString(FILE *out, const char *s, TrcAnFormat format)
+{
+    if (format == TRCAN_CSV)
+    {
+        fputs(s, out);
+        return;
+    }
+    fputc('"', out);
+    for (; *s != '\0'; ++s)
+    {
+        if ((*s == '"') || (*s == '\\'))
+        {
+            fprintf(out, "\\%c", *s);
+        }
+        else if ((unsigned char)*s < 0x20)
+        {
+            fprintf(out, "\\u%04x", (unsigned char)*s);
+        }
+        else
+        {
+            fputc(*s, out);
+        }
+    }
+    fputc('"', out);
+}
+
+static void
+putValue(FILE *out, TrcAnFormat format, rui32_t value)
+{
+    if (value == NO_VALUE)
+    {
+        fputs((format == TRCAN_JSON) ? "null" : "", out);
+    }
+    else
+    {
+        fprintf(out, "%lu", (unsigned long)value);
+    }
+}
+
+static void
+putMean(FILE *out, TrcAnFormat format, unsigned long long sum, rui32_t n)
+{
+    if (n == 0)
+    {
+        fputs((format == TRCAN_JSON) ? "null" : "", out);
+    }
+    else
+    {
+        fprintf(out, "%.1f", (double)sum / n);
+    }
+}
+
+/*
+ *  A report is a JSON array of objects, or a CSV table, whose columns are 
+ *  given by the fields of the first row.
+ */
+static void
+beginRow(FILE *out, TrcAnFormat format, rui32_t row)
+{
+    if (format == TRCAN_JSON)
+    {
+        fputs((row == 0) ? "\n    {" : ",\n    {", out);
+    }
+}
+
+static void
+putField(FILE *out, TrcAnFormat format, const char *name, rbool_t isFirst)
+{
+    if (format == TRCAN_JSON)
+    {
+        fprintf(out, "%s\"%s\": ", isFirst ? "" : ", ", name);
+    }
+    else if (!isFirst)
+    {
+        fputc(',', out);
+    }
+}
+
+static void
+endRow(FILE *out, TrcAnFormat format)
+{
+    fputs((format == TRCAN_JSON) ? "}" : "\n", out);
+}
+
+static void
+putHeader(FILE *out, TrcAnFormat format, const char *title, 
+          const char *columns)
+{
+    if (format == TRCAN_JSON)
+    {
+        fprintf(out, "  \"%s\": [", title);
+    }
+    else
+    {
+        fprintf(out, "%s\n", columns);
+    }
+}
+
+static void
+putFooter(FILE *out, TrcAnFormat format, rui32_t nRows)
+{
+    if (format == TRCAN_JSON)
+    {
+        fputs((nRows == 0) ? "]" : "\n  ]", out);
+    }
+}
+
+static void
+printAo(FILE *out, TrcAnFormat format)
+{
+    const Ao *ao;
+    rui32_t i;
+    char buf[SIZEOF_NAME];
+
+    putHeader(out, format, "ao", 
+              "ao,posts,gets,dispatches,dchMin,dchMax,dchMean,dchTotal,"
+              "queueMax,queueMinFree,latencies,latMin,latMax,latMean");
+    for (i = 0, ao = (const Ao *)aos.items; i < aos.qty; ++i, ++ao)
+    {
+        beginRow(out, format, i);
+        putField(out, format, "ao", RKH_TRUE);
+        putString(out, getName(&objNames, ao->addr, buf, "0x%08lx"), format);
+        putField(out, format, "posts", RKH_FALSE);
+        putValue(out, format, ao->nPosts);
+        putField(out, format, "gets", RKH_FALSE);
+        putValue(out, format, ao->nGets);
+        putField(out, format, "dispatches", RKH_FALSE);
+        putValue(out, format, ao->nDispatches);
+        putField(out, format, "dchMin", RKH_FALSE);
+        putValue(out, format, ao->dchMin);
+        putField(out, format, "dchMax", RKH_FALSE);
+        putValue(out, format, 
+                 (ao->nDispatches != 0) ? ao->dchMax : NO_VALUE);
+        putField(out, format, "dchMean", RKH_FALSE);
+        putMean(out, format, ao->dchSum, ao->nDispatches);
+        putField(out, format, "dchTotal", RKH_FALSE);
+        fprintf(out, "%llu", ao->dchSum);
+        putField(out, format, "queueMax", RKH_FALSE);
+        putValue(out, format, ao->qMax);
+        putField(out, format, "queueMinFree", RKH_FALSE);
+        putValue(out, format, ao->qMin);
+        putField(out, format, "latencies", RKH_FALSE);
+        putValue(out, format, ao->nLat);
+        putField(out, format, "latMin", RKH_FALSE);
+        putValue(out, format, ao->latMin);
+        putField(out, format, "latMax", RKH_FALSE);
+        putValue(out, format, (ao->nLat != 0) ? ao->latMax : NO_VALUE);
+        putField(out, format, "latMean", RKH_FALSE);
+        putMean(out, format, ao->latSum, ao->nLat);
+        endRow(out, format);
+    }
+    putFooter(out, format, aos.qty);
+}
+
+static void
+printLatency(FILE *out, TrcAnFormat format)
+{
+    const Ao *ao;
+    rui32_t i, n, nRows;
+    char buf[SIZEOF_NAME];
+
+    putHeader(out, format, "latency", "ao,from,to,count");
+    for (i = nRows = 0, ao = (const Ao *)aos.items; i < aos.qty; ++i, ++ao)
+    {
+        for (n = 0; n < TRCAN_NUM_BUCKETS; ++n)
+        {
+            if (ao->hist[n] == 0)
+            {
+                continue;
+            }
+            beginRow(out, format, nRows++);
+            putField(out, format, "ao", RKH_TRUE);
+            putString(out, getName(&objNames, ao->addr, buf, "0x%08lx"), 
+                      format);
+            putField(out, format, "from", RKH_FALSE);
+            putValue(out, format, (n == 0) ? 0 : (1ul << (n - 1)));
+            putField(out, format, "to", RKH_FALSE);
+            fprintf(out, "%llu", 1ull << n);
+            putField(out, format, "count", RKH_FALSE);
+            putValue(out, format, ao->hist[n]);
+            endRow(out, format);
+        }
+    }
+    putFooter(out, format, nRows);
+}
+
+static void
+printQueue(FILE *out, TrcAnFormat format)
+{
+    const Sample *s;
+    rui32_t i;
+    char buf[SIZEOF_NAME];
+
+    putHeader(out, format, "queue", "tstamp,ao,op,signal,depth");
+    for (i = 0, s = (const Sample *)samples.items; i < samples.qty; 
+         ++i, ++s)
+    {
+        beginRow(out, format, i);
+        putField(out, format, "tstamp", RKH_TRUE);
+        putValue(out, format, s->tstamp);
+        putField(out, format, "ao", RKH_FALSE);
+        putString(out, getName(&objNames, s->ao, buf, "0x%08lx"), format);
+        putField(out, format, "op", RKH_FALSE);
+        putString(out, (s->eid == RKH_TE_SMA_GET) ? "get" : 
+                       (s->eid == RKH_TE_SMA_FIFO) ? "fifo" : "lifo", 
+                  format);
+        putField(out, format, "signal", RKH_FALSE);
+        putString(out, getName(&sigNames, s->sig, buf, "%lu"), format);
+        putField(out, format, "depth", RKH_FALSE);
+        putValue(out, format, s->depth);
+        endRow(out, format);
+    }
+    putFooter(out, format, samples.qty);
+}
+
+static void
+printPool(FILE *out, TrcAnFormat format)
+{
+    const Pool *p;
+    rui32_t i, used;
+    char buf[SIZEOF_NAME];
+
+    putHeader(out, format, "pool", 
+              "pool,blocks,blockSize,gets,puts,used,peakUsed,minFree");
+    for (i = 0, p = (const Pool *)pools.items; i < pools.qty; ++i, ++p)
+    {
+        beginRow(out, format, i);
+        putField(out, format, "pool", RKH_TRUE);
+        putString(out, getName(&objNames, p->addr, buf, "0x%08lx"), format);
+        putField(out, format, "blocks", RKH_FALSE);
+        putValue(out, format, (p->nBlocks != 0) ? p->nBlocks : NO_VALUE);
+        putField(out, format, "blockSize", RKH_FALSE);
+        putValue(out, format, (p->nBlocks != 0) ? p->blockSize : NO_VALUE);
+        putField(out, format, "gets", RKH_FALSE);
+        putValue(out, format, p->nGets);
+        putField(out, format, "puts", RKH_FALSE);
+        putValue(out, format, p->nPuts);
+        used = ((p->nBlocks != 0) && (p->nFree != NO_VALUE)) ? 
+               (p->nBlocks - p->nFree) : NO_VALUE;
+        putField(out, format, "used", RKH_FALSE);
+        putValue(out, format, used);
+        used = ((p->nBlocks != 0) && (p->minFree != NO_VALUE)) ? 
+               (p->nBlocks - p->minFree) : NO_VALUE;
+        putField(out, format, "peakUsed", RKH_FALSE);
+        putValue(out, format, used);
+        putField(out, format, "minFree", RKH_FALSE);
+        putValue(out, format, p->minFree);
+        endRow(out, format);
+    }
+    putFooter(out, format, pools.qty);
+}
+
+/* ---------------------------- Global functions --------------------------- */
+void
+trcan_init(void)
+{
+    memset(&aos, 0, sizeof(aos));
+    memset(&pools, 0, sizeof(pools));
+    memset(&samples, 0, sizeof(samples));
+    memset(&objNames, 0, sizeof(objNames));
+    memset(&sigNames, 0, sizeof(sigNames));
+    tsMask = 0xfffffffful;
+    tsHz = 0;
+    nRecords = nErrors = nLost = nDropped = 0;
+    isResyncing = RKH_FALSE;
+}
+
+void
+trcan_deinit(void)
+{
+    Ao *ao;
+    rui32_t i;
+
+    for (i = 0, ao = (Ao *)aos.items; i < aos.qty; ++i, ++ao)
+    {
+        free(ao->pend);
+    }
+    free(aos.items);
+    free(pools.items);
+    free(samples.items);
+    free(objNames.items);
+    free(sigNames.items);
+    trcan_init();
+}
+
+void
+trcan_put(const RKHTrcDecRecord *rec, const RKHTrcDecCfg *cfg)
+{
+    RKH_TE_ID_T eid;
+    rui32_t i;
+
+    ++nRecords;
+    if (!rec->isSynced)         /* addresses and timestamp are not */
+    {                           /* reliable */
+        if (!isResyncing)
+        {
+            trcan_resync();
+            isResyncing = RKH_TRUE;
+        }
+        return;
+    }
+    isResyncing = RKH_FALSE;
+    for (i = 0; i < rec->nArgs; ++i)
+    {
+        if (rec->args[i].kind == RKH_TRC_DEC_UNKNOWN)
+        {
+            return;
+        }
+    }
+
+    tsMask = (cfg->sizeofTstamp == 2) ? 0xffffu : 0xfffffffful;
+    eid = rec->eid;
+    if ((eid == RKH_TE_SMA_FIFO) || (eid == RKH_TE_SMA_LIFO))
+    {
+        post(rec, cfg);
+    }
+    else if (eid == RKH_TE_SMA_GET)
+    {
+        get(rec, cfg);
+    }
+    else if ((eid >= RKH_SM_START) && (eid <= RKH_SM_END) && 
+             (rec->nArgs != 0))
+    {
+        dispatch(rec);
+    }
+    else if ((eid == RKH_TE_MP_INIT) || (eid == RKH_TE_MP_GET) || 
+             (eid == RKH_TE_MP_PUT))
+    {
+        pool(rec, cfg);
+    }
+    else if ((eid == RKH_TE_FWK_OBJ) || (eid == RKH_TE_FWK_AO) || 
+             (eid == RKH_TE_FWK_QUEUE) || (eid == RKH_TE_FWK_ACTOR) ||
+             (eid == RKH_TE_FWK_TIMER))
+    {
+        setName(&objNames, rec->args[0].value, &rec->args[1]);
+    }
+    else if (eid == RKH_TE_FWK_SIG)
+    {
+        setName(&sigNames, rec->args[0].value, &rec->args[1]);
+    }
+    else if (eid == RKH_TE_FWK_TCFG)
+    {
+        tsHz = rec->args[7].value;
+    }
+    else if (eid == RKH_TE_FWK_DROP)
+    {
+        nDropped = rec->args[0].value;
+        trcan_resync();
+    }
+}
+
+void
+trcan_resync(void)
+{
+    Ao *ao;
+    rui32_t i;
+
+    for (i = 0, ao = (Ao *)aos.items; i < aos.qty; ++i, ++ao)
+    {
+        ao->pendQty = 0;
+        ao->isDispatching = RKH_FALSE;
+    }
+}
+
+void
+trcan_setDecStats(rui32_t nDecErrors, rui32_t nDecLost)
+{
+    nErrors = nDecErrors;
+    nLost = nDecLost;
+}
+
+void
+trcan_print(FILE *out, TrcAnFormat format, TrcAnReport report)
+{
+    Ao *ao;
+    rui32_t i;
+
+    /* Dispatches still open end at their last record */
+    for (i = 0, ao = (Ao *)aos.items; i < aos.qty; ++i, ++ao)
+    {
+        endDispatch(ao, ao->dchLast);
+    }
+
+    if (format == TRCAN_JSON)
+    {
+        fprintf(out, "{\n  \"records\": %lu, \"errors\": %lu, "
+                "\"lost\": %lu, \"dropped\": %lu, \"tstampHz\": %lu", 
+                (unsigned long)nRecords, (unsigned long)nErrors, 
+                (unsigned long)nLost, (unsigned long)nDropped, 
+                (unsigned long)tsHz);
+    }
+    if ((report == TRCAN_ALL) || (report == TRCAN_AO))
+    {
+        fputs((format == TRCAN_JSON) ? ",\n" : 
+              (report == TRCAN_ALL) ? "# ao\n" : "", out);
+        printAo(out, format);
+    }
+    if ((report == TRCAN_ALL) || (report == TRCAN_LATENCY))
+    {
+        fputs((format == TRCAN_JSON) ? ",\n" : 
+              (report == TRCAN_ALL) ? "\n# latency\n" : "", out);
+        printLatency(out, format);
+    }
+    if ((report == TRCAN_ALL) || (report == TRCAN_QUEUE))
+    {
+        fputs((format == TRCAN_JSON) ? ",\n" : 
+              (report == TRCAN_ALL) ? "\n# queue\n" : "", out);
+        printQueue(out, format);
+    }
+    if ((report == TRCAN_ALL) || (report == TRCAN_POOL))
+    {
+        fputs((format == TRCAN_JSON) ? ",\n" : 
+              (report == TRCAN_ALL) ? "\n# pool\n" : "", out);
+        printPool(out, format);
+    }
+    if (format == TRCAN_JSON)
+    {
+        fputs("\n}\n", out);
+    }
+}
+
+/* ------------------------------ End of file ------------------------------ */
@@ -0,0 +1,171 @@
+/*
+ *  --------------------------------------------------------------------------
+ *
+ *                                Framework RKH
+ *                                -------------
+ *
+ *            State-machine framework for reactive embedded systems
+ *
+ *                      Copyright (C) 2010 Leandro Francucci.
+ *          All rights reserved. Protected by international copyright laws.
+ *
+ *
+ *  RKH is free software: you can redistribute it and/or modify it under the
+ *  terms of the GNU General Public License as published by the Free Software
+ *  Foundation, either version 3 of the License, or (at your option) any
+ *  later version.
+ *
+ *  RKH is distributed in the hope that it will be useful, but WITHOUT ANY
+ *  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with RKH, see copying.txt file.
+ *
+ *  Contact information:
+ *  RKH site: http://vortexmakes.com/que-es/
+ *  RKH GitHub: https://github.com/vortexmakes/RKH
+ *  RKH Sourceforge: https://sourceforge.net/projects/rkh-reactivesys/
+ *  e-mail: lf@vortexmakes.com
+ *  ---------------------------------------------------------------------------
+ */
+
+/**
+ *  \file       trcan.h
+ *  \brief      Performance analyzer of a decoded trace stream.
+ */
+
+/* -------------------------- Development history -------------------------- */
+/*
+ *  2026.10.19  LeFr  v3.4.00  Initial version
+ */
+
+/* -------------------------------- Authors -------------------------------- */
+/*
+ *  LeFr  Leandro Francucci  lf@vortexmakes.com
+ */
+
+/* --------------------------------- Notes --------------------------------- */
+/*
+ *  The analyzer is fed with the records given by rkhtrc_decode. It 
+ *  computes, for each active object, the number and duration of its 
+ *  dispatches, from RKH_TE_SM_DCH to the record that ends the processing 
+ *  of the event, the depth of its queue from RKH_TE_SMA_FIFO, 
+ *  RKH_TE_SMA_LIFO and RKH_TE_SMA_GET, and the latency between posting 
+ *  an event and getting it. It also computes the usage of each memory 
+ *  pool from RKH_TE_MP_INIT, RKH_TE_MP_GET and RKH_TE_MP_PUT. Objects and 
+ *  signals are named by the symbol records, i.e. RKH_TE_FWK_AO and 
+ *  RKH_TE_FWK_SIG, if any.
+ *
+ *  Times are given in timestamp ticks, whose rate is taken from the 
+ *  RKH_TE_FWK_TCFG record.
+ */
+
+/* --------------------------------- Module -------------------------------- */
+#ifndef __TRCAN_H__
+#define __TRCAN_H__
+
+/* ----------------------------- Include files ----------------------------- */
+#include <stdio.h>
+#include "rkhtrc_decode.h"
+
+/* ---------------------- External C language linkage ---------------------- */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* --------------------------------- Macros -------------------------------- */
+/* -------------------------------- Constants ------------------------------ */
+/**
+ *  \brief
+ *  Number of buckets of a latency histogram. The bucket n counts the 
+ *  latencies in [2^(n-1), 2^n) ticks, and the bucket 0 the null ones.
+ */
+#define TRCAN_NUM_BUCKETS       33u
+
+/* ------------------------------- Data types ------------------------------ */
+/**
+ *  \brief
+ *  Output formats.
+ */
+typedef enum TrcAnFormat
+{
+    TRCAN_JSON,
+    TRCAN_CSV
+} TrcAnFormat;
+
+/**
+ *  \brief
+ *  Reports, i.e. the tables to be printed.
+ */
+typedef enum TrcAnReport
+{
+    TRCAN_ALL,          /**< every report */
+    TRCAN_AO,           /**< dispatches and latencies per active object */
+    TRCAN_LATENCY,      /**< latency histogram per active object */
+    TRCAN_QUEUE,        /**< queue depth over time */
+    TRCAN_POOL          /**< memory pool usage */
+} TrcAnReport;
+
+/* -------------------------- External variables --------------------------- */
+/* -------------------------- Function prototypes -------------------------- */
+/**
+ *  \brief
+ *  Initializes the analyzer.
+ */
+void trcan_init(void);
+
+/**
+ *  \brief
+ *  Releases the memory taken by the analyzer.
+ */
+void trcan_deinit(void);
+
+/**
+ *  \brief
+ *  Processes a decoded trace record.
+ *
+ *  \param[in] rec      decoded trace record.
+ *  \param[in] cfg      trace options of the target, as known by the 
+ *                      decoder.
+ */
+void trcan_put(const RKHTrcDecRecord *rec, const RKHTrcDecCfg *cfg);
+
+/**
+ *  \brief
+ *  Forgets the pending posts and dispatches, because records were lost.
+ */
+void trcan_resync(void);
+
+/**
+ *  \brief
+ *  Sets the counters of the decoder, which are printed along with the 
+ *  reports.
+ *
+ *  \param[in] nDecErrors   number of malformed records.
+ *  \param[in] nDecLost     number of lost records.
+ */
+void trcan_setDecStats(rui32_t nDecErrors, rui32_t nDecLost);
+
+/**
+ *  \brief
+ *  Prints a report.
+ *
+ *  \param[in] out      output stream.
+ *  \param[in] format   output format.
+ *  \param[in] report   report to be printed. In CSV format, the reports 
+ *                      of TRCAN_ALL are separated by a blank line and 
+ *                      preceded by a comment line with their names.
+ */
+void trcan_print(FILE *out, TrcAnFormat format, TrcAnReport report);
+
+/* -------------------- External C language linkage end -------------------- */
+#ifdef __cplusplus
+}
+#endif
+
+/* ------------------------------ Module end ------------------------------- */
+#endif
+
+/* ------------------------------ End of file ------------------------------ */